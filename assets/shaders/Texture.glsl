@@ -3,17 +3,36 @@
 
 precision highp float;
 
-layout(location = 0) in vec3 a_Position;
-layout(location = 1) in vec4 a_Color;
+// Sommet compact : voir QuadVertex dans Renderer2D.cpp
+layout(location = 0) in vec4 a_Color;    // RGBA8 normalisé
+layout(location = 1) in vec2 a_TexCoord; // unorm16
+layout(location = 2) in vec3 a_Position; // snorm16, relatif à l'origine du lot
+layout(location = 3) in uint a_TexIndex;
 
-uniform mat4 u_ViewProjection;
+#include "Uniforms.glsl"
+
+uniform vec3 u_BatchOrigin;
+uniform vec3 u_BatchExtent;
+#ifdef TEXTURED
+// Répétition des UV, commune au lot (la texture doit être en GL_REPEAT)
+uniform float u_TilingFactor;
+#endif
 
 out vec4 v_Color;
+out vec2 v_TexCoord;
+flat out uint v_TexIndex;
 
 void main()
 {
     v_Color = a_Color;
-    gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+#ifdef TEXTURED
+    v_TexCoord = a_TexCoord * u_TilingFactor;
+#else
+    v_TexCoord = a_TexCoord;
+#endif
+    v_TexIndex = a_TexIndex;
+    vec3 position = u_BatchOrigin + a_Position * u_BatchExtent;
+    gl_Position = u_ViewProjection * vec4(position, 1.0);
 }
 
 #type fragment
@@ -24,8 +43,45 @@ precision mediump float;
 out vec4 FragColor;
 
 in vec4 v_Color;
+in vec2 v_TexCoord;
+flat in uint v_TexIndex;
+
+// Variantes (voir ShaderVariants) :
+//   TEXTURED : échantillonne u_Textures ; sans lui, lot de quads unis (couleur seule)
+#ifdef TEXTURED
+// Slot 0 = texture blanche ; voir Renderer2DData::MaxTextureSlots
+uniform sampler2D u_Textures[16];
+
+// GLSL 3.30 n'autorise que des indices constants dans un tableau de samplers
+vec4 SampleTexture()
+{
+    switch (v_TexIndex)
+    {
+        case 1u: return texture(u_Textures[1], v_TexCoord);
+        case 2u: return texture(u_Textures[2], v_TexCoord);
+        case 3u: return texture(u_Textures[3], v_TexCoord);
+        case 4u: return texture(u_Textures[4], v_TexCoord);
+        case 5u: return texture(u_Textures[5], v_TexCoord);
+        case 6u: return texture(u_Textures[6], v_TexCoord);
+        case 7u: return texture(u_Textures[7], v_TexCoord);
+        case 8u: return texture(u_Textures[8], v_TexCoord);
+        case 9u: return texture(u_Textures[9], v_TexCoord);
+        case 10u: return texture(u_Textures[10], v_TexCoord);
+        case 11u: return texture(u_Textures[11], v_TexCoord);
+        case 12u: return texture(u_Textures[12], v_TexCoord);
+        case 13u: return texture(u_Textures[13], v_TexCoord);
+        case 14u: return texture(u_Textures[14], v_TexCoord);
+        case 15u: return texture(u_Textures[15], v_TexCoord);
+        default: return texture(u_Textures[0], v_TexCoord);
+    }
+}
+#endif
 
 void main()
 {
+#ifdef TEXTURED
+    FragColor = SampleTexture() * v_Color;
+#else
     FragColor = v_Color;
+#endif
 }
@@ -0,0 +1,34 @@
+// Blocs d'uniforms partagés par tous les shaders (#include "Uniforms.glsl")
+// Mêmes champs et même ordre que RendererUniforms.hpp (disposition std140) ;
+// les points de liaison sont attribués au link d'après le nom du bloc.
+
+layout(std140) uniform Camera
+{
+    mat4 u_ViewProjection;
+    mat4 u_View;
+    mat4 u_Projection;
+    vec4 u_CameraPosition;
+};
+
+layout(std140) uniform Frame
+{
+    float u_Time;
+    float u_DeltaTime;
+    float u_FixedAlpha;
+    uint u_FrameIndex;
+    vec2 u_ViewportSize;
+    vec2 u_InverseViewportSize;
+};
+
+struct PointLight
+{
+    vec4 PositionRadius; // xyz = position, w = rayon
+    vec4 ColorIntensity; // rgb = couleur, a = intensité
+};
+
+layout(std140) uniform Lighting
+{
+    vec4 u_AmbientColor;
+    uint u_PointLightCount;
+    PointLight u_PointLights[16]; // LightingUniforms::MaxPointLights
+};
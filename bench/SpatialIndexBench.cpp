@@ -0,0 +1,139 @@
+// Benchmark des index spatiaux (grille uniforme, quadtree lâche) contre une recherche brute.
+// Mesure, pour 1k à 1M entités : construction, mise à jour incrémentale
+// (10% des entités se déplacent par frame) et requêtes de zone.
+
+#include "ecs/Spatial/UniformGrid.hpp"
+#include "ecs/Spatial/LooseQuadtree.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace Tesseract::ECS;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    struct Scene {
+        std::vector<AABB> Bounds;
+        std::vector<AABB> Queries;
+        std::vector<EntityID> Movers;
+        AABB World;
+        float MeanExtent = 0.0f;
+    };
+
+    // Entités de tailles homogènes réparties uniformément, densité constante
+    Scene MakeScene(size_t count, uint32_t seed) {
+        Scene scene;
+        std::mt19937 rng(seed);
+
+        float extent = 1.0f;
+        float half = std::sqrt((float)count) * extent * 2.0f;
+        scene.World = AABB({-half, -half}, {half, half});
+        scene.MeanExtent = extent;
+
+        std::uniform_real_distribution<float> position(-half + extent, half - extent);
+        std::uniform_real_distribution<float> size(0.5f * extent, 1.5f * extent);
+        scene.Bounds.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            glm::vec2 center = {position(rng), position(rng)};
+            glm::vec2 halfSize = glm::vec2(size(rng), size(rng)) * 0.5f;
+            scene.Bounds.push_back(AABB::FromCenter(center, halfSize));
+        }
+
+        // Requêtes de la taille d'un écran (~20x20 unités)
+        for (size_t i = 0; i < 1000; ++i) {
+            glm::vec2 center = {position(rng), position(rng)};
+            scene.Queries.push_back(AABB::FromCenter(center, {10.0f, 10.0f}));
+        }
+
+        std::uniform_int_distribution<size_t> pick(0, count - 1);
+        for (size_t i = 0; i < count / 10; ++i)
+            scene.Movers.push_back((EntityID)pick(rng));
+        return scene;
+    }
+
+    size_t BruteForceQueries(const Scene& scene) {
+        size_t hits = 0;
+        for (const AABB& query : scene.Queries)
+            for (const AABB& bounds : scene.Bounds)
+                hits += bounds.Overlaps(query) ? 1 : 0;
+        return hits;
+    }
+
+    void Run(const char* name, ISpatialIndex& index, Scene& scene, double bruteMs, size_t bruteHits) {
+        auto start = Clock::now();
+        for (EntityID entity = 0; entity < (EntityID)scene.Bounds.size(); ++entity)
+            index.Insert(entity, scene.Bounds[entity]);
+        double buildMs = ElapsedMs(start);
+
+        // Petits déplacements, comme un pas de simulation
+        start = Clock::now();
+        for (EntityID entity : scene.Movers) {
+            AABB& bounds = scene.Bounds[entity];
+            glm::vec2 offset = {0.05f, -0.03f};
+            bounds = AABB(bounds.Min + offset, bounds.Max + offset);
+            index.Update(entity, bounds);
+        }
+        double updateMs = ElapsedMs(start);
+
+        std::vector<EntityID> results;
+        size_t hits = 0;
+        start = Clock::now();
+        for (const AABB& query : scene.Queries) {
+            results.clear();
+            index.QueryRange(query, results);
+            hits += results.size();
+        }
+        double queryMs = ElapsedMs(start);
+
+        std::printf("  %-14s build %9.2f ms | update %8.2f ms | 1000 queries %9.2f ms (x%.1f vs brute)%s\n",
+                    name, buildMs, updateMs, queryMs, bruteMs / std::max(queryMs, 1e-6),
+                    hits == bruteHits ? "" : "  [MISMATCH]");
+    }
+
+} // namespace
+
+int main() {
+    const size_t counts[] = { 1000, 10000, 100000, 1000000 };
+
+    for (size_t count : counts) {
+        std::printf("%zu entities\n", count);
+        Scene scene = MakeScene(count, 42);
+
+        // La recherche brute est mesurée après les déplacements, comme les index
+        Scene moved = scene;
+        for (EntityID entity : moved.Movers) {
+            AABB& bounds = moved.Bounds[entity];
+            glm::vec2 offset = {0.05f, -0.03f};
+            bounds = AABB(bounds.Min + offset, bounds.Max + offset);
+        }
+        auto start = Clock::now();
+        size_t bruteHits = BruteForceQueries(moved);
+        double bruteMs = ElapsedMs(start);
+        std::printf("  %-14s 1000 queries %9.2f ms\n", "BruteForce", bruteMs);
+
+        {
+            Scene local = scene;
+            UniformGrid grid(2.0f * scene.MeanExtent, count);
+            Run("UniformGrid", grid, local, bruteMs, bruteHits);
+        }
+        {
+            Scene local = scene;
+            // Monde élargi, plus petites cellules de la taille moyenne des entités
+            AABB world = AABB::FromCenter(scene.World.GetCenter(), scene.World.GetSize());
+            uint32_t depth = 0;
+            while (depth < LooseQuadtree::MaxSupportedDepth && world.GetSize().x / (float)(1 << (depth + 1)) >= scene.MeanExtent)
+                ++depth;
+            LooseQuadtree quadtree(world, depth);
+            Run("LooseQuadtree", quadtree, local, bruteMs, bruteHits);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "core/Application.hpp"
+
+namespace Tesseract {
+
+    // Application sandbox du moteur
+    class TesseractApp : public Application {
+    public:
+        TesseractApp();
+        ~TesseractApp();
+    };
+
+} // namespace Tesseract
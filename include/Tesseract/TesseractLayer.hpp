@@ -1,12 +1,17 @@
 #pragma once
 
 #include "core/Layer.hpp"
-#include "core/Event.hpp"
+#include "core/Input.hpp"
+#include "core/Events/KeyEvent.hpp"
+#include "core/Events/MouseEvent.hpp"
 #include "core/Renderer/OrthographicCamera.hpp"
+#include "core/Renderer/RendererAPI.hpp"
 #include "core/Timestep.hpp"
 #include "ecs/ECS.hpp"
 #include "ecs/Systems/RenderSystem.hpp"
 #include "ecs/Systems/MovementSystem.hpp"
+#include "ecs/Systems/SpatialIndexSystem.hpp"
+#include "ecs/Systems/CollisionSystem.hpp"
 #include <imgui.h>
 #include <glm/glm.hpp>
 
@@ -21,22 +26,40 @@ namespace Tesseract {
         virtual void OnAttach() override;
         virtual void OnDetach() override;
         virtual void OnUpdate(Timestep ts) override;
+        virtual void OnFixedUpdate(Timestep fixedTs) override;
         virtual void OnImGuiRender() override;
-        virtual void OnEvent(Event& event) override;
 
     private:
+        // Abonnés du bus d'événements de l'Application
+        bool OnKeyPressed(KeyPressedEvent& e);
+        bool OnMouseButtonPressed(MouseButtonPressedEvent& e);
+
         // Créer quelques entités de démo
         void CreateDemoEntities();
         // Créer une entité en mouvement
         void CreateMovingEntity(const glm::vec3& position, const glm::vec3& velocity, const glm::vec4& color);
+        // Convertir une position écran (pixels) en coordonnées monde
+        glm::vec2 ScreenToWorld(float x, float y) const;
+        // Percentiles et historique des métriques du moteur
+        void DrawMetricsWindow();
 
         // Système ECS
         ECS::Registry m_Registry;
         std::shared_ptr<ECS::RenderSystem> m_RenderSystem;
         std::shared_ptr<ECS::MovementSystem> m_MovementSystem;
+        std::shared_ptr<ECS::CollisionSystem> m_CollisionSystem;
+        std::shared_ptr<ECS::SpatialIndexSystem> m_SpatialIndexSystem;
+
+        // Entité sélectionnée à la souris (via l'index spatial)
+        bool m_HasSelectedEntity = false;
+        ECS::EntityID m_SelectedEntity = 0;
 
         // Anciennes variables
         OrthographicCamera m_Camera;
+        // Actions de contrôle caméra (clavier + stick gauche/droit)
+        Input::ActionID m_MoveXAction = Input::InvalidAction;
+        Input::ActionID m_MoveYAction = Input::InvalidAction;
+        Input::ActionID m_RotateAction = Input::InvalidAction;
         glm::vec3 m_CameraPosition;
         glm::vec4 m_SquareColor;
 
@@ -50,6 +73,12 @@ namespace Tesseract {
 
         // Couleur de fond d'écran
         glm::vec4 m_BackgroundColor;
+
+        // Compteurs du cache d'état GL à la frame précédente (affichage par frame)
+        RendererAPI::StateStatistics m_LastStateStats;
+
+        // Fenêtre des métriques (percentiles, graphes de temps de frame)
+        bool m_ShowMetrics = true;
     };
 
 } // namespace Tesseract
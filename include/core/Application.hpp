@@ -4,43 +4,110 @@
 #include "core/Window.hpp"
 #include "core/LayerStack.hpp"
 #include "core/Event.hpp"
+#include "core/EventBus.hpp"
 #include "core/Events/ApplicationEvent.hpp"
 #include "core/ImGui/ImGuiLayer.hpp"
+#include "core/InputRecorder.hpp"
+#include "core/Timestep.hpp"
 
 #include <string>
+#include <vector>
 #include <memory>
 
 namespace Tesseract {
 
+    // Paramètres de création de l'application
+    struct ApplicationSpecification {
+        std::string Name = "Tesseract App";
+
+        // Simulation à pas fixe : fréquence des ticks (Hz) et nombre maximal
+        // de ticks rattrapés par frame (au-delà, le retard est abandonné)
+        uint32_t FixedTickRate = 60;
+        uint32_t MaxFixedStepsPerFrame = 5;
+
+        // Exécute les commandes GL sur un thread dédié (une frame de latence,
+        // viewports ImGui désactivés)
+        bool ThreadedRendering = false;
+
+        // Archives d'assets (.tpak) montées avant le chargement des shaders ;
+        // les fichiers absents de ces archives sont lus sur le disque
+        std::vector<std::string> AssetArchives;
+
+        // Cache disque des shaders compilés ("" = toujours recompiler)
+        std::string ShaderCacheDirectory = "cache/shaders";
+
+        // Profilage (TESSERACT_ENABLE_PROFILING) : une frame plus longue que ce
+        // seuil écrit une trace Chrome dans "profiles/" (0 = désactivé)
+        float ProfileSpikeThresholdMs = 0.0f;
+
+        // Sans fenêtre ni contexte GL (RendererAPI::API::Null) : simulation seule,
+        // pour les serveurs et les benchmarks CPU (ligne de commande : --headless)
+        bool Headless = false;
+        // Arrêt après ce nombre de frames (0 = illimité ; ligne de commande : --frames N)
+        uint32_t MaxFrames = 0;
+
+        // Enregistrement ou rejeu des entrées (benchmarks reproductibles) ;
+        // Off : selon la ligne de commande (--record, --replay)
+        InputRecordSettings InputRecording;
+    };
+
     class Application {
     public:
         Application(const std::string& name = "Tesseract App");
+        Application(const ApplicationSpecification& specification);
         virtual ~Application();
 
         void Run();
         void Close();
 
-        void OnEvent(Event& e);
-
         void PushLayer(Ref<Layer> layer);
         void PushOverlay(Ref<Layer> overlay);
 
+        // Indisponible en mode Headless
         inline Window& GetWindow() { return *m_Window; }
+        inline bool IsHeadless() const { return !m_Window; }
+        // Taille de la fenêtre, ou taille par défaut d'une fenêtre en mode Headless
+        inline uint32_t GetViewportWidth() const { return m_ViewportWidth; }
+        inline uint32_t GetViewportHeight() const { return m_ViewportHeight; }
+        // Événements de la fenêtre et des couches, distribués une fois par frame
+        inline EventBus& GetEventBus() { return m_EventBus; }
         inline static Application& Get() { return *s_Instance; }
 
+        inline const ApplicationSpecification& GetSpecification() const { return m_Specification; }
+
+        // Arguments du processus, appliqués à la spécification (--headless, --frames N)
+        static void SetCommandLineArgs(int argc, char** argv);
+
+        // Durée d'un tick de simulation
+        Timestep GetFixedTimestep() const { return 1.0f / (float)m_Specification.FixedTickRate; }
+        // Fraction du tick suivant déjà écoulée [0, 1) : interpolation du rendu entre deux états
+        float GetFixedUpdateAlpha() const { return m_FixedUpdateAlpha; }
+        // Nombre de ticks exécutés pendant la dernière frame
+        uint32_t GetFixedStepsLastFrame() const { return m_FixedStepsLastFrame; }
+
     private:
         // Méthodes de gestion d'événements internes
         bool OnWindowClose(WindowCloseEvent& e);
         bool OnWindowResize(WindowResizeEvent& e);
 
+        ApplicationSpecification m_Specification;
+        EventBus m_EventBus; // Construit avant la fenêtre et les couches qui s'y abonnent
         Scope<Window> m_Window;
         Ref<ImGuiLayer> m_ImGuiLayer;
         bool m_Running = true;
         bool m_Minimized = false;
+        uint32_t m_ViewportWidth = 0;
+        uint32_t m_ViewportHeight = 0;
         LayerStack m_LayerStack;
-        float m_LastFrameTime = 0.0f;
+
+        // Horloge haute résolution et accumulateur du pas fixe
+        uint64_t m_LastFrameCounter = 0;
+        double m_FixedAccumulator = 0.0;
+        float m_FixedUpdateAlpha = 0.0f;
+        uint32_t m_FixedStepsLastFrame = 0;
 
         static Application* s_Instance;
+        static std::vector<std::string> s_CommandLineArgs;
     };
 
     Application* CreateApplication();
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "core/Core.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Tesseract {
+
+    class AssetArchive;
+
+    /**
+     * @struct AssetData
+     * @brief Contenu d'un fichier d'asset
+     *
+     * Pour une entrée non compressée d'une archive, Data pointe directement dans
+     * le mapping (aucune copie) et Source garde l'archive ouverte. Sinon, les
+     * octets sont dans Storage (fichier lu ou entrée décompressée).
+     */
+    struct AssetData {
+        const uint8_t* Data = nullptr;
+        size_t Size = 0;
+        std::vector<uint8_t> Storage;
+        Ref<AssetArchive> Source;
+
+        AssetData() = default;
+        AssetData(AssetData&&) = default;            // Le tampon de Storage ne bouge pas
+        AssetData& operator=(AssetData&&) = default;
+        AssetData(const AssetData&) = delete;
+        AssetData& operator=(const AssetData&) = delete;
+
+        bool IsValid() const { return Data != nullptr; }
+        std::string ToString() const { return std::string(reinterpret_cast<const char*>(Data), Size); }
+    };
+
+    /**
+     * @class AssetArchive
+     * @brief Archive d'assets (.tpak) ouverte en mémoire mappée
+     *
+     * Format (petit-boutiste) :
+     * - en-tête : magic "TPAK", version, nombre d'entrées, décalage de la table ;
+     * - table des entrées triée par hash FNV-1a 64 bits du chemin normalisé
+     *   (recherche dichotomique, pas de chaîne stockée) ;
+     * - données alignées sur DataAlignment, éventuellement compressées en LZ4.
+     *
+     * Une seule ouverture de fichier pour tous les assets : une recherche revient
+     * à une dichotomie dans la table puis un pointeur dans le mapping.
+     * Les lectures sont sûres depuis plusieurs threads.
+     */
+    class AssetArchive : public std::enable_shared_from_this<AssetArchive> {
+    public:
+        static constexpr uint32_t Magic = 0x4B415054; // "TPAK"
+        static constexpr uint32_t Version = 1;
+        static constexpr uint64_t DataAlignment = 16;
+
+        enum EntryFlags : uint32_t {
+            EntryCompressedLZ4 = 1 << 0
+        };
+
+        struct Header {
+            uint32_t Magic;
+            uint32_t Version;
+            uint32_t EntryCount;
+            uint32_t Reserved;
+            uint64_t TableOffset;
+        };
+
+        struct Entry {
+            uint64_t PathHash;
+            uint64_t Offset;       // Depuis le début du fichier
+            uint64_t StoredSize;   // Taille dans l'archive
+            uint64_t OriginalSize; // Taille décompressée
+            uint32_t Flags;
+            uint32_t Reserved;
+        };
+
+        ~AssetArchive();
+
+        AssetArchive(const AssetArchive&) = delete;
+        AssetArchive& operator=(const AssetArchive&) = delete;
+
+        /**
+         * @brief Ouvre et mappe une archive
+         * @return nullptr si le fichier est absent ou invalide
+         */
+        static Ref<AssetArchive> Open(const std::string& filepath);
+
+        bool Contains(const std::string& path) const { return Find(path) != nullptr; }
+        const Entry* Find(const std::string& path) const;
+
+        /**
+         * @brief Lit une entrée (sans copie si elle n'est pas compressée)
+         * @return AssetData invalide si le chemin est absent ou la décompression échoue
+         */
+        AssetData Read(const std::string& path) const;
+
+        const std::string& GetPath() const { return m_Path; }
+        uint32_t GetEntryCount() const { return m_EntryCount; }
+
+        // Chemin relatif en séparateurs '/', sans "./" initial
+        static std::string NormalizePath(const std::string& path);
+        static uint64_t HashPath(const std::string& path);
+
+    private:
+        AssetArchive() = default;
+
+        std::string m_Path;
+        const uint8_t* m_Mapping = nullptr;
+        size_t m_MappingSize = 0;
+        const Entry* m_Entries = nullptr;
+        uint32_t m_EntryCount = 0;
+#ifdef _WIN32
+        void* m_FileHandle = nullptr;
+        void* m_MappingHandle = nullptr;
+#endif
+    };
+
+    /**
+     * @class AssetArchiveWriter
+     * @brief Construit une archive .tpak (outil AssetPacker, tests)
+     */
+    class AssetArchiveWriter {
+    public:
+        /**
+         * @param path Chemin sous lequel l'asset sera recherché à l'exécution
+         * @param compress Tente une compression LZ4 (conservée seulement si elle gagne au moins 10 %)
+         */
+        void AddData(const std::string& path, std::vector<uint8_t> data, bool compress = false);
+        bool AddFile(const std::string& path, const std::string& filepath, bool compress = false);
+
+        // Écrit l'archive ; échoue si deux chemins ont le même hash
+        bool Write(const std::string& filepath) const;
+
+        uint32_t GetEntryCount() const { return (uint32_t)m_Files.size(); }
+        uint64_t GetStoredBytes() const;
+        uint64_t GetOriginalBytes() const;
+
+        // Faux si le moteur est compilé sans LZ4 (TESSERACT_HAS_LZ4)
+        static bool IsCompressionAvailable();
+
+    private:
+        struct PendingFile {
+            std::string Path;
+            uint64_t Hash;
+            uint64_t OriginalSize;
+            uint32_t Flags;
+            std::vector<uint8_t> Data; // Données stockées (compressées ou non)
+        };
+
+        std::vector<PendingFile> m_Files;
+    };
+
+} // namespace Tesseract
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "core/Core.hpp"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Tesseract {
+
+    /**
+     * @struct AssetHandle
+     * @brief Identifiant typé de 32 bits d'une ressource de l'AssetManager
+     *
+     * L'ID combine l'indice de l'emplacement (20 bits) et sa génération (12 bits) :
+     * un handle vers une ressource libérée ou évincée est détecté au lieu de
+     * désigner la ressource qui a repris l'emplacement. L'ID 0 est invalide.
+     */
+    template<typename T>
+    struct AssetHandle {
+        static constexpr uint32_t IndexBits = 20;
+        static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+        static constexpr uint32_t GenerationMask = (1u << (32 - IndexBits)) - 1;
+
+        uint32_t ID = 0;
+
+        AssetHandle() = default;
+        explicit AssetHandle(uint32_t id) : ID(id) {}
+        AssetHandle(uint32_t index, uint32_t generation)
+            : ID((generation << IndexBits) | (index & IndexMask)) {}
+
+        uint32_t GetIndex() const { return ID & IndexMask; }
+        uint32_t GetGeneration() const { return ID >> IndexBits; }
+        bool IsValid() const { return ID != 0; }
+
+        bool operator==(const AssetHandle& other) const { return ID == other.ID; }
+        bool operator!=(const AssetHandle& other) const { return ID != other.ID; }
+    };
+
+    // Empreinte mémoire d'une ressource
+    struct AssetMemory {
+        size_t GPUBytes = 0;
+        size_t CPUBytes = 0;
+    };
+
+    // Bilan par type de ressource
+    struct AssetTypeStats {
+        uint32_t Count = 0;
+        uint32_t Referenced = 0; // Ressources utilisées hors de l'AssetManager
+        size_t GPUBytes = 0;
+        size_t CPUBytes = 0;
+    };
+
+    /**
+     * @class AssetStorage
+     * @brief Ressources d'un type, indexées par handle (accès direct) et par nom
+     *
+     * Une ressource est considérée référencée tant qu'une Ref existe hors du
+     * stockage (use_count > 1) : seules les ressources non référencées peuvent
+     * être évincées. LastUsedFrame est mis à jour à chaque accès pour l'éviction LRU.
+     */
+    template<typename T>
+    class AssetStorage {
+    public:
+        using Handle = AssetHandle<T>;
+
+        struct Entry {
+            Ref<T> Asset;
+            std::string Name;
+            uint32_t Generation = 1;
+            uint64_t LastUsedFrame = 0;
+        };
+
+        Handle Add(const std::string& name, const Ref<T>& asset, uint64_t frame) {
+            uint32_t index;
+            if (!m_FreeIndices.empty()) {
+                index = m_FreeIndices.back();
+                m_FreeIndices.pop_back();
+            } else {
+                index = (uint32_t)m_Entries.size();
+                m_Entries.emplace_back();
+            }
+
+            Entry& entry = m_Entries[index];
+            entry.Asset = asset;
+            entry.Name = name;
+            entry.LastUsedFrame = frame;
+            m_NameToIndex[name] = index;
+            return Handle(index, entry.Generation);
+        }
+
+        Handle Find(const std::string& name) const {
+            auto it = m_NameToIndex.find(name);
+            if (it == m_NameToIndex.end())
+                return {};
+            return Handle(it->second, m_Entries[it->second].Generation);
+        }
+
+        // nullptr si le handle est invalide ou périmé
+        Entry* GetEntry(Handle handle) {
+            uint32_t index = handle.GetIndex();
+            if (!handle.IsValid() || index >= m_Entries.size())
+                return nullptr;
+            Entry& entry = m_Entries[index];
+            if (!entry.Asset || entry.Generation != handle.GetGeneration())
+                return nullptr;
+            return &entry;
+        }
+
+        Ref<T> Get(Handle handle, uint64_t frame) {
+            Entry* entry = GetEntry(handle);
+            if (!entry)
+                return nullptr;
+            entry->LastUsedFrame = frame;
+            return entry->Asset;
+        }
+
+        bool Remove(Handle handle) {
+            Entry* entry = GetEntry(handle);
+            if (!entry)
+                return false;
+
+            m_NameToIndex.erase(entry->Name);
+            entry->Asset = nullptr;
+            entry->Name.clear();
+            // Génération suivante (jamais 0, pour que l'ID 0 reste invalide)
+            entry->Generation = (entry->Generation + 1) & Handle::GenerationMask;
+            if (entry->Generation == 0)
+                entry->Generation = 1;
+            m_FreeIndices.push_back(handle.GetIndex());
+            return true;
+        }
+
+        void Clear() {
+            for (uint32_t index = 0; index < m_Entries.size(); ++index) {
+                if (m_Entries[index].Asset)
+                    Remove(Handle(index, m_Entries[index].Generation));
+            }
+        }
+
+        uint32_t GetCount() const { return (uint32_t)m_NameToIndex.size(); }
+
+        // Parcourt les ressources présentes : func(handle, entry)
+        template<typename F>
+        void ForEach(F&& func) const {
+            for (uint32_t index = 0; index < m_Entries.size(); ++index) {
+                const Entry& entry = m_Entries[index];
+                if (entry.Asset)
+                    func(Handle(index, entry.Generation), entry);
+            }
+        }
+
+    private:
+        std::vector<Entry> m_Entries;
+        std::vector<uint32_t> m_FreeIndices;
+        std::unordered_map<std::string, uint32_t> m_NameToIndex;
+    };
+
+    class Texture2D;
+    class TextureAtlas;
+
+    using TextureHandle = AssetHandle<Texture2D>;
+    using TextureAtlasHandle = AssetHandle<TextureAtlas>;
+
+} // namespace Tesseract
@@ -2,6 +2,12 @@
 
 #include "core/Core.hpp"
 #include "core/Renderer/Texture.hpp"
+#include "core/Asset/AssetArchive.hpp"
+#include "core/Asset/AssetHandle.hpp"
+#include "core/Asset/TextureAtlas.hpp"
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <string>
 #include <memory>
@@ -15,6 +21,14 @@ namespace Tesseract {
      * Permet de charger, stocker et récupérer différents types de ressources
      * tels que des textures, fonts, etc. Gère le cache pour éviter les chargements
      * redondants.
+     *
+     * Chaque ressource est aussi accessible par un handle typé de 32 bits (accès
+     * direct, sans recherche de chaîne). La mémoire CPU/GPU est comptée par type ;
+     * au-delà du budget configuré, les ressources que plus personne ne référence
+     * sont évincées, de la moins récemment utilisée à la plus récente.
+     *
+     * Les fichiers sont lus en priorité dans les archives .tpak montées (voir
+     * AssetArchive), puis sur le disque.
      */
     class AssetManager {
     public:
@@ -34,6 +48,19 @@ namespace Tesseract {
          */
         Ref<Texture2D> LoadTexture(const std::string& filepath, const std::string& name = "");
 
+        /**
+         * @brief Lance le chargement d'une texture en arrière-plan
+         *
+         * Le handle est renvoyé immédiatement et mis en cache : tant que l'image n'est
+         * pas prête, IsLoaded() est faux et Renderer2D dessine la texture blanche à sa
+         * place. Le décodage se fait sur un worker du JobSystem, l'envoi au GPU dans
+         * Update() sous le budget de la frame.
+         * @param filepath Chemin du fichier texture
+         * @param name Nom optionnel pour référencer la texture (utilise le nom du fichier si non spécifié)
+         * @return Référence à la texture (en attente)
+         */
+        Ref<Texture2D> LoadTextureAsync(const std::string& filepath, const std::string& name = "");
+
         /**
          * @brief Récupère une texture déjà chargée par son nom
          * @param name Nom de la texture à récupérer
@@ -41,6 +68,18 @@ namespace Tesseract {
          */
         Ref<Texture2D> GetTexture(const std::string& name);
 
+        /**
+         * @brief Récupère une texture par son handle (marque la texture comme utilisée)
+         * @return Référence à la texture, ou nullptr si le handle est invalide ou la texture évincée
+         */
+        Ref<Texture2D> GetTexture(TextureHandle handle);
+
+        /**
+         * @brief Handle d'une texture chargée, à conserver pour les accès suivants
+         * @return Handle invalide si la texture n'existe pas
+         */
+        TextureHandle GetTextureHandle(const std::string& name) const;
+
         /**
          * @brief Vérifie si une texture existe dans le gestionnaire
          * @param name Nom de la texture à vérifier
@@ -60,6 +99,100 @@ namespace Tesseract {
          */
         std::vector<std::string> GetLoadedTextureNames() const;
 
+        // --- Gestion des atlas de textures ---
+
+        /**
+         * @brief Regroupe des images dans un atlas (régions nommées d'après les fichiers)
+         * @param name Nom de l'atlas
+         * @param filepaths Images à placer dans l'atlas
+         * @param cachePath Fichier de métadonnées de l'atlas pré-calculé (optionnel). S'il est
+         *        plus récent que toutes les images, l'atlas est relu sans placement ; sinon
+         *        il est reconstruit puis écrit à cet emplacement.
+         * @return Référence à l'atlas, ou nullptr si aucune image n'a pu être placée
+         */
+        Ref<TextureAtlas> LoadTextureAtlas(const std::string& name, const std::vector<std::string>& filepaths,
+                                           const std::string& cachePath = "");
+
+        /**
+         * @brief Récupère un atlas déjà chargé par son nom
+         * @return Référence à l'atlas, ou nullptr si non trouvé
+         */
+        Ref<TextureAtlas> GetTextureAtlas(const std::string& name);
+        Ref<TextureAtlas> GetTextureAtlas(TextureAtlasHandle handle);
+        TextureAtlasHandle GetTextureAtlasHandle(const std::string& name) const;
+
+        // --- Chargements asynchrones ---
+
+        struct UploadBudget {
+            float TimeMs = 2.0f;               // Temps maximal passé à envoyer des textures par frame
+            size_t Bytes = 16 * 1024 * 1024;   // Volume maximal de pixels envoyé par frame
+        };
+
+        struct AsyncStats {
+            uint32_t PendingCount = 0;      // Textures en cours de décodage ou en attente d'envoi
+            uint32_t UploadedLastFrame = 0;
+            float UploadMsLastFrame = 0.0f;
+        };
+
+        /**
+         * @brief Envoie au GPU les textures décodées, dans la limite du budget
+         *        (appelé par l'Application une fois par frame, thread principal)
+         *
+         * Au moins une texture est envoyée par frame pour garantir la progression.
+         */
+        void Update();
+
+        void SetUploadBudget(const UploadBudget& budget) { m_UploadBudget = budget; }
+        const UploadBudget& GetUploadBudget() const { return m_UploadBudget; }
+        AsyncStats GetAsyncStats() const { return m_AsyncStats; }
+
+        // --- Budget mémoire ---
+
+        struct MemoryBudget {
+            size_t GPUBytes = 0; // 0 = illimité
+            size_t CPUBytes = 0;
+        };
+
+        struct MemoryStats {
+            AssetTypeStats Textures;
+            AssetTypeStats Atlases;
+            uint32_t EvictedLastFrame = 0;
+
+            size_t GetGPUBytes() const { return Textures.GPUBytes + Atlases.GPUBytes; }
+            size_t GetCPUBytes() const { return Textures.CPUBytes + Atlases.CPUBytes; }
+        };
+
+        void SetMemoryBudget(const MemoryBudget& budget) { m_MemoryBudget = budget; }
+        const MemoryBudget& GetMemoryBudget() const { return m_MemoryBudget; }
+        // Bilan mis à jour par Update()
+        const MemoryStats& GetMemoryStats() const { return m_MemoryStats; }
+
+        /**
+         * @brief Recalcule la mémoire utilisée et évince des ressources non référencées
+         *        (LRU) tant que le budget est dépassé (appelé par Update())
+         * @return Nombre de ressources évincées
+         */
+        uint32_t EnforceMemoryBudget();
+
+        // --- Archives et lecture de fichiers ---
+
+        /**
+         * @brief Monte une archive .tpak : ses entrées masquent les fichiers de même chemin
+         *        (la dernière archive montée est prioritaire)
+         * @return false si l'archive est absente ou invalide
+         */
+        bool MountArchive(const std::string& filepath);
+        void UnmountArchive(const std::string& filepath);
+
+        /**
+         * @brief Lit un fichier d'asset depuis les archives montées, sinon depuis le disque
+         *
+         * Utilisable depuis n'importe quel thread (workers de décodage).
+         * @return AssetData invalide si le fichier est introuvable
+         */
+        AssetData ReadAsset(const std::string& filepath) const;
+        bool IsInArchive(const std::string& filepath) const;
+
         // --- Gestion générale ---
 
         /**
@@ -71,8 +204,32 @@ namespace Tesseract {
         AssetManager() = default;  // Constructeur privé (singleton)
         ~AssetManager();
 
-        // Cache de textures (nom -> texture)
-        std::unordered_map<std::string, Ref<Texture2D>> m_TextureCache;
+        // Caches de ressources (handle / nom -> ressource)
+        AssetStorage<Texture2D> m_Textures;
+        AssetStorage<TextureAtlas> m_Atlases;
+        // Numéro de frame (Update) : horodatage LRU des accès
+        uint64_t m_FrameIndex = 0;
+        MemoryBudget m_MemoryBudget;
+        MemoryStats m_MemoryStats;
+
+        // Archives montées (lues par les workers, d'où le verrou partagé)
+        mutable std::shared_mutex m_ArchivesMutex;
+        std::vector<Ref<AssetArchive>> m_Archives;
+
+        // Image décodée par un worker, en attente d'envoi au GPU
+        struct DecodedTexture {
+            Ref<Texture2D> Texture;
+            std::string Filepath;
+            Image Pixels;
+            float DecodeMs = 0.0f;
+        };
+
+        // Remplie par les workers, vidée par Update()
+        std::mutex m_DecodedMutex;
+        std::deque<DecodedTexture> m_DecodedTextures;
+        uint32_t m_PendingLoads = 0; // Thread principal uniquement
+        UploadBudget m_UploadBudget;
+        AsyncStats m_AsyncStats;
 
         // Extrait le nom du fichier à partir d'un chemin
         std::string ExtractNameFromFilePath(const std::string& filepath) const;
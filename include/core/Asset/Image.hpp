@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Tesseract {
+
+    // Format des pixels d'une Image
+    enum class ImageFormat : uint8_t {
+        Raw = 0, // 8 bits par canal, voir Image::Channels
+        BC1,     // Blocs 4x4 de 8 octets (RGB + alpha 1 bit)
+        BC3,     // Blocs 4x4 de 16 octets (RGBA)
+        BC7      // Blocs 4x4 de 16 octets (RGBA haute qualité)
+    };
+
+    // Niveau de mip d'une image compressée, stocké dans Image::Pixels
+    struct ImageLevel {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        size_t Offset = 0;
+        size_t Size = 0;
+    };
+
+    /**
+     * @struct Image
+     * @brief Image décodée en mémoire (pixels 8 bits, lignes de bas en haut comme OpenGL)
+     *
+     * Point d'entrée unique vers stb_image : le décodage ne touche pas au GPU et
+     * peut donc se faire sur n'importe quel thread.
+     *
+     * Les conteneurs DDS et KTX2 sont lus tels quels (blocs BCn et chaîne de mips
+     * pré-calculée, sans décompression). Ces formats stockent les lignes de haut en
+     * bas et les blocs ne se retournent pas : les textures doivent être exportées
+     * retournées (ex: toktx --lower_left_maps_to_s0t0, texconv -vflip).
+     */
+    struct Image {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        uint32_t Channels = 0;
+        ImageFormat Format = ImageFormat::Raw;
+        std::vector<uint8_t> Pixels;
+        // Niveaux de mip des images compressées (vide pour une image Raw : un seul niveau)
+        std::vector<ImageLevel> Levels;
+
+        bool IsValid() const { return !Pixels.empty(); }
+        bool IsCompressed() const { return Format != ImageFormat::Raw; }
+        size_t GetSize() const { return Pixels.size(); }
+
+        // Taille en octets d'un niveau compressé de width x height
+        static size_t GetCompressedSize(ImageFormat format, uint32_t width, uint32_t height);
+
+        /**
+         * @brief Décode un fichier image (PNG, JPG, TGA, BMP...) ou lit un conteneur
+         *        de texture compressée (.dds, .ktx2 ; desiredChannels est alors ignoré)
+         *        (archives montées dans l'AssetManager en priorité)
+         * @param filepath Chemin du fichier
+         * @param desiredChannels Nombre de canaux forcé (0 = celui du fichier)
+         * @return Image invalide (vide) en cas d'échec
+         */
+        static Image Load(const std::string& filepath, uint32_t desiredChannels = 0);
+
+        /**
+         * @brief Décode une image déjà en mémoire (entrée d'archive, fichier lu)
+         * @param name Nom du fichier : son extension choisit le décodeur (.dds, .ktx2, sinon stb_image)
+         */
+        static Image LoadFromMemory(const uint8_t* data, size_t size, const std::string& name, uint32_t desiredChannels = 0);
+
+        /**
+         * @brief Écrit l'image au format PNG (images Raw uniquement)
+         * @return true si l'écriture a réussi
+         */
+        bool WritePNG(const std::string& filepath) const;
+    };
+
+} // namespace Tesseract
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Tesseract {
+
+    /**
+     * @class SkylinePacker
+     * @brief Placement de rectangles dans une page (heuristique skyline bottom-left)
+     *
+     * La ligne d'horizon est une suite de segments (x, y, largeur) triés par x.
+     * Chaque rectangle est posé à l'endroit où son sommet est le plus bas (à
+     * égalité, le segment le plus étroit), ce qui garde des pages compactes pour
+     * des sprites de tailles variées. Coût O(segments) par insertion.
+     */
+    class SkylinePacker {
+    public:
+        SkylinePacker() = default;
+        SkylinePacker(uint32_t width, uint32_t height) { Reset(width, height); }
+
+        void Reset(uint32_t width, uint32_t height);
+
+        /**
+         * @brief Réserve un emplacement de width x height
+         * @param outX, outY Coin inférieur gauche de l'emplacement
+         * @return false si le rectangle ne tient plus dans la page
+         */
+        bool Insert(uint32_t width, uint32_t height, uint32_t& outX, uint32_t& outY);
+
+        uint32_t GetWidth() const { return m_Width; }
+        uint32_t GetHeight() const { return m_Height; }
+        // Surface occupée / surface de la page
+        float GetOccupancy() const;
+
+    private:
+        struct Segment {
+            uint32_t X;
+            uint32_t Y;
+            uint32_t Width;
+        };
+
+        // Hauteur de pose d'un rectangle démarrant au segment index, false s'il dépasse
+        bool Fit(size_t index, uint32_t width, uint32_t height, uint32_t& outY) const;
+        void AddLevel(size_t index, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+        uint32_t m_Width = 0;
+        uint32_t m_Height = 0;
+        uint64_t m_UsedArea = 0;
+        std::vector<Segment> m_Skyline;
+    };
+
+} // namespace Tesseract
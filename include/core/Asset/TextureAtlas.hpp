@@ -0,0 +1,104 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "core/Asset/AssetHandle.hpp"
+#include "core/Asset/Image.hpp"
+#include "core/Asset/SkylinePacker.hpp"
+#include "core/Renderer/SubTexture2D.hpp"
+#include "core/Renderer/Texture.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Tesseract {
+
+    /**
+     * @class TextureAtlas
+     * @brief Regroupe de nombreuses petites images dans quelques grandes pages
+     *
+     * Les images sont placées à l'exécution par un SkylinePacker ; quand une page
+     * est pleine, une nouvelle page est ajoutée. Chaque image devient une région
+     * accessible par son nom sous forme de SubTexture2D (page + rectangle UV) :
+     * des sprites partageant une page sont dessinés dans le même lot.
+     *
+     * Les pages sont gardées en mémoire (RGBA8) et envoyées au GPU à la demande.
+     * Save() écrit les pages (PNG) et les métadonnées des régions, Load() les
+     * relit sans refaire le placement (mode hors-ligne).
+     */
+    class TextureAtlas {
+    public:
+        struct Region {
+            uint32_t Page = 0;
+            uint32_t X = 0, Y = 0;          // Coin inférieur gauche dans la page, en pixels
+            uint32_t Width = 0, Height = 0;
+        };
+
+        static constexpr uint32_t DefaultPageSize = 2048;
+        static constexpr uint32_t DefaultPadding = 1;
+
+        /**
+         * @param pageSize Largeur et hauteur de chaque page
+         * @param padding Bordure (en pixels) autour de chaque région, remplie en
+         *        répétant les bords de l'image pour éviter les fuites du filtrage
+         */
+        explicit TextureAtlas(uint32_t pageSize = DefaultPageSize, uint32_t padding = DefaultPadding);
+
+        /**
+         * @brief Place une image dans l'atlas
+         * @param name Nom de la région (doit être unique)
+         * @return false si le nom existe déjà ou si l'image dépasse la taille d'une page
+         */
+        bool AddImage(const std::string& name, const Image& image);
+        bool AddImageFromFile(const std::string& name, const std::string& filepath);
+
+        bool HasRegion(const std::string& name) const;
+        const Region* GetRegion(const std::string& name) const;
+
+        /**
+         * @brief Région sous forme de texture + UV (envoie les pages modifiées au GPU)
+         * @return SubTexture2D invalide si la région n'existe pas
+         */
+        SubTexture2D GetSubTexture(const std::string& name);
+
+        // Crée ou met à jour les textures des pages modifiées depuis le dernier appel
+        void Upload();
+
+        uint32_t GetPageCount() const { return (uint32_t)m_Pages.size(); }
+        uint32_t GetPageSize() const { return m_PageSize; }
+        uint32_t GetRegionCount() const { return (uint32_t)m_Regions.size(); }
+        Ref<Texture2D> GetPageTexture(uint32_t page);
+        // Pages en mémoire (CPU) et textures des pages (GPU)
+        AssetMemory GetMemoryUsage() const;
+
+        /**
+         * @brief Écrit l'atlas sur disque : une image PNG par page, à côté du fichier de métadonnées
+         * @param metadataPath Chemin du fichier de métadonnées (ex: "assets/cache/sprites.atlas")
+         */
+        bool Save(const std::string& metadataPath) const;
+
+        /**
+         * @brief Relit un atlas écrit par Save()
+         * @return nullptr si le fichier est absent ou invalide
+         */
+        static Ref<TextureAtlas> Load(const std::string& metadataPath);
+
+    private:
+        struct Page {
+            Image Pixels;
+            SkylinePacker Packer;
+            Ref<Texture2D> Texture;
+            bool Dirty = true;
+            bool Sealed = false; // Page relue depuis le disque : plus de placement possible
+        };
+
+        Page& AddPage();
+        void Blit(Page& page, const Image& image, uint32_t x, uint32_t y);
+
+        uint32_t m_PageSize;
+        uint32_t m_Padding;
+        std::vector<Page> m_Pages;
+        std::unordered_map<std::string, Region> m_Regions;
+    };
+
+} // namespace Tesseract
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "core/Logger.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Niveau minimal compilé des macros TS_BLOG_* (0 trace ... 4 error). Indépendant
+// de TS_LOG_ACTIVE_LEVEL : le journal binaire est fait pour rester actif en production.
+#ifndef TS_BLOG_ACTIVE_LEVEL
+    #define TS_BLOG_ACTIVE_LEVEL 0
+#endif
+
+namespace Tesseract {
+
+    enum class BinaryLogMode {
+        Decode = 0, // Le thread de décodage formate et transmet aux sinks du logger noyau
+        File        // Les enregistrements bruts sont écrits tels quels (décodés par LogDecoder)
+    };
+
+    struct BinaryLogSettings {
+        BinaryLogMode Mode = BinaryLogMode::Decode;
+        // Tampon circulaire de chaque thread (arrondi à une puissance de deux)
+        uint32_t ThreadBufferSize = 1u << 20;
+        // Période de relève des tampons par le thread de décodage
+        uint32_t DecodeIntervalMs = 5;
+        std::string FilePath = "Tesseract.blog";
+    };
+
+    /**
+     * @class BinaryLog
+     * @brief Journal binaire à formatage différé
+     *
+     * Une instruction de journal n'enregistre que l'identifiant de son point
+     * d'appel (chaîne de format, fichier, ligne, niveau), un horodatage et les
+     * octets bruts de ses arguments, dans un tampon circulaire propre au thread
+     * appelant (un producteur, un consommateur : aucune opération atomique
+     * contestée). Le formatage a lieu plus tard, sur le thread de décodage ou
+     * hors ligne avec l'outil LogDecoder.
+     *
+     * Arguments acceptés : booléens, caractères, entiers, énumérations,
+     * flottants, chaînes (copiées) et pointeurs. Tampon plein : le message est
+     * perdu et compté, le thread appelant n'attend jamais.
+     */
+    class BinaryLog {
+    public:
+        // Point d'appel : une instance statique par macro, enregistrée au premier passage
+        struct Site {
+            const char* Format = nullptr;
+            const char* File = nullptr;
+            uint32_t Line = 0;
+            spdlog::level::level_enum Level = spdlog::level::info;
+        };
+
+        class SiteHandle {
+        public:
+            constexpr SiteHandle(spdlog::level::level_enum level, const char* file, uint32_t line)
+                : m_Level(level), m_File(file), m_Line(line) {}
+
+            uint32_t GetId(const char* format) {
+                uint32_t id = m_Id.load(std::memory_order_acquire);
+                if (id == 0) {
+                    id = RegisterSite({ format, m_File, m_Line, m_Level });
+                    m_Id.store(id, std::memory_order_release);
+                }
+                return id;
+            }
+
+        private:
+            std::atomic<uint32_t> m_Id{ 0 };
+            spdlog::level::level_enum m_Level;
+            const char* m_File;
+            uint32_t m_Line;
+        };
+
+        // Type de chaque argument, écrit avant sa valeur
+        enum class ArgType : uint8_t { Bool = 0, Char, Int, UInt, Double, String, Pointer };
+
+        // Enregistrement décodé (LogDecoder, ReadFile)
+        struct DecodedRecord {
+            Site CallSite;
+            uint64_t ThreadId = 0;
+            int64_t TimeNs = 0; // Depuis l'époque Unix
+            std::string Message;
+        };
+
+        static void Init(const BinaryLogSettings& settings = BinaryLogSettings());
+        // Décode les enregistrements restants puis arrête le thread de décodage
+        static void Shutdown();
+        // Attend que les enregistrements déjà écrits soient décodés (ou écrits sur disque)
+        static void Flush();
+
+        static void SetLevel(spdlog::level::level_enum level) { s_Level.store((int)level, std::memory_order_relaxed); }
+        static bool ShouldLog(spdlog::level::level_enum level) { return (int)level >= s_Level.load(std::memory_order_relaxed); }
+
+        // Messages perdus faute de place dans un tampon de thread
+        static uint64_t GetDroppedCount();
+
+        static uint32_t RegisterSite(const Site& site);
+
+        template<typename... Args>
+        static void Write(SiteHandle& handle, const char* format, const Args&... args) {
+            uint32_t site = handle.GetId(format);
+            uint32_t size = (0u + ... + EncodedSize(args));
+            uint8_t* out = Reserve(site, size);
+            if (!out)
+                return;
+            (Encode(out, args), ...);
+            Commit();
+        }
+
+        /**
+         * @brief Formate des arguments encodés avec leur chaîne de format
+         * @return Le message, ou la chaîne de format annotée si elle ne correspond pas
+         */
+        static std::string FormatArgs(const char* format, const uint8_t* args, size_t size);
+
+        /**
+         * @brief Décode un fichier écrit en mode BinaryLogMode::File
+         * @param callback Appelé pour chaque enregistrement, dans l'ordre du fichier
+         * @return false si le fichier est illisible ou tronqué
+         */
+        static bool ReadFile(const std::string& filepath, const std::function<void(const DecodedRecord&)>& callback);
+
+    private:
+        static uint8_t* Reserve(uint32_t site, uint32_t argsSize);
+        static void Commit();
+
+        template<typename T>
+        static constexpr bool IsString() {
+            return std::is_convertible_v<const T&, std::string_view> && !std::is_same_v<T, std::nullptr_t>;
+        }
+
+        template<typename T>
+        static std::string_view ToStringView(const T& value) {
+            if constexpr (std::is_pointer_v<T>) {
+                if (!value)
+                    return "(null)";
+            }
+            return std::string_view(value);
+        }
+
+        template<typename T>
+        static uint32_t EncodedSize([[maybe_unused]] const T& value) {
+            if constexpr (IsString<T>())
+                return 1 + sizeof(uint32_t) + (uint32_t)ToStringView(value).size();
+            else if constexpr (std::is_enum_v<T>)
+                return EncodedSize((std::underlying_type_t<T>)value);
+            else if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char>)
+                return 2;
+            else if constexpr (std::is_arithmetic_v<T> || std::is_pointer_v<T>)
+                return 1 + 8;
+            else
+                static_assert(sizeof(T) == 0, "BinaryLog: type d'argument non pris en charge (utiliser le logger texte)");
+        }
+
+        template<typename T>
+        static void Encode(uint8_t*& out, const T& value) {
+            if constexpr (IsString<T>()) {
+                std::string_view text = ToStringView(value);
+                uint32_t length = (uint32_t)text.size();
+                *out++ = (uint8_t)ArgType::String;
+                std::memcpy(out, &length, sizeof(length));
+                std::memcpy(out + sizeof(length), text.data(), length);
+                out += sizeof(length) + length;
+            } else if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char>) {
+                *out++ = (uint8_t)(std::is_same_v<T, bool> ? ArgType::Bool : ArgType::Char);
+                *out++ = (uint8_t)value;
+            } else if constexpr (std::is_enum_v<T>) {
+                Encode(out, (std::underlying_type_t<T>)value);
+            } else if constexpr (std::is_floating_point_v<T>) {
+                EncodeRaw(out, ArgType::Double, (double)value);
+            } else if constexpr (std::is_pointer_v<T>) {
+                EncodeRaw(out, ArgType::Pointer, (uint64_t)(uintptr_t)value);
+            } else if constexpr (std::is_signed_v<T>) {
+                EncodeRaw(out, ArgType::Int, (int64_t)value);
+            } else {
+                EncodeRaw(out, ArgType::UInt, (uint64_t)value);
+            }
+        }
+
+        template<typename T>
+        static void EncodeRaw(uint8_t*& out, ArgType type, T value) {
+            static_assert(sizeof(T) == 8);
+            *out++ = (uint8_t)type;
+            std::memcpy(out, &value, sizeof(value));
+            out += sizeof(value);
+        }
+
+        static std::atomic<int> s_Level;
+    };
+}
+
+// --- Macros du journal binaire (logger noyau) ---
+
+#define TS_BLOG_WRITE(level, ...)                                                                  \
+    do {                                                                                           \
+        if (::Tesseract::BinaryLog::ShouldLog(level)) {                                            \
+            static ::Tesseract::BinaryLog::SiteHandle tsBlogSite(level, __FILE__, __LINE__);       \
+            ::Tesseract::BinaryLog::Write(tsBlogSite, __VA_ARGS__);                                \
+        }                                                                                          \
+    } while (0)
+
+// Chaîne de format (syntaxe fmt, littérale) suivie des arguments
+#if TS_BLOG_ACTIVE_LEVEL <= 0
+    #define TS_BLOG_TRACE(...) TS_BLOG_WRITE(spdlog::level::trace, __VA_ARGS__)
+#else
+    #define TS_BLOG_TRACE(...) (void)0
+#endif
+#if TS_BLOG_ACTIVE_LEVEL <= 1
+    #define TS_BLOG_DEBUG(...) TS_BLOG_WRITE(spdlog::level::debug, __VA_ARGS__)
+#else
+    #define TS_BLOG_DEBUG(...) (void)0
+#endif
+#if TS_BLOG_ACTIVE_LEVEL <= 2
+    #define TS_BLOG_INFO(...) TS_BLOG_WRITE(spdlog::level::info, __VA_ARGS__)
+#else
+    #define TS_BLOG_INFO(...) (void)0
+#endif
+#if TS_BLOG_ACTIVE_LEVEL <= 3
+    #define TS_BLOG_WARN(...) TS_BLOG_WRITE(spdlog::level::warn, __VA_ARGS__)
+#else
+    #define TS_BLOG_WARN(...) (void)0
+#endif
+#define TS_BLOG_ERROR(...) TS_BLOG_WRITE(spdlog::level::err, __VA_ARGS__)
@@ -2,7 +2,7 @@
 
 #include "core/Core.hpp"
 #include <string>
-#include <functional>
+#include <ostream>
 
 namespace Tesseract {
     enum class EventType {
@@ -44,15 +44,15 @@ namespace Tesseract {
         }
     };
 
+    // Distribution immédiate d'un événement déjà construit (voir EventBus pour la file par frame)
     class EventDispatcher {
-        template<typename T>
-        using EventFn = std::function<bool(T&)>;
     public:
         EventDispatcher(Event& event)
             : m_Event(event) {}
 
-        template<typename T>
-        bool Dispatch(EventFn<T> func) {
+        // F : tout appelable bool(T&), appelé directement (pas de std::function)
+        template<typename T, typename F>
+        bool Dispatch(const F& func) {
             if (m_Event.GetEventType() == T::GetStaticType()) {
                 m_Event.Handled = func(*(T*)&m_Event);
                 return true;
@@ -0,0 +1,296 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "core/Event.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Tesseract {
+
+    /**
+     * @class EventBus
+     * @brief File d'événements typée, distribuée par lots une fois par frame
+     *
+     * Chaque type d'événement a son canal : les événements y sont stockés par
+     * valeur dans un tableau réutilisé d'une frame à l'autre (aucune allocation
+     * en régime établi), puis distribués ensemble à ses abonnés par
+     * EventBus::Dispatch. Un abonné est un couple (instance, fonction) appelé
+     * par un pointeur de fonction généré à la compilation : ni std::function ni
+     * appel virtuel par événement.
+     *
+     * Post est réservé au thread principal. Les autres threads utilisent
+     * PostAsync, qui dépose l'événement dans une file bornée sans verrou
+     * (multi-producteurs) vidée au début de la distribution suivante.
+     *
+     * L'ordre est conservé au sein d'un type, pas entre deux types différents.
+     * Un abonné qui renvoie true arrête la propagation (Event::Handled).
+     */
+    class EventBus {
+    public:
+        // Types d'événements distincts (tous bus confondus)
+        static constexpr uint32_t MaxEventTypes = 64;
+        // Événements en attente par type dans la file des autres threads
+        static constexpr uint32_t AsyncQueueCapacity = 1024;
+
+        // Priorités usuelles : les abonnés de priorité haute sont appelés d'abord
+        static constexpr int ApplicationPriority = 1000;
+        static constexpr int OverlayPriority = 100;
+        static constexpr int LayerPriority = 0;
+
+        struct Statistics {
+            uint64_t Dispatched = 0;
+            uint64_t AsyncDropped = 0; // File d'un type pleine
+        };
+
+        EventBus() = default;
+        ~EventBus();
+
+        EventBus(const EventBus&) = delete;
+        EventBus& operator=(const EventBus&) = delete;
+
+        /**
+         * @brief Abonne une méthode `bool C::Method(T&)` aux événements de type T
+         * @param instance Objet appelé ; le désabonner (Unsubscribe) avant sa destruction
+         */
+        template<auto Method, typename C>
+        void Subscribe(C* instance, int priority = LayerPriority) {
+            using T = typename MethodTraits<decltype(Method)>::EventType;
+            GetChannel<T>().AddHandler(instance, [](void* self, T& event) -> bool {
+                return (static_cast<C*>(self)->*Method)(event);
+            }, priority);
+        }
+
+        // Abonne une fonction libre `bool Function(T&)`
+        template<auto Function>
+        void Subscribe(int priority = LayerPriority) {
+            using T = typename FunctionTraits<decltype(Function)>::EventType;
+            GetChannel<T>().AddHandler(nullptr, [](void*, T& event) -> bool {
+                return Function(event);
+            }, priority);
+        }
+
+        // Retire tous les abonnements de l'instance (tous types confondus)
+        void Unsubscribe(const void* instance);
+
+        // Thread principal : l'événement est distribué au prochain Dispatch
+        template<typename T>
+        void Post(T&& event) {
+            GetChannel<std::decay_t<T>>().Push(std::forward<T>(event));
+        }
+
+        // N'importe quel thread ; false si la file de ce type est pleine (événement perdu)
+        template<typename T>
+        bool PostAsync(const T& event) {
+            return GetChannel<T>().PushAsync(event);
+        }
+
+        // Thread principal : distribue les événements en attente, type par type
+        void Dispatch();
+
+        Statistics GetStats() const;
+
+    private:
+        template<typename T>
+        struct MethodTraits;
+        template<typename C, typename T>
+        struct MethodTraits<bool (C::*)(T&)> { using EventType = T; };
+
+        template<typename T>
+        struct FunctionTraits;
+        template<typename T>
+        struct FunctionTraits<bool (*)(T&)> { using EventType = T; };
+
+        class ChannelBase {
+        public:
+            virtual ~ChannelBase() = default;
+            // Renvoie le nombre d'événements distribués
+            virtual uint32_t Dispatch() = 0;
+            virtual void RemoveHandlers(const void* instance) = 0;
+
+            std::atomic<uint64_t> AsyncDropped{ 0 };
+        };
+
+        template<typename T>
+        class Channel final : public ChannelBase {
+        public:
+            using HandlerFn = bool (*)(void*, T&);
+
+            Channel() : m_Cells(new Cell[AsyncQueueCapacity]) {
+                for (uint32_t i = 0; i < AsyncQueueCapacity; ++i)
+                    m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+            }
+
+            ~Channel() override {
+                while (Cell* cell = FrontAsync())
+                    PopAsync(*cell);
+            }
+
+            template<typename U>
+            void Push(U&& event) {
+                m_Queued.push_back(std::forward<U>(event));
+            }
+
+            bool PushAsync(const T& event) {
+                size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                while (true) {
+                    Cell& cell = m_Cells[pos & (AsyncQueueCapacity - 1)];
+                    size_t sequence = cell.Sequence.load(std::memory_order_acquire);
+                    intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+                    if (diff == 0) {
+                        if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            new (cell.Storage) T(event);
+                            cell.Sequence.store(pos + 1, std::memory_order_release);
+                            return true;
+                        }
+                    } else if (diff < 0) {
+                        AsyncDropped.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    } else {
+                        pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            void AddHandler(void* instance, HandlerFn invoke, int priority) {
+                Handler handler = { instance, invoke, priority };
+                if (m_InDispatch) {
+                    m_Added.push_back(handler); // Pris en compte à la fin de la distribution
+                    return;
+                }
+                Insert(handler);
+            }
+
+            void RemoveHandlers(const void* instance) override {
+                for (Handler& handler : m_Handlers) {
+                    if (handler.Instance == instance)
+                        handler.Invoke = nullptr;
+                }
+                m_Added.erase(std::remove_if(m_Added.begin(), m_Added.end(), [instance](const Handler& handler) {
+                    return handler.Instance == instance;
+                }), m_Added.end());
+                if (!m_InDispatch)
+                    Compact();
+            }
+
+            uint32_t Dispatch() override {
+                while (Cell* cell = FrontAsync()) {
+                    m_Queued.push_back(std::move(*cell->Get()));
+                    PopAsync(*cell);
+                }
+                if (m_Queued.empty())
+                    return 0;
+
+                // Les événements publiés pendant la distribution attendront la suivante
+                std::swap(m_Queued, m_Batch);
+                m_InDispatch = true;
+                for (T& event : m_Batch) {
+                    for (size_t i = 0; i < m_Handlers.size(); ++i) {
+                        const Handler& handler = m_Handlers[i];
+                        if (handler.Invoke && handler.Invoke(handler.Instance, event)) {
+                            if constexpr (std::is_base_of_v<Event, T>)
+                                event.Handled = true;
+                            break;
+                        }
+                    }
+                }
+                m_InDispatch = false;
+
+                uint32_t count = (uint32_t)m_Batch.size();
+                m_Batch.clear(); // La capacité est conservée
+                Compact();
+                for (const Handler& handler : m_Added)
+                    Insert(handler);
+                m_Added.clear();
+                return count;
+            }
+
+        private:
+            struct Handler {
+                void* Instance;
+                HandlerFn Invoke;
+                int Priority;
+            };
+
+            struct Cell {
+                std::atomic<size_t> Sequence{ 0 };
+                alignas(T) unsigned char Storage[sizeof(T)];
+
+                T* Get() { return std::launder(reinterpret_cast<T*>(Storage)); }
+            };
+
+            // Consommateur unique (thread principal)
+            Cell* FrontAsync() {
+                Cell& cell = m_Cells[m_DequeuePos & (AsyncQueueCapacity - 1)];
+                if (cell.Sequence.load(std::memory_order_acquire) != m_DequeuePos + 1)
+                    return nullptr;
+                return &cell;
+            }
+
+            void PopAsync(Cell& cell) {
+                cell.Get()->~T();
+                cell.Sequence.store(m_DequeuePos + AsyncQueueCapacity, std::memory_order_release);
+                m_DequeuePos++;
+            }
+
+            // Tri stable par priorité décroissante : à égalité, ordre d'abonnement
+            void Insert(const Handler& handler) {
+                auto it = std::find_if(m_Handlers.begin(), m_Handlers.end(), [&](const Handler& other) {
+                    return other.Priority < handler.Priority;
+                });
+                m_Handlers.insert(it, handler);
+            }
+
+            void Compact() {
+                m_Handlers.erase(std::remove_if(m_Handlers.begin(), m_Handlers.end(), [](const Handler& handler) {
+                    return handler.Invoke == nullptr;
+                }), m_Handlers.end());
+            }
+
+            std::vector<T> m_Queued;
+            std::vector<T> m_Batch;
+            std::vector<Handler> m_Handlers;
+            std::vector<Handler> m_Added;
+            bool m_InDispatch = false;
+
+            // File bornée de D. Vyukov (producteurs : PostAsync)
+            std::unique_ptr<Cell[]> m_Cells;
+            alignas(64) std::atomic<size_t> m_EnqueuePos{ 0 };
+            alignas(64) size_t m_DequeuePos = 0;
+        };
+
+        // Identifiant de type partagé par tous les bus, attribué au premier usage
+        static uint32_t NextTypeId();
+
+        template<typename T>
+        static uint32_t TypeId() {
+            static const uint32_t id = NextTypeId();
+            return id;
+        }
+
+        template<typename T>
+        Channel<T>& GetChannel() {
+            static_assert(std::is_copy_constructible_v<T>, "EventBus: les événements sont stockés par valeur");
+            uint32_t id = TypeId<T>();
+            ChannelBase* channel = m_Channels[id].load(std::memory_order_acquire);
+            if (!channel)
+                channel = CreateChannel(id, []() -> ChannelBase* { return new Channel<T>(); });
+            return *static_cast<Channel<T>*>(channel);
+        }
+
+        // Création sous verrou (un PostAsync peut créer le canal depuis un worker)
+        ChannelBase* CreateChannel(uint32_t id, ChannelBase* (*factory)());
+
+        std::atomic<ChannelBase*> m_Channels[MaxEventTypes] = {};
+        std::mutex m_CreateMutex;
+        uint64_t m_Dispatched = 0;
+    };
+
+} // namespace Tesseract
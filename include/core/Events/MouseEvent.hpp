@@ -50,28 +50,32 @@ namespace Tesseract {
     };
 
     // Classe de base pour les événements Bouton Souris
+    // (position du curseur au moment du clic, en pixels de la fenêtre)
     class MouseButtonEvent : public Event {
     public:
         inline int GetMouseButton() const { return m_Button; }
+        inline int GetX() const { return m_MouseX; }
+        inline int GetY() const { return m_MouseY; }
 
         EVENT_CLASS_CATEGORY(EventCategoryMouse | EventCategoryInput | EventCategoryMouseButton)
 
     protected:
-        MouseButtonEvent(int button)
-            : m_Button(button) {}
+        MouseButtonEvent(int button, int x, int y)
+            : m_Button(button), m_MouseX(x), m_MouseY(y) {}
 
         int m_Button;
+        int m_MouseX, m_MouseY;
     };
 
     // Événement Bouton Souris Pressé
     class MouseButtonPressedEvent : public MouseButtonEvent {
     public:
-        MouseButtonPressedEvent(int button)
-            : MouseButtonEvent(button) {}
+        MouseButtonPressedEvent(int button, int x, int y)
+            : MouseButtonEvent(button, x, y) {}
 
         std::string ToString() const override {
             std::stringstream ss;
-            ss << "MouseButtonPressedEvent: " << m_Button;
+            ss << "MouseButtonPressedEvent: " << m_Button << " (" << m_MouseX << ", " << m_MouseY << ")";
             return ss.str();
         }
 
@@ -81,12 +85,12 @@ namespace Tesseract {
     // Événement Bouton Souris Relâché
     class MouseButtonReleasedEvent : public MouseButtonEvent {
     public:
-        MouseButtonReleasedEvent(int button)
-            : MouseButtonEvent(button) {}
+        MouseButtonReleasedEvent(int button, int x, int y)
+            : MouseButtonEvent(button, x, y) {}
 
         std::string ToString() const override {
             std::stringstream ss;
-            ss << "MouseButtonReleasedEvent: " << m_Button;
+            ss << "MouseButtonReleasedEvent: " << m_Button << " (" << m_MouseX << ", " << m_MouseY << ")";
             return ss.str();
         }
 
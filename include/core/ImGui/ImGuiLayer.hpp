@@ -13,7 +13,6 @@ namespace Tesseract {
         void OnAttach() override;
         void OnDetach() override;
         // OnUpdate n'est pas nécessaire car le rendu ImGui est géré par Begin/End
-        void OnEvent(Event& event) override;
         void OnImGuiRender() override;
 
         // Méthodes spécifiques à ImGui
@@ -21,7 +20,13 @@ namespace Tesseract {
         void End();   // Termine une frame ImGui et la rend
 
     private:
+        // Abonné aux entrées souris/clavier : arrête leur propagation si ImGui les capture
+        template<typename T>
+        bool BlockIfCaptured(T& event);
+
         float m_Time = 0.0f; // Peut être utile pour certaines démos ImGui
+        // Objets GL du backend créés (premier ImGui_ImplOpenGL3_NewFrame terminé)
+        bool m_RendererBackendReady = false;
     };
 
 } // namespace Tesseract
@@ -1,27 +1,158 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
 #include <utility> // Pour std::pair
 
 namespace Tesseract {
 
-    // Classe statique pour gérer les entrées (clavier/souris)
+    class EventBus;
+    class MouseScrolledEvent;
+
+    /**
+     * @struct InputState
+     * @brief État brut des périphériques à un instant donné
+     *
+     * Structure compacte et trivialement copiable : touches et boutons sous
+     * forme de bits, positions et axes en clair. Les codes de touches sont les
+     * scancodes SDL (SDL_SCANCODE_*), les boutons de souris ceux de SDL
+     * (SDL_BUTTON_LEFT = 1...), ceux des manettes SDL_CONTROLLER_BUTTON_* et
+     * SDL_CONTROLLER_AXIS_*.
+     */
+    struct InputState {
+        static constexpr uint32_t KeyCount = 512; // SDL_NUM_SCANCODES
+        static constexpr uint32_t MaxGamepads = 4;
+        static constexpr uint32_t GamepadAxisCount = 6;
+
+        struct Gamepad {
+            uint32_t Buttons = 0;
+            float Axes[GamepadAxisCount] = {}; // Sticks [-1, 1], gâchettes [0, 1], zone morte appliquée
+            bool Connected = false;
+        };
+
+        uint64_t Keys[KeyCount / 64] = {};
+        uint32_t MouseButtons = 0; // Bit (button - 1)
+        int32_t MouseX = 0;
+        int32_t MouseY = 0;
+        float ScrollX = 0.0f; // Molette cumulée depuis l'état précédent
+        float ScrollY = 0.0f;
+        Gamepad Gamepads[MaxGamepads];
+
+        bool IsKeyDown(int scancode) const {
+            return (uint32_t)scancode < KeyCount && (Keys[scancode >> 6] >> (scancode & 63)) & 1;
+        }
+        void SetKey(int scancode) {
+            if ((uint32_t)scancode < KeyCount)
+                Keys[scancode >> 6] |= 1ull << (scancode & 63);
+        }
+        bool IsMouseButtonDown(int button) const {
+            return button >= 1 && button <= 32 && (MouseButtons >> (button - 1)) & 1;
+        }
+    };
+
+    // Source d'une action : touche, bouton ou axe, pondéré par Scale
+    struct InputBinding {
+        enum class Device : uint8_t {
+            Key = 0,       // Scancode SDL
+            MouseButton,   // SDL_BUTTON_*
+            GamepadButton, // SDL_CONTROLLER_BUTTON_* (n'importe quelle manette)
+            GamepadAxis    // SDL_CONTROLLER_AXIS_* (n'importe quelle manette)
+        };
+
+        Device Source = Device::Key;
+        uint16_t Code = 0;
+        float Scale = 1.0f; // -1 : la touche pousse l'action vers le négatif (axe gauche/droite)
+
+        static InputBinding Key(int scancode, float scale = 1.0f) { return { Device::Key, (uint16_t)scancode, scale }; }
+        static InputBinding MouseButton(int button, float scale = 1.0f) { return { Device::MouseButton, (uint16_t)button, scale }; }
+        static InputBinding GamepadButton(int button, float scale = 1.0f) { return { Device::GamepadButton, (uint16_t)button, scale }; }
+        static InputBinding GamepadAxis(int axis, float scale = 1.0f) { return { Device::GamepadAxis, (uint16_t)axis, scale }; }
+    };
+
+    /**
+     * @class Input
+     * @brief Instantané des entrées, capturé une fois par frame
+     *
+     * Input::Update relève l'état des périphériques (clavier, souris, manettes)
+     * sur le thread principal et le publie avec celui de la frame précédente,
+     * d'où les fronts WasPressed/WasReleased. Les requêtes ne font que lire cet
+     * instantané : aucun appel à SDL, et elles sont utilisables depuis les
+     * workers du JobSystem. Trois instantanés tournent : une lecture reste
+     * cohérente tant qu'elle ne chevauche pas deux Update consécutifs.
+     *
+     * Les actions nommées (« MoveX », « Fire »...) regroupent plusieurs
+     * sources ; leur valeur est la somme pondérée des sources, bornée à
+     * [-1, 1], et calculée lors de la capture.
+     */
     class Input {
     public:
+        using ActionID = uint32_t;
+        static constexpr ActionID InvalidAction = ~0u;
+        static constexpr uint32_t MaxActions = 64;
+        // |valeur| à partir de laquelle une action est considérée enfoncée
+        static constexpr float ActionPressThreshold = 0.5f;
+
         // Désactiver constructeur/destructeur (classe statique)
         Input() = delete;
 
-        // Vérifie si une touche spécifique est pressée
+        // Thread principal : la molette est lue sur le bus d'événements
+        static void Init(EventBus& bus);
+        static void Shutdown();
+
+        // Thread principal, une fois par frame après la lecture des événements SDL
+        static void Update();
+        // Publie un état fourni par l'appelant (rejeu, tests) à la place des périphériques
+        static void Update(const InputState& state);
+        // Relève l'état courant des périphériques (thread principal)
+        static InputState CaptureState();
+
+        // État publié par le dernier Update
+        static const InputState& GetState();
+        static uint64_t GetFrameIndex();
+
+        // Vérifie si une touche spécifique est enfoncée (scancode SDL)
         static bool IsKeyPressed(int keycode);
+        // Fronts : enfoncée / relâchée depuis la frame précédente
+        static bool WasKeyPressed(int keycode);
+        static bool WasKeyReleased(int keycode);
 
-        // Vérifie si un bouton de la souris est pressé
+        // Vérifie si un bouton de la souris est enfoncé
         static bool IsMouseButtonPressed(int button);
+        static bool WasMouseButtonPressed(int button);
+        static bool WasMouseButtonReleased(int button);
 
-        // Récupère la position actuelle de la souris
+        // Récupère la position de la souris lors de la capture
         static std::pair<int, int> GetMousePosition();
-
         // Raccourcis pour récupérer X et Y séparément
         static int GetMouseX();
         static int GetMouseY();
+        // Déplacement depuis la frame précédente
+        static std::pair<int, int> GetMouseDelta();
+        // Molette depuis la frame précédente
+        static std::pair<float, float> GetMouseScroll();
+
+        // Manettes (index 0 .. InputState::MaxGamepads - 1)
+        static bool IsGamepadConnected(uint32_t gamepad);
+        static bool IsGamepadButtonPressed(uint32_t gamepad, int button);
+        static bool WasGamepadButtonPressed(uint32_t gamepad, int button);
+        static bool WasGamepadButtonReleased(uint32_t gamepad, int button);
+        static float GetGamepadAxis(uint32_t gamepad, int axis);
+        // Zone morte des sticks, appliquée à la capture (0.15 par défaut)
+        static void SetGamepadDeadzone(float deadzone);
+
+        // Actions (thread principal) : l'identifiant est stable, à conserver plutôt que le nom
+        static ActionID RegisterAction(const std::string& name);
+        static ActionID FindAction(const std::string& name);
+        static void BindAction(ActionID action, const InputBinding& binding);
+        static void ClearBindings(ActionID action);
+
+        static bool IsActionPressed(ActionID action);
+        static bool WasActionPressed(ActionID action);
+        static bool WasActionReleased(ActionID action);
+        static float GetActionValue(ActionID action);
+
+    private:
+        static bool OnMouseScrolled(MouseScrolledEvent& event);
     };
 
 } // namespace Tesseract
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "core/Event.hpp"
+#include "core/Input.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Tesseract {
+
+    class EventBus;
+
+    enum class InputRecordMode {
+        Off = 0,
+        Record, // Session réelle écrite dans FilePath
+        Replay  // Session rejouée depuis FilePath, SDL ignoré
+    };
+
+    struct InputRecordSettings {
+        InputRecordMode Mode = InputRecordMode::Off;
+        std::string FilePath = "session.tinp";
+        // Rejeu : ferme l'application à la fin de l'enregistrement
+        bool CloseOnReplayEnd = true;
+        // Rejeu : métriques de la session écrites en JSON à la fin ("" = aucune)
+        std::string MetricsPath;
+    };
+
+    /**
+     * @struct RecordedEvent
+     * @brief Événement de la fenêtre sous forme compacte (13 octets sur disque)
+     *
+     * Window::OnUpdate traduit les événements SDL en RecordedEvent avant de
+     * les publier, ce qui permet de les enregistrer puis de les rejouer à
+     * l'identique. A, B, C : (largeur, hauteur), (touche, répétition),
+     * (x, y), (bouton, x, y) ; pour la molette, les bits des deux décalages.
+     */
+    struct RecordedEvent {
+        EventType Type = EventType::None;
+        int32_t A = 0;
+        int32_t B = 0;
+        int32_t C = 0;
+
+        static RecordedEvent WindowClose();
+        static RecordedEvent WindowResize(uint32_t width, uint32_t height);
+        static RecordedEvent KeyPressed(int keycode, int repeatCount);
+        static RecordedEvent KeyReleased(int keycode);
+        static RecordedEvent MouseMoved(int x, int y);
+        static RecordedEvent MouseScrolled(float xOffset, float yOffset);
+        static RecordedEvent MouseButtonPressed(int button, int x, int y);
+        static RecordedEvent MouseButtonReleased(int button, int x, int y);
+
+        // Reconstruit l'événement typé et le publie sur le bus
+        void Post(EventBus& bus) const;
+    };
+
+    /**
+     * @class InputRecorder
+     * @brief Enregistrement et rejeu déterministe des entrées
+     *
+     * Une session est une suite de frames : durée de la frame (qui détermine
+     * les ticks du pas fixe), événements de la fenêtre et instantané des
+     * entrées (InputState, écrit seulement s'il a changé). En rejeu, la durée
+     * enregistrée remplace l'horloge et ni les événements ni l'état des
+     * périphériques ne sont lus auprès de SDL : la simulation reçoit
+     * exactement les mêmes entrées à chaque exécution, ce qui permet de
+     * comparer deux versions du moteur sur le même scénario.
+     *
+     * Thread principal uniquement. Appelé par Application::Run et Window::OnUpdate.
+     */
+    class InputRecorder {
+    public:
+        InputRecorder() = delete;
+
+        static bool Start(const InputRecordSettings& settings, uint32_t fixedTickRate, uint32_t maxFixedSteps);
+        static void Stop();
+
+        static InputRecordMode GetMode();
+        static bool IsRecording() { return GetMode() == InputRecordMode::Record; }
+        static bool IsReplaying() { return GetMode() == InputRecordMode::Replay; }
+        static const InputRecordSettings& GetSettings();
+
+        // Réglages lus sur la ligne de commande (--record <fichier>, --replay <fichier>)
+        static void ParseCommandLine(int argc, char** argv);
+        static const InputRecordSettings& GetCommandLineSettings();
+
+        /**
+         * @brief Début de frame
+         * @param frameTime Durée mesurée ; remplacée par la durée enregistrée en rejeu
+         * @return false quand le rejeu est arrivé au bout de l'enregistrement
+         */
+        static bool BeginFrame(double& frameTime);
+        // Enregistrement : événement publié par la fenêtre pendant la frame
+        static void RecordEvent(const RecordedEvent& event);
+        // Rejeu : événements de la frame courante, à publier à la place de ceux de SDL
+        static const std::vector<RecordedEvent>& GetReplayedEvents();
+        // Rejeu : instantané des entrées de la frame courante
+        static const InputState& GetReplayedState();
+        // Fin de frame : écrit la frame (enregistrement)
+        static void EndFrame(const InputState& state);
+
+        static uint64_t GetFrameCount();
+    };
+
+} // namespace Tesseract
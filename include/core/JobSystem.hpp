@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace Tesseract {
+
+    /**
+     * @class JobSystem
+     * @brief Pool de threads de travail partagé par le moteur
+     *
+     * Les tâches sont des fonctions sans retour exécutées par les workers.
+     * ParallelFor découpe un intervalle en lots ; le thread appelant participe
+     * au travail puis attend la fin de tous les lots, ce qui permet aussi
+     * d'appeler ParallelFor depuis un worker sans blocage.
+     */
+    class JobSystem {
+    public:
+        /**
+         * @brief Démarre les workers
+         * @param workerCount Nombre de workers (0 = nombre de cœurs - 1)
+         */
+        static void Init(uint32_t workerCount = 0);
+        static void Shutdown();
+
+        static bool IsInitialized();
+        static uint32_t GetWorkerCount();
+
+        /**
+         * @brief Soumet une tâche exécutée de façon asynchrone par un worker
+         * @param job Tâche à exécuter (exécutée immédiatement si aucun worker)
+         */
+        static void Submit(std::function<void()> job);
+
+        /**
+         * @brief Exécute func(begin, end) en parallèle sur [0, count)
+         * @param count Nombre d'éléments
+         * @param grainSize Taille d'un lot (nombre d'éléments traités d'un bloc)
+         * @param func Fonction appelée pour chaque lot [begin, end)
+         *
+         * Le lot d'indice i couvre [i * grainSize, min((i + 1) * grainSize, count)),
+         * ce qui permet d'associer un tampon de sortie par lot (voir GetChunkCount).
+         */
+        static void ParallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t, uint32_t)>& func);
+
+        // Nombre de lots produits par ParallelFor pour ces paramètres
+        static uint32_t GetChunkCount(uint32_t count, uint32_t grainSize) {
+            if (grainSize == 0) grainSize = 1;
+            return (count + grainSize - 1) / grainSize;
+        }
+    };
+
+} // namespace Tesseract
@@ -2,7 +2,6 @@
 
 #include <string>
 #include "core/Core.hpp"
-#include "core/Event.hpp"
 #include "core/Timestep.hpp"
 
 namespace Tesseract {
@@ -14,8 +13,11 @@ namespace Tesseract {
         virtual void OnAttach() {}
         virtual void OnDetach() {}
         virtual void OnUpdate([[maybe_unused]] Timestep ts) {}
+        // Appelée à fréquence fixe (voir ApplicationSpecification::FixedTickRate)
+        virtual void OnFixedUpdate([[maybe_unused]] Timestep fixedTs) {}
         virtual void OnImGuiRender() {}
-        virtual void OnEvent([[maybe_unused]] Event& event) {}
+        // Événements : s'abonner dans OnAttach via Application::GetEventBus(), se
+        // désabonner dans OnDetach (EventBus::Unsubscribe(this))
 
         inline const std::string& GetName() const { return m_DebugName; }
 
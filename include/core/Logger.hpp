@@ -2,30 +2,69 @@
 
 #include <string>
 #include <memory>
+#include <cstdint>
 #include <spdlog/spdlog.h>
 #include <spdlog/fmt/ostr.h>
 
+// Niveau minimal compilé : 0 trace, 1 debug, 2 info, 3 warn, 4 error, 5 fatal.
+// Les appels en dessous disparaissent du binaire (arguments compris pour les macros).
+#ifndef TS_LOG_ACTIVE_LEVEL
+    #ifdef NDEBUG
+        #define TS_LOG_ACTIVE_LEVEL 2
+    #else
+        #define TS_LOG_ACTIVE_LEVEL 0
+    #endif
+#endif
+
 namespace Tesseract {
+
+    // Comportement quand la file de journalisation asynchrone est pleine
+    enum class LogOverflowPolicy {
+        Block = 0,  // Le thread appelant attend une place (aucune perte)
+        DropNewest  // Le message est abandonné et compté (les erreurs attendent toujours)
+    };
+
+    struct LoggerSettings {
+        // Écriture des sinks sur un thread dédié ; sinon synchrone et vidée à chaque message
+        bool Async = true;
+        // Messages en attente (arrondi à une puissance de deux)
+        uint32_t QueueCapacity = 8192;
+        LogOverflowPolicy Overflow = LogOverflowPolicy::DropNewest;
+        // Vidage périodique des fichiers ; les erreurs sont vidées immédiatement
+        uint32_t FlushIntervalMs = 1000;
+        // Fichier tronqué à l'ouverture ("" = console uniquement)
+        std::string FilePath = "Tesseract.log";
+    };
+
     class Logger {
     public:
-        static void Init();
+        static void Init(const LoggerSettings& settings = LoggerSettings());
+        // Écrit les messages en attente et arrête le thread d'écriture
+        static void Shutdown();
+        // Attend que les messages déjà journalisés soient écrits sur disque
+        static void Flush();
+        // Messages abandonnés par la politique DropNewest depuis Init
+        static uint64_t GetDroppedCount();
 
         static std::shared_ptr<spdlog::logger>& GetCoreLogger() { return s_CoreLogger; }
         static std::shared_ptr<spdlog::logger>& GetClientLogger() { return s_ClientLogger; }
 
         template<typename... Args>
-        static void Trace(const char* fmt, Args... args) {
-            GetCoreLogger()->trace(fmt, args...);
+        static void Trace([[maybe_unused]] const char* fmt, [[maybe_unused]] Args... args) {
+            if constexpr (TS_LOG_ACTIVE_LEVEL <= 0)
+                GetCoreLogger()->trace(fmt, args...);
         }
 
         template<typename... Args>
-        static void Info(const char* fmt, Args... args) {
-            GetCoreLogger()->info(fmt, args...);
+        static void Info([[maybe_unused]] const char* fmt, [[maybe_unused]] Args... args) {
+            if constexpr (TS_LOG_ACTIVE_LEVEL <= 2)
+                GetCoreLogger()->info(fmt, args...);
         }
 
         template<typename... Args>
-        static void Warn(const char* fmt, Args... args) {
-            GetCoreLogger()->warn(fmt, args...);
+        static void Warn([[maybe_unused]] const char* fmt, [[maybe_unused]] Args... args) {
+            if constexpr (TS_LOG_ACTIVE_LEVEL <= 3)
+                GetCoreLogger()->warn(fmt, args...);
         }
 
         template<typename... Args>
@@ -36,11 +75,13 @@ namespace Tesseract {
         template<typename... Args>
         static void Fatal(const char* fmt, Args... args) {
             GetCoreLogger()->critical(fmt, args...);
+            Flush(); // Généralement suivi d'un arrêt : le message doit atteindre le disque
         }
 
         template<typename... Args>
-        static void Debug(const char* fmt, Args... args) {
-            GetCoreLogger()->debug(fmt, args...);
+        static void Debug([[maybe_unused]] const char* fmt, [[maybe_unused]] Args... args) {
+            if constexpr (TS_LOG_ACTIVE_LEVEL <= 1)
+                GetCoreLogger()->debug(fmt, args...);
         }
 
     private:
@@ -51,18 +92,40 @@ namespace Tesseract {
 
 // --- Macros de Journalisation ---
 
+#if TS_LOG_ACTIVE_LEVEL <= 0
+    #define TS_LOG_IF_TRACE(call) call
+#else
+    #define TS_LOG_IF_TRACE(call) (void)0
+#endif
+#if TS_LOG_ACTIVE_LEVEL <= 1
+    #define TS_LOG_IF_DEBUG(call) call
+#else
+    #define TS_LOG_IF_DEBUG(call) (void)0
+#endif
+#if TS_LOG_ACTIVE_LEVEL <= 2
+    #define TS_LOG_IF_INFO(call) call
+#else
+    #define TS_LOG_IF_INFO(call) (void)0
+#endif
+#if TS_LOG_ACTIVE_LEVEL <= 3
+    #define TS_LOG_IF_WARN(call) call
+#else
+    #define TS_LOG_IF_WARN(call) (void)0
+#endif
+
 // Macros pour le Logger du Noyau (Core)
-#define TS_CORE_TRACE(...)    ::Tesseract::Logger::GetCoreLogger()->trace(__VA_ARGS__)
-#define TS_CORE_INFO(...)     ::Tesseract::Logger::GetCoreLogger()->info(__VA_ARGS__)
-#define TS_CORE_WARN(...)     ::Tesseract::Logger::GetCoreLogger()->warn(__VA_ARGS__)
+#define TS_CORE_TRACE(...)    TS_LOG_IF_TRACE(::Tesseract::Logger::GetCoreLogger()->trace(__VA_ARGS__))
+#define TS_CORE_INFO(...)     TS_LOG_IF_INFO(::Tesseract::Logger::GetCoreLogger()->info(__VA_ARGS__))
+#define TS_CORE_WARN(...)     TS_LOG_IF_WARN(::Tesseract::Logger::GetCoreLogger()->warn(__VA_ARGS__))
 #define TS_CORE_ERROR(...)    ::Tesseract::Logger::GetCoreLogger()->error(__VA_ARGS__)
-#define TS_CORE_FATAL(...)    ::Tesseract::Logger::GetCoreLogger()->critical(__VA_ARGS__)
-#define TS_CORE_DEBUG(...)    ::Tesseract::Logger::GetCoreLogger()->debug(__VA_ARGS__)
+// FATAL : vidé immédiatement comme Logger::Fatal (un arrêt suit généralement)
+#define TS_CORE_FATAL(...)    (::Tesseract::Logger::GetCoreLogger()->critical(__VA_ARGS__), ::Tesseract::Logger::Flush())
+#define TS_CORE_DEBUG(...)    TS_LOG_IF_DEBUG(::Tesseract::Logger::GetCoreLogger()->debug(__VA_ARGS__))
 
 // Macros pour le Logger du Client (Application)
-#define TS_TRACE(...)         ::Tesseract::Logger::GetClientLogger()->trace(__VA_ARGS__)
-#define TS_INFO(...)          ::Tesseract::Logger::GetClientLogger()->info(__VA_ARGS__)
-#define TS_WARN(...)          ::Tesseract::Logger::GetClientLogger()->warn(__VA_ARGS__)
+#define TS_TRACE(...)         TS_LOG_IF_TRACE(::Tesseract::Logger::GetClientLogger()->trace(__VA_ARGS__))
+#define TS_INFO(...)          TS_LOG_IF_INFO(::Tesseract::Logger::GetClientLogger()->info(__VA_ARGS__))
+#define TS_WARN(...)          TS_LOG_IF_WARN(::Tesseract::Logger::GetClientLogger()->warn(__VA_ARGS__))
 #define TS_ERROR(...)         ::Tesseract::Logger::GetClientLogger()->error(__VA_ARGS__)
-#define TS_FATAL(...)         ::Tesseract::Logger::GetClientLogger()->critical(__VA_ARGS__)
-#define TS_DEBUG(...)         ::Tesseract::Logger::GetClientLogger()->debug(__VA_ARGS__)
+#define TS_FATAL(...)         (::Tesseract::Logger::GetClientLogger()->critical(__VA_ARGS__), ::Tesseract::Logger::Flush())
+#define TS_DEBUG(...)         TS_LOG_IF_DEBUG(::Tesseract::Logger::GetClientLogger()->debug(__VA_ARGS__))
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Tesseract {
+
+    /**
+     * @class Metric
+     * @brief Mesure nommée échantillonnée une fois par frame
+     *
+     * L'enregistrement (Increment, Set, ScopedTimer) est une simple opération
+     * atomique relâchée, utilisable depuis n'importe quel thread. À la fin de
+     * chaque frame, Metrics::EndFrame relève la valeur dans un historique
+     * circulaire de Metrics::HistorySize frames, sur lequel sont calculés les
+     * percentiles : les moyennes masquent les à-coups, pas le p99.
+     */
+    class Metric {
+    public:
+        enum class Type {
+            Counter = 0, // Somme de la frame, remise à zéro à chaque échantillon
+            Gauge,       // Dernière valeur fixée (conservée d'une frame à l'autre)
+            Timer        // Durée cumulée de la frame, affichée en ms
+        };
+
+        struct Summary {
+            uint32_t Count = 0; // Échantillons dans l'historique
+            float Last = 0.0f;
+            float Min = 0.0f;
+            float Max = 0.0f;
+            float Mean = 0.0f;
+            float P50 = 0.0f;
+            float P95 = 0.0f;
+            float P99 = 0.0f;
+        };
+
+        // Mesure la durée d'un bloc et l'ajoute à un Timer
+        class ScopedTimer {
+        public:
+            explicit ScopedTimer(Metric& metric)
+                : m_Metric(metric), m_Start(std::chrono::steady_clock::now()) {}
+            ~ScopedTimer() {
+                auto elapsed = std::chrono::steady_clock::now() - m_Start;
+                m_Metric.Increment(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            }
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        private:
+            Metric& m_Metric;
+            std::chrono::steady_clock::time_point m_Start;
+        };
+
+        Metric(const std::string& name, Type type, const std::string& unit);
+
+        Metric(const Metric&) = delete;
+        Metric& operator=(const Metric&) = delete;
+
+        // Counter : unités ; Timer : nanosecondes
+        void Increment(int64_t value = 1) {
+            m_Accumulator.fetch_add(value, std::memory_order_relaxed);
+            m_Touched.store(true, std::memory_order_relaxed);
+        }
+
+        void Set(float value) {
+            m_Gauge.store(value, std::memory_order_relaxed);
+            m_Touched.store(true, std::memory_order_relaxed);
+        }
+
+        const std::string& GetName() const { return m_Name; }
+        const std::string& GetUnit() const { return m_Unit; }
+        Type GetType() const { return m_Type; }
+
+        // Historique (thread principal) : échantillons du plus ancien au plus récent
+        std::vector<float> GetHistory() const;
+        Summary GetSummary() const;
+
+    private:
+        friend class Metrics;
+        void Sample();
+
+        std::string m_Name;
+        std::string m_Unit;
+        Type m_Type;
+
+        std::atomic<int64_t> m_Accumulator{ 0 };
+        std::atomic<float> m_Gauge{ 0.0f };
+        // Aucun échantillon tant que la mesure n'a jamais été alimentée
+        std::atomic<bool> m_Touched{ false };
+
+        std::vector<float> m_History;
+        uint32_t m_Head = 0;
+        uint32_t m_Count = 0;
+    };
+
+    /**
+     * @class Metrics
+     * @brief Registre des mesures du moteur
+     *
+     * Les mesures sont créées à la première demande et ne sont jamais
+     * détruites : une référence peut être conservée dans une variable statique
+     * locale pour éviter la recherche par nom dans les chemins chauds.
+     */
+    class Metrics {
+    public:
+        // Nombre de frames conservées par mesure
+        static constexpr uint32_t HistorySize = 1024;
+
+        static Metric& GetCounter(const std::string& name, const std::string& unit = "");
+        static Metric& GetGauge(const std::string& name, const std::string& unit = "");
+        static Metric& GetTimer(const std::string& name);
+
+        // Relève toutes les mesures (thread principal, fin de frame)
+        static void EndFrame();
+
+        // Mesures dans l'ordre de création (pointeurs stables)
+        static std::vector<Metric*> GetAll();
+
+        /**
+         * @brief Exporte le résumé de chaque mesure (suivi des régressions)
+         * @param filepath Fichier de destination ; CSV : une ligne par mesure,
+         *        JSON : résumé et historique complet
+         * @return false si le fichier n'a pas pu être écrit
+         */
+        static bool WriteCSV(const std::string& filepath);
+        static bool WriteJSON(const std::string& filepath);
+    };
+
+} // namespace Tesseract
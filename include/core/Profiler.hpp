@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Activé par l'option CMake TESSERACT_ENABLE_PROFILING ; sinon les macros
+// TS_PROFILE_* ne génèrent aucun code
+#ifndef TS_ENABLE_PROFILING
+    #define TS_ENABLE_PROFILING 0
+#endif
+
+namespace Tesseract {
+
+    /**
+     * @class Profiler
+     * @brief Profileur CPU hiérarchique à zones nommées
+     *
+     * Chaque thread enregistre ses zones (nom, début, fin, profondeur) dans un
+     * anneau qui lui est propre : l'écriture ne prend qu'un verrou non contesté
+     * (sauf pendant un export). Les anneaux conservent les N dernières zones,
+     * ce qui permet de capturer une trace après coup, par exemple lors d'un pic
+     * de temps de frame. L'export produit le format JSON « Trace Event » lisible
+     * par chrome://tracing et Perfetto.
+     *
+     * Les noms de zones doivent être des chaînes à durée de vie statique
+     * (littéraux, __FUNCTION__) : seul le pointeur est conservé.
+     */
+    class Profiler {
+    public:
+        // Zones conservées par thread (les plus anciennes sont écrasées)
+        static constexpr uint32_t EventsPerThread = 1u << 16;
+
+        struct Event {
+            const char* Name = nullptr;
+            uint64_t StartNs = 0; // Depuis le démarrage du profileur
+            uint64_t EndNs = 0;
+            uint32_t Depth = 0;   // Imbrication dans le thread (0 = zone racine)
+        };
+
+        static constexpr bool IsCompiled() { return TS_ENABLE_PROFILING != 0; }
+
+        // Suspend ou reprend l'enregistrement (les zones en cours restent cohérentes)
+        static void SetEnabled(bool enabled);
+        static bool IsEnabled();
+
+        /**
+         * @brief Nomme le thread appelant dans les traces exportées
+         * @param name Nom affiché (copié)
+         */
+        static void SetThreadName(const std::string& name);
+
+        /**
+         * @brief Marque la fin d'une frame du thread principal
+         *
+         * Si un seuil de pic est défini et que la frame l'a dépassé, une trace
+         * des dernières zones enregistrées est écrite automatiquement.
+         */
+        static void MarkFrame();
+
+        /**
+         * @brief Active l'export automatique lors des pics de temps de frame
+         * @param thresholdMs Durée de frame déclenchant l'export (0 = désactivé)
+         * @param directory Dossier des traces (créé au besoin)
+         */
+        static void SetSpikeCapture(float thresholdMs, const std::string& directory = "profiles");
+
+        /**
+         * @brief Écrit les zones encore présentes dans les anneaux au format Chrome
+         * @param filepath Fichier .json de destination
+         * @return false si le fichier n'a pas pu être écrit
+         */
+        static bool WriteChromeTrace(const std::string& filepath);
+
+        // Horloge du profileur (ns monotones depuis le démarrage)
+        static uint64_t Now();
+
+        /**
+         * @brief Crée une piste d'événements qui n'appartient à aucun thread
+         *        (ex : zones GPU recalées sur l'horloge du profileur)
+         * @param name Nom de la piste dans les traces
+         * @return Identifiant à passer à RecordEvent
+         */
+        static uint32_t CreateTrack(const std::string& name);
+        static void RecordEvent(uint32_t track, const Event& event);
+
+        // Utilisés par ProfileScope
+        static uint32_t BeginZone();
+        static void EndZone(const char* name, uint64_t startNs, uint32_t depth);
+    };
+
+    // Zone RAII : mesurée de la construction à la destruction
+    class ProfileScope {
+    public:
+        explicit ProfileScope(const char* name)
+            : m_Name(name), m_Depth(Profiler::BeginZone()), m_Start(Profiler::Now()) {}
+        ~ProfileScope() { Profiler::EndZone(m_Name, m_Start, m_Depth); }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        const char* m_Name;
+        uint32_t m_Depth;
+        uint64_t m_Start;
+    };
+
+} // namespace Tesseract
+
+#define TS_PROFILE_CONCAT_IMPL(a, b) a##b
+#define TS_PROFILE_CONCAT(a, b) TS_PROFILE_CONCAT_IMPL(a, b)
+
+#if TS_ENABLE_PROFILING
+    #if defined(_MSC_VER)
+        #define TS_PROFILE_FUNCSIG __FUNCSIG__
+    #else
+        #define TS_PROFILE_FUNCSIG __PRETTY_FUNCTION__
+    #endif
+
+    #define TS_PROFILE_SCOPE(name) ::Tesseract::ProfileScope TS_PROFILE_CONCAT(ts_profileScope, __LINE__)(name)
+    #define TS_PROFILE_FUNCTION() TS_PROFILE_SCOPE(TS_PROFILE_FUNCSIG)
+    #define TS_PROFILE_THREAD(name) ::Tesseract::Profiler::SetThreadName(name)
+    #define TS_PROFILE_FRAME() ::Tesseract::Profiler::MarkFrame()
+#else
+    #define TS_PROFILE_SCOPE(name)
+    #define TS_PROFILE_FUNCTION()
+    #define TS_PROFILE_THREAD(name)
+    #define TS_PROFILE_FRAME()
+#endif
@@ -8,7 +8,9 @@ namespace Tesseract {
 
     // Énumération pour les types de données dans les shaders
     enum class ShaderDataType {
-        None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool
+        None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool,
+        // Types compacts pour les sommets (lus en float si Normalized, en entier sinon)
+        UByte, UByte4, Short2, Short3, Short4, UShort2, UShort4
     };
 
     // Fonction utilitaire pour obtenir la taille d'un type de ShaderDataType
@@ -25,6 +27,13 @@ namespace Tesseract {
             case ShaderDataType::Int3:     return 4 * 3;
             case ShaderDataType::Int4:     return 4 * 4;
             case ShaderDataType::Bool:     return 1;
+            case ShaderDataType::UByte:    return 1;
+            case ShaderDataType::UByte4:   return 1 * 4;
+            case ShaderDataType::Short2:   return 2 * 2;
+            case ShaderDataType::Short3:   return 2 * 3;
+            case ShaderDataType::Short4:   return 2 * 4;
+            case ShaderDataType::UShort2:  return 2 * 2;
+            case ShaderDataType::UShort4:  return 2 * 4;
             case ShaderDataType::None:     break; // Gérer explicitement ou laisser le default
         }
         // Message plus spécifique pour l'assertion
@@ -32,6 +41,26 @@ namespace Tesseract {
         return 0;
     }
 
+    // Types entiers : sans normalisation, l'attribut est lu tel quel (int/uint dans le shader)
+    inline bool ShaderDataTypeIsInteger(ShaderDataType type) {
+        switch (type) {
+            case ShaderDataType::Int:
+            case ShaderDataType::Int2:
+            case ShaderDataType::Int3:
+            case ShaderDataType::Int4:
+            case ShaderDataType::UByte:
+            case ShaderDataType::UByte4:
+            case ShaderDataType::Short2:
+            case ShaderDataType::Short3:
+            case ShaderDataType::Short4:
+            case ShaderDataType::UShort2:
+            case ShaderDataType::UShort4:
+                return true;
+            default:
+                return false;
+        }
+    }
+
     // Structure représentant un élément dans le layout d'un buffer
     struct BufferElement {
         std::string Name;
@@ -57,6 +86,13 @@ namespace Tesseract {
                 case ShaderDataType::Int3:    return 3;
                 case ShaderDataType::Int4:    return 4;
                 case ShaderDataType::Bool:    return 1;
+                case ShaderDataType::UByte:   return 1;
+                case ShaderDataType::UByte4:  return 4;
+                case ShaderDataType::Short2:  return 2;
+                case ShaderDataType::Short3:  return 3;
+                case ShaderDataType::Short4:  return 4;
+                case ShaderDataType::UShort2: return 2;
+                case ShaderDataType::UShort4: return 4;
                 case ShaderDataType::None:    break; // Gérer explicitement ou laisser le default
             }
             TS_ASSERT(false, "Unknown ShaderDataType! Type: {}", (int)Type);
@@ -89,6 +125,7 @@ namespace Tesseract {
 
     private:
         // Calcule les offsets de chaque élément et la taille totale (stride)
+        // Le stride est arrondi à 4 octets (alignement attendu des sommets par les GPU)
         void CalculateOffsetsAndStride() {
             size_t offset = 0;
             m_Stride = 0;
@@ -97,6 +134,7 @@ namespace Tesseract {
                 offset += element.Size;
                 m_Stride += element.Size;
             }
+            m_Stride = (m_Stride + 3) & ~3u;
         }
 
         std::vector<BufferElement> m_Elements;
@@ -135,4 +173,19 @@ namespace Tesseract {
         static Ref<IndexBuffer> Create(uint32_t* indices, uint32_t count);
     };
 
+    // --- Interface UniformBuffer ---
+    // Bloc d'uniforms (disposition std140) partagé par tous les shaders via un point de liaison fixe
+    class UniformBuffer {
+    public:
+        virtual ~UniformBuffer() = default;
+
+        // Copie les données (l'appelant peut réutiliser son tampon immédiatement)
+        virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+        virtual uint32_t GetBinding() const = 0;
+
+        // Factory : le buffer reste lié au point de liaison binding
+        static Ref<UniformBuffer> Create(uint32_t size, uint32_t binding);
+    };
+
 } // namespace Tesseract
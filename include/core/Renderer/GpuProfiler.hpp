@@ -0,0 +1,87 @@
+#pragma once
+
+#include "core/Profiler.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Tesseract {
+
+    /**
+     * @class GpuProfiler
+     * @brief Chronométrage GPU des passes de rendu par requêtes de timestamp
+     *
+     * Les zones sont ouvertes/fermées depuis le thread principal, dans l'ordre
+     * des commandes de rendu ; les requêtes sont émises sur le thread de rendu.
+     * Les résultats d'une frame sont lus plusieurs frames plus tard
+     * (FramesInFlight), uniquement s'ils sont disponibles : la lecture ne bloque
+     * jamais le pipeline, une frame encore en vol au moment de réutiliser ses
+     * requêtes est simplement abandonnée.
+     *
+     * Avec TESSERACT_ENABLE_PROFILING, les zones résolues sont aussi ajoutées
+     * à la trace CPU (piste « GPU »), recalées sur l'horloge du profileur.
+     */
+    class GpuProfiler {
+    public:
+        static constexpr uint32_t FramesInFlight = 4;
+        // Au-delà, les zones de la frame sont ignorées (2 requêtes par zone)
+        static constexpr uint32_t MaxZonesPerFrame = 256;
+
+        struct Zone {
+            const char* Name = nullptr;
+            float StartMs = 0.0f;    // Depuis le début de la frame GPU
+            float DurationMs = 0.0f;
+            uint32_t Depth = 0;      // 0 = frame entière
+        };
+
+        struct FrameTimings {
+            uint64_t FrameIndex = 0;
+            float GpuMs = 0.0f;       // Du début à la fin de la frame sur le GPU
+            std::vector<Zone> Zones;  // Dans l'ordre d'ouverture, la frame en premier
+        };
+
+        struct Statistics {
+            uint64_t ResolvedFrames = 0;
+            uint64_t DroppedFrames = 0;  // Résultats pas encore prêts à la réutilisation
+            uint64_t OverflowZones = 0;  // Zones au-delà de MaxZonesPerFrame
+        };
+
+        // Après RenderCommand::Init (contexte courant)
+        static void Init();
+        static void Shutdown();
+
+        // Faux si l'API ne fournit pas de requêtes de timestamp
+        static bool IsSupported();
+        // Pris en compte à la frame suivante
+        static void SetEnabled(bool enabled);
+        static bool IsEnabled();
+
+        static void BeginFrame();
+        static void EndFrame();
+
+        /**
+         * @brief Ouvre une zone GPU (imbrication libre)
+         * @param name Chaîne à durée de vie statique
+         */
+        static void BeginZone(const char* name);
+        static void EndZone();
+
+        // Dernière frame résolue ; lisible depuis n'importe quel thread
+        static FrameTimings GetLastFrame();
+        static Statistics GetStats();
+    };
+
+    // Zone GPU RAII
+    class GpuProfileScope {
+    public:
+        explicit GpuProfileScope(const char* name) { GpuProfiler::BeginZone(name); }
+        ~GpuProfileScope() { GpuProfiler::EndZone(); }
+
+        GpuProfileScope(const GpuProfileScope&) = delete;
+        GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+    };
+
+} // namespace Tesseract
+
+// Toujours compilé : alimente aussi la fenêtre de statistiques (coût : deux requêtes par zone)
+#define TS_PROFILE_GPU(name) ::Tesseract::GpuProfileScope TS_PROFILE_CONCAT(ts_gpuProfileScope, __LINE__)(name)
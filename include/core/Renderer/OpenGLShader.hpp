@@ -4,6 +4,8 @@
 #include <glm/glm.hpp>
 #include <unordered_map> // Pour le cache d'uniforms
 #include <string> // Pour std::string
+#include <vector>
+#include <chrono>
 #include <GL/glew.h> // Ajout de l'include pour les types GL (GLint, GLenum)
 
 typedef unsigned int GLenum; // Peut être redondant avec glew.h mais ne nuit pas
@@ -12,7 +14,11 @@ namespace Tesseract {
 
     class OpenGLShader : public Shader {
     public:
-        OpenGLShader(const std::string& filepath);
+        /**
+         * @param filepath Fichier contenant les étages (#type vertex/fragment)
+         * @param defines Mots-clés de la variante, injectés en "#define MOT 1" après #version
+         */
+        OpenGLShader(const std::string& filepath, const std::vector<std::string>& defines = {});
         OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
         ~OpenGLShader() override;
 
@@ -21,6 +27,7 @@ namespace Tesseract {
 
         // Implémentation des SetUniform
         void SetInt(const std::string& name, int value) override;
+        void SetIntArray(const std::string& name, const int* values, uint32_t count) override;
         void SetFloat(const std::string& name, float value) override;
         void SetFloat2(const std::string& name, const glm::vec2& value) override;
         void SetFloat3(const std::string& name, const glm::vec3& value) override;
@@ -43,15 +50,45 @@ namespace Tesseract {
         void UploadUniformMat4(const std::string& name, const glm::mat4& matrix);
 
     private:
+        // État GL du programme, partagé avec les commandes du thread de rendu
+        struct ProgramState {
+            uint32_t RendererID = 0;
+            std::string Name; // Pour les messages d'erreur
+            std::unordered_map<std::string, GLint> UniformLocationCache;
+
+            // Compilation lancée mais pas encore vérifiée (GL_KHR_parallel_shader_compile)
+            bool Pending = false;
+            std::vector<std::pair<GLenum, GLuint>> Stages;
+            uint64_t CacheKey = 0;
+            std::string Filepath;
+            std::chrono::steady_clock::time_point CompileStart;
+        };
+
         std::string ReadFile(const std::string& filepath);
+        // Remplace récursivement les lignes #include "fichier" (chemin relatif au fichier courant)
+        std::string ResolveIncludes(const std::string& source, const std::string& filepath,
+                                    std::vector<std::string>& included, uint32_t depth = 0);
         std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
-        void Compile(const std::unordered_map<GLenum, std::string>& shaderSources);
-        GLint GetUniformLocation(const std::string& name) const;
+        static void InjectDefines(std::string& source, const std::vector<std::string>& defines);
+
+        /**
+         * @brief Lance la compilation et l'édition de liens (thread de rendu)
+         *
+         * Si le driver compile en parallèle, les statuts ne sont pas lus ici (ce qui
+         * bloquerait) : FinishCompile() le fait au premier usage du programme.
+         */
+        static void BeginCompile(ProgramState& program, const std::unordered_map<GLenum, std::string>& shaderSources);
+        // Vérifie compilation et liens, enregistre le binaire ; RendererID vaut 0 en cas d'échec
+        static void FinishCompile(ProgramState& program);
+        // Emplacements des uniforms et points de liaison des blocs partagés (après le link)
+        static void Reflect(ProgramState& program);
+        // Identifiant GL utilisable (termine la compilation si nécessaire)
+        static GLuint Resolve(ProgramState& program);
+        static GLint GetUniformLocation(ProgramState& program, const std::string& name);
 
         std::string m_FilePath;
         std::string m_Name;
-        uint32_t m_RendererID;
-        mutable std::unordered_map<std::string, int> m_UniformLocationCache;
+        Ref<ProgramState> m_Program;
     };
 
 } // namespace Tesseract
@@ -1,31 +1,49 @@
 #pragma once
 
 #include "core/Renderer/RendererAPI.hpp"
+#include "core/Renderer/RenderThread.hpp"
 
 namespace Tesseract {
 
     class RenderCommand {
     public:
         // Pas besoin de constructeur/destructeur pour une classe purement statique
+        // Chaque commande passe par le RenderThread (exécution immédiate s'il n'est pas démarré)
 
         inline static void Init() {
-            s_RendererAPI->Init();
+            s_RendererAPI = RendererAPI::Create();
+            RenderThread::Submit([]() { s_RendererAPI->Init(); });
+        }
+
+        inline static void Shutdown() {
+            RenderThread::Submit([]() { s_RendererAPI->Shutdown(); });
         }
 
         inline static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
-            s_RendererAPI->SetViewport(x, y, width, height);
+            RenderThread::Submit([=]() { s_RendererAPI->SetViewport(x, y, width, height); });
         }
 
         inline static void SetClearColor(const glm::vec4& color) {
-            s_RendererAPI->SetClearColor(color);
+            RenderThread::Submit([color]() { s_RendererAPI->SetClearColor(color); });
         }
 
         inline static void Clear() {
-            s_RendererAPI->Clear();
+            RenderThread::Submit([]() { s_RendererAPI->Clear(); });
         }
 
         inline static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) {
-            s_RendererAPI->DrawIndexed(vertexArray, indexCount);
+            // Nombre d'indices résolu ici : l'IBO du VAO peut changer avant l'exécution
+            uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+            RenderThread::Submit([vertexArray, count]() { s_RendererAPI->DrawIndexed(vertexArray, count); });
+        }
+
+        // À appeler après du code qui modifie l'état GL sans passer par le moteur (ImGui)
+        inline static void InvalidateState() {
+            RenderThread::Submit([]() { s_RendererAPI->InvalidateState(); });
+        }
+
+        inline static RendererAPI::StateStatistics GetStateStatistics() {
+            return s_RendererAPI->GetStateStatistics();
         }
 
         // Permet d'accéder à l'instance de l'API si nécessaire (rarement utile à l'extérieur)
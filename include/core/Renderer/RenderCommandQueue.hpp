@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Tesseract {
+
+    /**
+     * @class RenderCommandQueue
+     * @brief File de commandes de rendu enregistrées par le thread principal
+     *
+     * Chaque commande est un foncteur (lambda) copié dans une mémoire par blocs,
+     * accompagné d'un trampoline qui l'exécute puis le détruit. Aucune allocation
+     * par commande une fois les blocs créés : la mémoire est réutilisée d'une
+     * frame à l'autre. Les données brutes (sommets, pixels) peuvent aussi être
+     * copiées dans la file et restent valides jusqu'à l'exécution.
+     */
+    class RenderCommandQueue {
+    public:
+        static constexpr size_t DefaultBlockSize = 1024 * 1024;
+
+        explicit RenderCommandQueue(size_t blockSize = DefaultBlockSize);
+        ~RenderCommandQueue();
+
+        RenderCommandQueue(const RenderCommandQueue&) = delete;
+        RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+        /**
+         * @brief Enregistre une commande
+         * @param func Foncteur sans argument, capturant ses données par valeur
+         */
+        template<typename F>
+        void Submit(F&& func) {
+            using Command = std::decay_t<F>;
+            auto execute = [](void* payload) {
+                Command* command = static_cast<Command*>(payload);
+                (*command)();
+                command->~Command();
+            };
+            void* payload = Allocate(sizeof(Command), alignof(Command));
+            new (payload) Command(std::forward<F>(func));
+            m_Commands.push_back({ execute, payload });
+        }
+
+        /**
+         * @brief Copie des données brutes dans la file
+         * @return Pointeur valide jusqu'à la fin de Execute()
+         */
+        void* SubmitData(const void* data, size_t size);
+
+        // Exécute toutes les commandes dans l'ordre d'enregistrement puis vide la file
+        void Execute();
+
+        uint32_t GetCommandCount() const { return (uint32_t)m_Commands.size(); }
+        // Octets utilisés par les commandes et données de la frame
+        size_t GetUsedBytes() const;
+
+    private:
+        using CommandFn = void(*)(void*);
+
+        struct CommandHeader {
+            CommandFn Execute;
+            void* Payload;
+        };
+
+        struct Block {
+            std::unique_ptr<uint8_t[]> Data;
+            size_t Size = 0;
+            size_t Used = 0;
+        };
+
+        void* Allocate(size_t size, size_t alignment);
+
+        size_t m_BlockSize;
+        std::vector<Block> m_Blocks;
+        size_t m_CurrentBlock = 0;
+        std::vector<CommandHeader> m_Commands;
+    };
+
+} // namespace Tesseract
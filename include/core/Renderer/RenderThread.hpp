@@ -0,0 +1,87 @@
+#pragma once
+
+#include "core/Renderer/RenderCommandQueue.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Tesseract {
+
+    class Window;
+
+    /**
+     * @class RenderThread
+     * @brief Thread de rendu propriétaire du contexte OpenGL
+     *
+     * Le thread principal enregistre les commandes GL de la frame N dans une
+     * file pendant que le thread de rendu exécute celles de la frame N-1
+     * (double tampon de files). Le temps CPU d'une frame devient ainsi
+     * max(mise à jour, soumission GL) au lieu de leur somme, au prix d'une
+     * frame de latence.
+     *
+     * Tant que le thread n'est pas démarré (ou si le mode threadé est désactivé),
+     * Submit() exécute immédiatement la commande sur le thread appelant : le
+     * comportement est alors identique à des appels GL directs.
+     */
+    class RenderThread {
+    public:
+        struct Statistics {
+            float MainThreadWaitMs = 0.0f; // Attente du thread principal en fin de frame
+            float ExecuteMs = 0.0f;        // Exécution de la dernière file par le thread de rendu
+            uint32_t CommandCount = 0;     // Commandes de la dernière frame soumise
+            size_t QueueBytes = 0;         // Mémoire utilisée par la dernière frame soumise
+        };
+
+        /**
+         * @brief Démarre le thread de rendu et lui transfère le contexte GL de la fenêtre
+         * @param window Fenêtre dont le contexte est courant sur le thread appelant
+         */
+        static void Start(Window& window);
+
+        /**
+         * @brief Exécute les commandes en attente, arrête le thread et rend le contexte
+         *        au thread appelant
+         */
+        static void Stop();
+
+        static bool IsRunning();
+        // Vrai sur le thread de rendu, ou sur tout thread si celui-ci n'est pas démarré
+        static bool IsRenderThread();
+
+        /**
+         * @brief Enregistre une commande de rendu
+         * @param func Foncteur capturant ses données par valeur (jamais de pointeur vers
+         *             des données du thread principal qui pourraient changer avant l'exécution)
+         */
+        template<typename F>
+        static void Submit(F&& func) {
+            if (!IsRunning() || IsRenderThread()) {
+                func();
+                return;
+            }
+            GetSubmitQueue().Submit(std::forward<F>(func));
+        }
+
+        /**
+         * @brief Copie des données pour une commande ultérieure
+         * @return Pointeur à capturer dans la commande ; sans thread de rendu,
+         *         les données d'origine sont renvoyées telles quelles
+         */
+        static const void* SubmitData(const void* data, size_t size);
+
+        /**
+         * @brief Fin de frame côté principal : attend que le thread de rendu ait
+         *        terminé la frame précédente puis lui confie la frame courante
+         */
+        static void EndFrame();
+
+        // Attend que toutes les commandes déjà soumises aient été exécutées
+        static void WaitIdle();
+
+        static Statistics GetStats();
+
+    private:
+        static RenderCommandQueue& GetSubmitQueue();
+    };
+
+} // namespace Tesseract
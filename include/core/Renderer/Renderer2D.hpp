@@ -1,11 +1,13 @@
 #pragma once
 
 #include "core/Renderer/OrthographicCamera.hpp"
-#include "core/Renderer/Texture.hpp" // On ajoutera Texture plus tard, mais préparons le terrain
+#include "core/Renderer/Texture.hpp"
+#include "core/Renderer/SubTexture2D.hpp"
 #include "core/Renderer/Shader.hpp"
 #include "core/Renderer/VertexArray.hpp"
 
 #include <glm/glm.hpp>
+#include <vector>
 
 namespace Tesseract {
 
@@ -27,16 +29,40 @@ namespace Tesseract {
         static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotationRadians, const glm::vec4& color);
         static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotationRadians, const glm::vec4& color);
 
-        // TODO: Ajouter des versions avec textures
-        // static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<Texture2D>& texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
-        // static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
-        // static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotationRadians, const Ref<Texture2D>& texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
-        // static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotationRadians, const Ref<Texture2D>& texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+        // Instance de quad pour le rendu en masse (centrée, comme DrawRotatedQuad)
+        struct QuadInstance {
+            glm::vec3 Position = { 0.0f, 0.0f, 0.0f }; // Centre du quad
+            glm::vec2 Size = { 1.0f, 1.0f };
+            float Rotation = 0.0f;                      // En radians
+            glm::vec4 Color = { 1.0f, 1.0f, 1.0f, 1.0f };   // Teinte si texturé
+            // Texture (nullptr = couleur unie) ; doit rester valide jusqu'au Flush du lot
+            Texture2D* Texture = nullptr;
+            glm::vec2 UVMin = { 0.0f, 0.0f };
+            glm::vec2 UVMax = { 1.0f, 1.0f };
+            // Répétition des UV, texture entière uniquement (ignorée si UVMin/UVMax
+            // désignent une sous-région) ; uniform commun au lot, un changement de
+            // valeur entre quads texturés démarre un nouveau lot
+            float TilingFactor = 1.0f;
+        };
+
+        // Lot d'instances : les sommets sont générés en parallèle sur le JobSystem
+        static void DrawQuads(const QuadInstance* instances, uint32_t count);
+        static void DrawQuads(const std::vector<QuadInstance>& instances) {
+            DrawQuads(instances.data(), (uint32_t)instances.size());
+        }
+
+        // Position + Taille + Texture (ou région d'atlas) + Teinte
+        static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<Texture2D>& texture, const glm::vec4& tintColor = glm::vec4(1.0f), float tilingFactor = 1.0f);
+        static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture, const glm::vec4& tintColor = glm::vec4(1.0f), float tilingFactor = 1.0f);
+        static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const SubTexture2D& subTexture, const glm::vec4& tintColor = glm::vec4(1.0f));
+        static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const SubTexture2D& subTexture, const glm::vec4& tintColor = glm::vec4(1.0f));
 
         // Statistiques de Rendu
         struct Statistics {
             uint32_t DrawCalls = 0;
             uint32_t QuadCount = 0;
+            uint32_t VertexBytes = 0; // Octets de sommets envoyés au GPU
+            uint32_t TextureBinds = 0; // Textures liées par les Flush
 
             uint32_t GetTotalVertexCount() const { return QuadCount * 4; }
             uint32_t GetTotalIndexCount() const { return QuadCount * 6; }
@@ -10,7 +10,8 @@ namespace Tesseract {
     public:
         // Énumération pour identifier l'API (utile si on supporte plusieurs API)
         enum class API {
-            None = 0, OpenGL = 1 // Ajouter DirectX, Vulkan, Metal etc. si besoin
+            None = 0, OpenGL = 1, // Ajouter DirectX, Vulkan, Metal etc. si besoin
+            Null = 2 // Sans GPU (serveurs, CI) : ressources en mémoire, commandes ignorées
         };
 
     public:
@@ -18,6 +19,8 @@ namespace Tesseract {
 
         // Initialisation de l'API
         virtual void Init() = 0;
+        // Libération des ressources de l'API (contexte encore courant)
+        virtual void Shutdown() = 0;
 
         // Définir la couleur de nettoyage
         virtual void SetClearColor(const glm::vec4& color) = 0;
@@ -30,8 +33,23 @@ namespace Tesseract {
         // Commande de dessin indexé
         virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
 
+        // Changements d'état transmis au driver / évités car redondants (cumul)
+        struct StateStatistics {
+            uint64_t IssuedCalls = 0;
+            uint64_t SkippedCalls = 0;
+        };
+
+        // L'état de l'API a pu être modifié hors du moteur (ImGui) : ne plus s'y fier
+        virtual void InvalidateState() = 0;
+        // Lisible depuis n'importe quel thread
+        virtual StateStatistics GetStateStatistics() const = 0;
+
         // Obtenir l'API de rendu actuelle (statique)
         static API GetAPI() { return s_API; }
+        // À choisir avant RenderCommand::Init et la création des premières ressources
+        static void SetAPI(API api) { s_API = api; }
+        // Instancie l'implémentation de l'API courante
+        static Scope<RendererAPI> Create();
 
     private:
         // API de rendu actuellement utilisée (pourrait être changée globalement)
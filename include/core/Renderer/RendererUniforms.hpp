@@ -0,0 +1,79 @@
+#pragma once
+
+#include "core/Renderer/Buffer.hpp"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace Tesseract {
+
+    class OrthographicCamera;
+
+    // Points de liaison fixes des blocs d'uniforms partagés (voir assets/shaders/Uniforms.glsl)
+    enum class UniformBinding : uint32_t {
+        Camera = 0,
+        Frame = 1,
+        Lighting = 2,
+        Count
+    };
+
+    // Structures en disposition std140 : vec3 interdits (alignés sur 16), tailles multiples de 16
+
+    struct CameraUniforms {
+        glm::mat4 ViewProjection = glm::mat4(1.0f);
+        glm::mat4 View = glm::mat4(1.0f);
+        glm::mat4 Projection = glm::mat4(1.0f);
+        glm::vec4 Position = { 0.0f, 0.0f, 0.0f, 1.0f };
+    };
+    static_assert(sizeof(CameraUniforms) == 208, "CameraUniforms doit suivre std140");
+
+    struct FrameUniforms {
+        float Time = 0.0f;        // Secondes depuis le démarrage
+        float DeltaTime = 0.0f;
+        float FixedAlpha = 0.0f;  // Interpolation entre deux ticks de simulation
+        uint32_t FrameIndex = 0;
+        glm::vec2 ViewportSize = { 0.0f, 0.0f };
+        glm::vec2 InverseViewportSize = { 0.0f, 0.0f };
+    };
+    static_assert(sizeof(FrameUniforms) == 32, "FrameUniforms doit suivre std140");
+
+    struct PointLightUniform {
+        glm::vec4 PositionRadius = { 0.0f, 0.0f, 0.0f, 0.0f }; // xyz = position, w = rayon
+        glm::vec4 ColorIntensity = { 1.0f, 1.0f, 1.0f, 0.0f }; // rgb = couleur, a = intensité
+    };
+
+    struct LightingUniforms {
+        static constexpr uint32_t MaxPointLights = 16;
+
+        glm::vec4 AmbientColor = { 1.0f, 1.0f, 1.0f, 1.0f };
+        uint32_t PointLightCount = 0;
+        uint32_t Padding[3] = {};
+        PointLightUniform PointLights[MaxPointLights];
+    };
+    static_assert(offsetof(LightingUniforms, PointLights) == 32, "LightingUniforms doit suivre std140");
+
+    /**
+     * @class RendererUniforms
+     * @brief Blocs d'uniforms partagés par tous les shaders (caméra, frame, éclairage)
+     *
+     * Chaque bloc est un UniformBuffer lié une fois pour toutes à son point de
+     * liaison ; les programmes y associent leurs blocs de même nom au link. Les
+     * données sont envoyées une fois par frame (ou par scène pour la caméra) au
+     * lieu d'un glUniform* par shader. Les setters des shaders ne servent plus
+     * qu'aux paramètres propres à un matériau ou à un lot.
+     */
+    class RendererUniforms {
+    public:
+        static void Init();
+        static void Shutdown();
+
+        static void SetCamera(const OrthographicCamera& camera);
+        static void SetCamera(const CameraUniforms& camera);
+        static void SetFrame(const FrameUniforms& frame);
+        static void SetLighting(const LightingUniforms& lighting);
+
+        // Point de liaison d'un bloc d'après son nom GLSL, -1 s'il n'est pas partagé
+        static int32_t GetBlockBinding(const char* blockName);
+    };
+
+} // namespace Tesseract
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <glm/glm.hpp> // Pour les uniforms (matrice, vecteurs)
 #include "core/Core.hpp" // Inclure Core.hpp pour Ref
 
@@ -20,6 +21,7 @@ namespace Tesseract {
 
         // Fonctions SetUniform virtuelles pures ajoutées
         virtual void SetInt(const std::string& name, int value) = 0;
+        virtual void SetIntArray(const std::string& name, const int* values, uint32_t count) = 0;
         virtual void SetFloat(const std::string& name, float value) = 0;
         virtual void SetFloat2(const std::string& name, const glm::vec2& value) = 0;
         virtual void SetFloat3(const std::string& name, const glm::vec3& value) = 0;
@@ -34,6 +36,19 @@ namespace Tesseract {
         // Prend le chemin vers UN SEUL fichier contenant les deux types de shader
         // (séparés par #type vertex/fragment)
         static Ref<Shader> Create(const std::string& filepath);
+        // Variante : chaque mot-clé est injecté en "#define MOT 1" (voir ShaderVariants)
+        static Ref<Shader> Create(const std::string& filepath, const std::vector<std::string>& defines);
+
+        // --- Réglages de compilation (à fixer avant la création des shaders) ---
+
+        // Dossier du cache des programmes compilés ("" = désactivé, toujours recompiler)
+        static void SetBinaryCacheDirectory(const std::string& directory);
+        static const std::string& GetBinaryCacheDirectory();
+
+        // Journalise chaque ligne des sources GLSL (niveau trace) à la compilation.
+        // Désactivé par défaut : coûteux, utile seulement pour déboguer un shader
+        static void SetSourceTracing(bool enabled);
+        static bool IsSourceTracingEnabled();
 
         // TODO: Ajouter une méthode Create qui prend directement les sources vertex/fragment
         // static Ref<Shader> Create(const std::string& vertexSrc, const std::string& fragmentSrc);
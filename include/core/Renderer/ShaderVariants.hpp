@@ -0,0 +1,52 @@
+#pragma once
+
+#include "core/Renderer/Shader.hpp"
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Tesseract {
+
+    /**
+     * @class ShaderVariants
+     * @brief Variantes d'un même fichier de shader, une par combinaison de mots-clés
+     *
+     * Chaque mot-clé déclaré (ex: TEXTURED, INSTANCED, ALPHA_TEST) correspond à un
+     * bit de la clé de variante ; une variante est compilée avec "#define MOT 1"
+     * pour chacun de ses bits. Le GLSL choisit son chemin par #ifdef : chaque
+     * variante est un shader spécialisé, sans branche à l'exécution.
+     *
+     * Les variantes sont créées à la première demande puis gardées en cache.
+     * Prewarm() lance plusieurs compilations d'un coup : avec
+     * GL_KHR_parallel_shader_compile, le driver les compile en parallèle et
+     * chacune n'est attendue qu'à sa première utilisation.
+     */
+    class ShaderVariants {
+    public:
+        using Key = uint32_t;
+        static constexpr uint32_t MaxKeywords = 32;
+
+        ShaderVariants(const std::string& filepath, const std::vector<std::string>& keywords);
+
+        // Clé d'une combinaison de mots-clés (un mot-clé inconnu est signalé et ignoré)
+        Key GetKey(std::initializer_list<const char*> keywords) const;
+
+        // Variante de la clé, compilée à la première demande
+        const Ref<Shader>& Get(Key key);
+        const Ref<Shader>& Get(std::initializer_list<const char*> keywords) { return Get(GetKey(keywords)); }
+
+        // Crée d'avance les variantes (compilations lancées ensemble)
+        void Prewarm(const std::vector<Key>& keys);
+
+        const std::string& GetFilepath() const { return m_Filepath; }
+        uint32_t GetVariantCount() const { return (uint32_t)m_Variants.size(); }
+
+    private:
+        std::string m_Filepath;
+        std::vector<std::string> m_Keywords;
+        std::unordered_map<Key, Ref<Shader>> m_Variants;
+    };
+
+} // namespace Tesseract
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "core/Renderer/Texture.hpp"
+#include <glm/glm.hpp>
+
+namespace Tesseract {
+
+    // Zone rectangulaire d'une texture (typiquement une région de page d'atlas).
+    // Les coordonnées UV suivent la convention OpenGL : (0,0) en bas à gauche.
+    struct SubTexture2D {
+        Ref<Texture2D> Texture = nullptr;
+        glm::vec2 UVMin = { 0.0f, 0.0f };
+        glm::vec2 UVMax = { 1.0f, 1.0f };
+
+        SubTexture2D() = default;
+        SubTexture2D(const Ref<Texture2D>& texture, const glm::vec2& uvMin = { 0.0f, 0.0f }, const glm::vec2& uvMax = { 1.0f, 1.0f })
+            : Texture(texture), UVMin(uvMin), UVMax(uvMax) {}
+
+        bool IsValid() const { return Texture != nullptr; }
+    };
+
+} // namespace Tesseract
@@ -2,6 +2,7 @@
 
 #include "core/Core.hpp" // Pour Ref
 #include "core/Renderer/RendererAPI.hpp" // Pour RendererAPI::GetAPI()
+#include "core/Asset/Image.hpp"
 #include <string>
 #include <cstdint> // Pour uint32_t
 
@@ -15,10 +16,16 @@ namespace Tesseract {
         virtual uint32_t GetWidth() const = 0;
         virtual uint32_t GetHeight() const = 0;
         virtual uint32_t GetRendererID() const = 0; // Pour l'ID OpenGL/API spécifique
+        virtual uint32_t GetMipLevelCount() const = 0;
+        // Mémoire GPU estimée (tous niveaux de mip compris)
+        virtual size_t GetMemorySize() const = 0;
 
         // Définit les données de la texture (potentiellement une partie seulement)
         virtual void SetData(void* data, uint32_t size) = 0;
 
+        // Faux tant qu'une texture en attente (chargement asynchrone) n'a pas reçu son image
+        virtual bool IsLoaded() const = 0;
+
         // Lie la texture à un slot donné (par défaut 0)
         virtual void Bind(uint32_t slot = 0) const = 0;
 
@@ -34,6 +41,11 @@ namespace Tesseract {
         static Ref<Texture2D> Create(uint32_t width, uint32_t height);
         // Crée une texture en chargeant depuis un fichier
         static Ref<Texture2D> Create(const std::string& path);
+        // Crée une texture sans contenu, remplie plus tard par SetImage (chargement asynchrone)
+        static Ref<Texture2D> CreatePending(const std::string& path);
+
+        // Remplace le contenu par une image décodée (dimensions et format compris)
+        virtual void SetImage(Image&& image) = 0;
     };
 
 
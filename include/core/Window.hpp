@@ -1,9 +1,7 @@
 #pragma once
 
 #include <string>
-#include <functional>
 #include "core/Core.hpp" // Pour Scope
-#include "core/Event.hpp"
 
 // Forward declaration de SDL_Window et SDL_GLContext
 struct SDL_Window;
@@ -11,6 +9,9 @@ typedef void* SDL_GLContext;
 
 namespace Tesseract {
 
+    class EventBus;
+    struct RecordedEvent;
+
     // Propriétés pour la création de la fenêtre
     struct WindowProps {
         std::string Title;
@@ -28,8 +29,6 @@ namespace Tesseract {
     // Normalement, ce serait une interface pure et SDLWindow hériterait.
     class Window {
     public:
-        using EventCallbackFn = std::function<void(Event&)>;
-
         Window(const WindowProps& props); // Déplacé de protected à public et implémenté dans Window.cpp
         virtual ~Window(); // Retrait de = default
 
@@ -38,7 +37,8 @@ namespace Tesseract {
         virtual void SwapBuffers();
         virtual uint32_t GetWidth() const;
         virtual uint32_t GetHeight() const;
-        virtual void SetEventCallback(const EventCallbackFn& callback);
+        // Les événements SDL traduits y sont publiés (distribués par EventBus::Dispatch)
+        virtual void SetEventBus(EventBus* bus);
         virtual void SetVSync(bool enabled);
         virtual bool IsVSync() const;
         virtual void* GetNativeWindow() const;
@@ -50,6 +50,8 @@ namespace Tesseract {
         // Méthodes d'initialisation et de fermeture (appelées par constructeur/destructeur)
         void Init(const WindowProps& props);
         void Shutdown();
+        // Enregistre l'événement (InputRecorder) puis le publie sur le bus
+        void PostEvent(const RecordedEvent& event);
 
         // Données spécifiques à l'implémentation (SDL ici)
         SDL_Window* m_Window = nullptr;
@@ -60,7 +62,7 @@ namespace Tesseract {
             std::string Title;
             uint32_t Width, Height;
             bool VSync;
-            EventCallbackFn EventCallback;
+            EventBus* Bus = nullptr;
 
             // Constructeur pour initialiser depuis WindowProps
             WindowData(const WindowProps& props)
@@ -0,0 +1,323 @@
+#pragma once
+
+#include "ecs/Spatial/AABB.hpp"
+#include "core/JobSystem.hpp"
+#include "core/Profiler.hpp"
+#include <vector>
+#include <numeric>
+#include <cmath>
+#include <cstdint>
+
+namespace Tesseract {
+namespace ECS {
+
+    // Paire de volumes dont les AABB se chevauchent (indices dans le tableau d'entrée, A < B)
+    struct CollisionPair {
+        uint32_t A = 0;
+        uint32_t B = 0;
+    };
+
+    // Algorithme de phase large
+    enum class BroadPhaseMethod {
+        SweepAndPrune = 0, // Tri sur un axe puis balayage ; profite de la cohérence temporelle
+        SpatialHash        // Hachage sur une grille uniforme ; parallèle par cellule
+    };
+
+    inline const char* BroadPhaseMethodToString(BroadPhaseMethod method) {
+        switch (method) {
+            case BroadPhaseMethod::SweepAndPrune: return "SweepAndPrune";
+            case BroadPhaseMethod::SpatialHash:   return "SpatialHash";
+        }
+        return "Unknown";
+    }
+
+    /**
+     * @class BroadPhase
+     * @brief Phase large de la détection de collisions
+     *
+     * Produit, à partir d'un tableau contigu d'AABB, la liste des paires qui se
+     * chevauchent dans un tampon contigu destiné à la phase étroite. Chaque paire
+     * n'apparaît qu'une fois. Le travail est réparti sur le JobSystem (lots
+     * d'éléments triés pour le balayage, lots de cellules pour le hachage) ; chaque
+     * lot écrit dans son propre tampon, concaténés dans l'ordre des lots pour un
+     * résultat déterministe.
+     */
+    class BroadPhase {
+    public:
+        static constexpr uint32_t GrainSize = 1024;
+        static constexpr int32_t MaxCellsPerVolume = 16;
+
+        void SetMethod(BroadPhaseMethod method) { m_Method = method; }
+        BroadPhaseMethod GetMethod() const { return m_Method; }
+
+        // Taille des cellules du hachage (0 = deux fois la taille moyenne des volumes)
+        void SetCellSize(float cellSize) { m_CellSize = cellSize; }
+        float GetCellSize() const { return m_CellSize; }
+
+        /**
+         * @brief Calcule les paires candidates
+         * @param bounds AABB des volumes (l'indice sert d'identifiant)
+         * @return Tampon des paires, valide jusqu'au prochain appel
+         */
+        const std::vector<CollisionPair>& FindPairs(const std::vector<AABB>& bounds) {
+            TS_PROFILE_SCOPE("BroadPhase::FindPairs");
+            m_Pairs.clear();
+            if (bounds.size() >= 2) {
+                if (m_Method == BroadPhaseMethod::SweepAndPrune)
+                    SweepAndPrune(bounds);
+                else
+                    SpatialHash(bounds);
+            }
+            return m_Pairs;
+        }
+
+        const std::vector<CollisionPair>& GetPairs() const { return m_Pairs; }
+
+    private:
+        static CollisionPair MakePair(uint32_t a, uint32_t b) {
+            return a < b ? CollisionPair{a, b} : CollisionPair{b, a};
+        }
+
+        std::vector<CollisionPair>& GetChunkBuffer(uint32_t chunk) {
+            return m_ChunkPairs[chunk];
+        }
+
+        void PrepareChunks(uint32_t chunkCount) {
+            if (m_ChunkPairs.size() < chunkCount)
+                m_ChunkPairs.resize(chunkCount);
+            for (uint32_t i = 0; i < chunkCount; ++i)
+                m_ChunkPairs[i].clear();
+        }
+
+        // Concatène les tampons des lots dans m_Pairs
+        void GatherChunks(uint32_t chunkCount) {
+            size_t total = 0;
+            for (uint32_t i = 0; i < chunkCount; ++i)
+                total += m_ChunkPairs[i].size();
+            m_Pairs.reserve(total);
+            for (uint32_t i = 0; i < chunkCount; ++i)
+                m_Pairs.insert(m_Pairs.end(), m_ChunkPairs[i].begin(), m_ChunkPairs[i].end());
+        }
+
+        // --- Sweep and prune ---
+
+        void SweepAndPrune(const std::vector<AABB>& bounds) {
+            uint32_t count = (uint32_t)bounds.size();
+
+            // Axe de balayage : celui où les centres sont les plus dispersés
+            glm::vec2 sum(0.0f), sumSq(0.0f);
+            for (const AABB& box : bounds) {
+                glm::vec2 center = box.GetCenter();
+                sum += center;
+                sumSq += center * center;
+            }
+            glm::vec2 variance = sumSq / (float)count - (sum / (float)count) * (sum / (float)count);
+            int axis = variance.x >= variance.y ? 0 : 1;
+
+            // L'ordre de la frame précédente est presque trié : tri par insertion
+            bool coherent = m_Order.size() == count && axis == m_SortAxis;
+            if (!coherent) {
+                m_Order.resize(count);
+                std::iota(m_Order.begin(), m_Order.end(), 0u);
+            }
+            m_SortAxis = axis;
+
+            auto key = [&](uint32_t index) { return bounds[index].Min[axis]; };
+            if (!coherent || !InsertionSort(key, (size_t)count * 8)) {
+                std::sort(m_Order.begin(), m_Order.end(),
+                          [&](uint32_t a, uint32_t b) { return key(a) < key(b); });
+            }
+
+            // Copie triée en tableaux séparés (SoA) : le balayage ne lit que des flottants contigus
+            int other = 1 - axis;
+            m_SweepMin.resize(count);
+            m_SweepMax.resize(count);
+            m_OtherMin.resize(count);
+            m_OtherMax.resize(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                const AABB& box = bounds[m_Order[i]];
+                m_SweepMin[i] = box.Min[axis];
+                m_SweepMax[i] = box.Max[axis];
+                m_OtherMin[i] = box.Min[other];
+                m_OtherMax[i] = box.Max[other];
+            }
+
+            uint32_t chunkCount = JobSystem::GetChunkCount(count, GrainSize);
+            PrepareChunks(chunkCount);
+            JobSystem::ParallelFor(count, GrainSize, [&](uint32_t begin, uint32_t end) {
+                auto& out = GetChunkBuffer(begin / GrainSize);
+                for (uint32_t i = begin; i < end; ++i) {
+                    float maxSweep = m_SweepMax[i];
+                    float minOther = m_OtherMin[i];
+                    float maxOther = m_OtherMax[i];
+                    for (uint32_t j = i + 1; j < count && m_SweepMin[j] <= maxSweep; ++j) {
+                        if (minOther <= m_OtherMax[j] && maxOther >= m_OtherMin[j])
+                            out.push_back(MakePair(m_Order[i], m_Order[j]));
+                    }
+                }
+            });
+            GatherChunks(chunkCount);
+        }
+
+        // Tri par insertion de m_Order ; abandonne au-delà de maxShifts déplacements
+        template<typename KeyFn>
+        bool InsertionSort(const KeyFn& key, size_t maxShifts) {
+            size_t shifts = 0;
+            for (size_t i = 1; i < m_Order.size(); ++i) {
+                uint32_t value = m_Order[i];
+                float valueKey = key(value);
+                size_t j = i;
+                while (j > 0 && key(m_Order[j - 1]) > valueKey) {
+                    m_Order[j] = m_Order[j - 1];
+                    --j;
+                    if (++shifts > maxShifts) {
+                        m_Order[j] = value;
+                        return false;
+                    }
+                }
+                m_Order[j] = value;
+            }
+            return true;
+        }
+
+        // --- Spatial hash ---
+
+        struct CellEntry {
+            int32_t X, Y;
+            uint32_t Volume;
+        };
+
+        int32_t CellCoord(float value, float invCellSize) const {
+            return (int32_t)std::floor(value * invCellSize);
+        }
+
+        static size_t BucketIndex(int32_t x, int32_t y, size_t mask) {
+            uint32_t hash = ((uint32_t)x * 73856093u) ^ ((uint32_t)y * 19349663u);
+            return hash & mask;
+        }
+
+        void SpatialHash(const std::vector<AABB>& bounds) {
+            uint32_t count = (uint32_t)bounds.size();
+
+            float cellSize = m_CellSize;
+            if (cellSize <= 0.0f) {
+                float extent = 0.0f;
+                for (const AABB& box : bounds) {
+                    glm::vec2 size = box.GetSize();
+                    extent += std::max(size.x, size.y);
+                }
+                cellSize = std::max(2.0f * extent / (float)count, 1e-4f);
+            }
+            float invCellSize = 1.0f / cellSize;
+
+            // Les volumes couvrant trop de cellules sont testés à part contre tous les autres
+            m_Large.clear();
+            size_t entryCount = 0;
+            for (uint32_t i = 0; i < count; ++i) {
+                const AABB& box = bounds[i];
+                int64_t cells = (int64_t)(CellCoord(box.Max.x, invCellSize) - CellCoord(box.Min.x, invCellSize) + 1) *
+                                (int64_t)(CellCoord(box.Max.y, invCellSize) - CellCoord(box.Min.y, invCellSize) + 1);
+                if (cells > MaxCellsPerVolume)
+                    m_Large.push_back(i);
+                else
+                    entryCount += (size_t)cells;
+            }
+
+            // Tri par comptage des entrées (cellule, volume) dans les buckets
+            size_t bucketCount = 1;
+            while (bucketCount < entryCount * 2) bucketCount <<= 1;
+            size_t mask = bucketCount - 1;
+
+            m_BucketStart.assign(bucketCount + 1, 0);
+            m_IsLarge.assign(count, 0);
+            for (uint32_t index : m_Large)
+                m_IsLarge[index] = 1;
+
+            auto forEachCell = [&](uint32_t i, auto&& fn) {
+                const AABB& box = bounds[i];
+                int32_t minX = CellCoord(box.Min.x, invCellSize), maxX = CellCoord(box.Max.x, invCellSize);
+                int32_t minY = CellCoord(box.Min.y, invCellSize), maxY = CellCoord(box.Max.y, invCellSize);
+                for (int32_t y = minY; y <= maxY; ++y)
+                    for (int32_t x = minX; x <= maxX; ++x)
+                        fn(x, y);
+            };
+
+            for (uint32_t i = 0; i < count; ++i) {
+                if (m_IsLarge[i]) continue;
+                forEachCell(i, [&](int32_t x, int32_t y) { m_BucketStart[BucketIndex(x, y, mask) + 1]++; });
+            }
+            for (size_t b = 0; b < bucketCount; ++b)
+                m_BucketStart[b + 1] += m_BucketStart[b];
+
+            m_Entries.resize(entryCount);
+            m_BucketFill.assign(m_BucketStart.begin(), m_BucketStart.end() - 1);
+            for (uint32_t i = 0; i < count; ++i) {
+                if (m_IsLarge[i]) continue;
+                forEachCell(i, [&](int32_t x, int32_t y) {
+                    m_Entries[m_BucketFill[BucketIndex(x, y, mask)]++] = { x, y, i };
+                });
+            }
+
+            // Tests par bucket, en parallèle ; un lot de plus pour les grands volumes
+            uint32_t bucketChunks = JobSystem::GetChunkCount((uint32_t)bucketCount, GrainSize);
+            uint32_t chunkCount = bucketChunks + 1;
+            PrepareChunks(chunkCount);
+
+            JobSystem::ParallelFor((uint32_t)bucketCount, GrainSize, [&](uint32_t begin, uint32_t end) {
+                auto& out = GetChunkBuffer(begin / GrainSize);
+                for (uint32_t bucket = begin; bucket < end; ++bucket) {
+                    size_t first = m_BucketStart[bucket], last = m_BucketStart[bucket + 1];
+                    for (size_t i = first; i < last; ++i) {
+                        const CellEntry& a = m_Entries[i];
+                        const AABB& boxA = bounds[a.Volume];
+                        for (size_t j = i + 1; j < last; ++j) {
+                            const CellEntry& b = m_Entries[j];
+                            // Collision de hachage : cellules différentes
+                            if (a.X != b.X || a.Y != b.Y || a.Volume == b.Volume)
+                                continue;
+                            const AABB& boxB = bounds[b.Volume];
+                            if (!boxA.Overlaps(boxB))
+                                continue;
+                            // Une paire n'est émise que par la cellule contenant le coin min de l'intersection
+                            int32_t cellX = CellCoord(std::max(boxA.Min.x, boxB.Min.x), invCellSize);
+                            int32_t cellY = CellCoord(std::max(boxA.Min.y, boxB.Min.y), invCellSize);
+                            if (cellX == a.X && cellY == a.Y)
+                                out.push_back(MakePair(a.Volume, b.Volume));
+                        }
+                    }
+                }
+            });
+
+            auto& largeOut = GetChunkBuffer(bucketChunks);
+            for (uint32_t large : m_Large) {
+                for (uint32_t i = 0; i < count; ++i) {
+                    // Paire grand/grand émise une seule fois
+                    if (i == large || (m_IsLarge[i] && i < large))
+                        continue;
+                    if (bounds[large].Overlaps(bounds[i]))
+                        largeOut.push_back(MakePair(large, i));
+                }
+            }
+            GatherChunks(chunkCount);
+        }
+
+        BroadPhaseMethod m_Method = BroadPhaseMethod::SweepAndPrune;
+        float m_CellSize = 0.0f;
+
+        std::vector<CollisionPair> m_Pairs;
+        std::vector<std::vector<CollisionPair>> m_ChunkPairs;
+
+        // Sweep and prune (ordre conservé d'une frame à l'autre)
+        std::vector<uint32_t> m_Order;
+        std::vector<float> m_SweepMin, m_SweepMax, m_OtherMin, m_OtherMax;
+        int m_SortAxis = -1;
+
+        // Spatial hash
+        std::vector<CellEntry> m_Entries;
+        std::vector<size_t> m_BucketStart;
+        std::vector<size_t> m_BucketFill;
+        std::vector<uint32_t> m_Large;
+        std::vector<uint8_t> m_IsLarge;
+    };
+
+}} // namespace Tesseract::ECS
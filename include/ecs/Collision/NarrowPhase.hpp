@@ -0,0 +1,167 @@
+#pragma once
+
+#include "ecs/Components.hpp"
+#include "ecs/Collision/BroadPhase.hpp"
+#include <vector>
+#include <cmath>
+
+namespace Tesseract {
+namespace ECS {
+
+    // Forme de collision en coordonnées monde
+    struct CollisionShape {
+        ColliderShape Shape = ColliderShape::Box;
+        glm::vec2 Center = {0.0f, 0.0f};
+        glm::vec2 HalfExtents = {0.5f, 0.5f}; // Box
+        float Radius = 0.5f;                  // Circle
+
+        AABB GetBounds() const {
+            return Shape == ColliderShape::Circle ? AABB::FromCenter(Center, glm::vec2(Radius))
+                                                  : AABB::FromCenter(Center, HalfExtents);
+        }
+    };
+
+    // Contact résultant de la phase étroite
+    struct Contact {
+        uint32_t A = 0;
+        uint32_t B = 0;
+        glm::vec2 Normal = {0.0f, 0.0f}; // De A vers B
+        float Penetration = 0.0f;
+    };
+
+    namespace Detail {
+
+        inline bool BoxBox(const CollisionShape& a, const CollisionShape& b, glm::vec2& normal, float& depth) {
+            glm::vec2 delta = b.Center - a.Center;
+            glm::vec2 overlap = (a.HalfExtents + b.HalfExtents) - glm::abs(delta);
+            if (overlap.x <= 0.0f || overlap.y <= 0.0f)
+                return false;
+
+            // Axe de moindre pénétration
+            if (overlap.x < overlap.y) {
+                normal = { delta.x < 0.0f ? -1.0f : 1.0f, 0.0f };
+                depth = overlap.x;
+            } else {
+                normal = { 0.0f, delta.y < 0.0f ? -1.0f : 1.0f };
+                depth = overlap.y;
+            }
+            return true;
+        }
+
+        inline bool CircleCircle(const CollisionShape& a, const CollisionShape& b, glm::vec2& normal, float& depth) {
+            glm::vec2 delta = b.Center - a.Center;
+            float radii = a.Radius + b.Radius;
+            float distanceSq = glm::dot(delta, delta);
+            if (distanceSq >= radii * radii)
+                return false;
+
+            float distance = std::sqrt(distanceSq);
+            normal = distance > 0.0f ? delta / distance : glm::vec2(1.0f, 0.0f);
+            depth = radii - distance;
+            return true;
+        }
+
+        inline bool BoxCircle(const CollisionShape& box, const CollisionShape& circle, glm::vec2& normal, float& depth) {
+            glm::vec2 delta = circle.Center - box.Center;
+            glm::vec2 closest = glm::clamp(delta, -box.HalfExtents, box.HalfExtents);
+
+            if (closest == delta) {
+                // Centre du cercle dans la boîte : sortir par la face la plus proche
+                glm::vec2 distanceToFace = box.HalfExtents - glm::abs(delta);
+                if (distanceToFace.x < distanceToFace.y) {
+                    normal = { delta.x < 0.0f ? -1.0f : 1.0f, 0.0f };
+                    depth = distanceToFace.x + circle.Radius;
+                } else {
+                    normal = { 0.0f, delta.y < 0.0f ? -1.0f : 1.0f };
+                    depth = distanceToFace.y + circle.Radius;
+                }
+                return true;
+            }
+
+            glm::vec2 offset = delta - closest;
+            float distanceSq = glm::dot(offset, offset);
+            if (distanceSq >= circle.Radius * circle.Radius)
+                return false;
+
+            float distance = std::sqrt(distanceSq);
+            normal = offset / distance;
+            depth = circle.Radius - distance;
+            return true;
+        }
+
+    } // namespace Detail
+
+    /**
+     * @brief Test exact entre deux formes
+     * @param a Première forme
+     * @param b Seconde forme
+     * @param outContact Normale (de a vers b) et pénétration si contact
+     * @return true si les formes s'interpénètrent
+     */
+    inline bool TestCollision(const CollisionShape& a, const CollisionShape& b, Contact& outContact) {
+        glm::vec2 normal;
+        float depth;
+        bool hit;
+        if (a.Shape == ColliderShape::Box && b.Shape == ColliderShape::Box) {
+            hit = Detail::BoxBox(a, b, normal, depth);
+        } else if (a.Shape == ColliderShape::Circle && b.Shape == ColliderShape::Circle) {
+            hit = Detail::CircleCircle(a, b, normal, depth);
+        } else if (a.Shape == ColliderShape::Box) {
+            hit = Detail::BoxCircle(a, b, normal, depth);
+        } else {
+            hit = Detail::BoxCircle(b, a, normal, depth);
+            normal = -normal;
+        }
+
+        if (hit) {
+            outContact.Normal = normal;
+            outContact.Penetration = depth;
+        }
+        return hit;
+    }
+
+    /**
+     * @class NarrowPhase
+     * @brief Phase étroite : teste les paires candidates et produit les contacts
+     *
+     * Les paires sont traitées par lots sur le JobSystem, chaque lot remplissant
+     * son propre tampon ; les contacts sont ensuite concaténés dans l'ordre.
+     */
+    class NarrowPhase {
+    public:
+        static constexpr uint32_t GrainSize = 2048;
+
+        const std::vector<Contact>& Run(const std::vector<CollisionShape>& shapes, const std::vector<CollisionPair>& pairs) {
+            TS_PROFILE_SCOPE("NarrowPhase::Run");
+            m_Contacts.clear();
+
+            uint32_t count = (uint32_t)pairs.size();
+            uint32_t chunkCount = JobSystem::GetChunkCount(count, GrainSize);
+            if (m_ChunkContacts.size() < chunkCount)
+                m_ChunkContacts.resize(chunkCount);
+
+            JobSystem::ParallelFor(count, GrainSize, [&](uint32_t begin, uint32_t end) {
+                auto& out = m_ChunkContacts[begin / GrainSize];
+                out.clear();
+                for (uint32_t i = begin; i < end; ++i) {
+                    Contact contact;
+                    contact.A = pairs[i].A;
+                    contact.B = pairs[i].B;
+                    if (TestCollision(shapes[contact.A], shapes[contact.B], contact))
+                        out.push_back(contact);
+                }
+            });
+
+            for (uint32_t i = 0; i < chunkCount; ++i)
+                m_Contacts.insert(m_Contacts.end(), m_ChunkContacts[i].begin(), m_ChunkContacts[i].end());
+            return m_Contacts;
+        }
+
+        const std::vector<Contact>& GetContacts() const { return m_Contacts; }
+
+    private:
+        std::vector<Contact> m_Contacts;
+        std::vector<std::vector<Contact>> m_ChunkContacts;
+    };
+
+}} // namespace Tesseract::ECS
@@ -5,6 +5,7 @@
 #include <string>
 #include <functional>
 #include "core/Renderer/Texture.hpp"
+#include "core/Renderer/SubTexture2D.hpp"
 #include "core/Timestep.hpp"
 
 namespace Tesseract {
@@ -36,13 +37,18 @@ namespace ECS {
     struct SpriteComponent {
         glm::vec4 Color = {1.0f, 1.0f, 1.0f, 1.0f};
         Ref<Texture2D> Texture = nullptr;
-        float TilingFactor = 1.0f;
+        float TilingFactor = 1.0f; // Répétition de la texture (voir QuadInstance::TilingFactor)
+        // Région de la texture affichée (ex: sprite d'un atlas)
+        glm::vec2 UVMin = {0.0f, 0.0f};
+        glm::vec2 UVMax = {1.0f, 1.0f};
 
         SpriteComponent() = default;
         SpriteComponent(const glm::vec4& color) : Color(color) {}
         SpriteComponent(const Ref<Texture2D>& texture) : Texture(texture) {}
         SpriteComponent(const glm::vec4& color, const Ref<Texture2D>& texture)
             : Color(color), Texture(texture) {}
+        SpriteComponent(const SubTexture2D& subTexture, const glm::vec4& color = {1.0f, 1.0f, 1.0f, 1.0f})
+            : Color(color), Texture(subTexture.Texture), UVMin(subTexture.UVMin), UVMax(subTexture.UVMax) {}
     };
 
     // --- Composant Tag ---
@@ -78,9 +84,34 @@ namespace ECS {
     struct VelocityComponent {
         glm::vec3 Velocity = {0.0f, 0.0f, 0.0f};
 
+        // Position au tick de simulation précédent (interpolation du rendu)
+        glm::vec3 PreviousPosition = {0.0f, 0.0f, 0.0f};
+        bool HasPreviousPosition = false;
+
         VelocityComponent() = default;
         VelocityComponent(const glm::vec3& velocity)
             : Velocity(velocity) {}
     };
 
+    // --- Composant de collision ---
+    enum class ColliderShape {
+        Box = 0,  // Boîte alignée sur les axes
+        Circle
+    };
+
+    struct ColliderComponent {
+        ColliderShape Shape = ColliderShape::Box;
+        glm::vec2 Offset = {0.0f, 0.0f};    // Centre relatif à la position du Transform
+        glm::vec2 HalfExtents = {0.5f, 0.5f}; // Box uniquement
+        float Radius = 0.5f;                 // Circle uniquement
+        float Restitution = 1.0f;            // 1 = rebond parfaitement élastique
+        bool IsTrigger = false;              // Détecte sans résoudre le contact
+
+        ColliderComponent() = default;
+        ColliderComponent(const glm::vec2& halfExtents, const glm::vec2& offset = {0.0f, 0.0f})
+            : Shape(ColliderShape::Box), Offset(offset), HalfExtents(halfExtents) {}
+        ColliderComponent(float radius, const glm::vec2& offset = {0.0f, 0.0f})
+            : Shape(ColliderShape::Circle), Offset(offset), Radius(radius) {}
+    };
+
 }} // namespace Tesseract::ECS
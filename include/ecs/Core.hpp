@@ -10,6 +10,7 @@
 #include <set>
 #include <algorithm>
 #include <type_traits>
+#include <stdexcept>
 
 namespace Tesseract {
 namespace ECS {
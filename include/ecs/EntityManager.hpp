@@ -40,6 +40,8 @@ namespace ECS {
             --livingEntityCount;
         }
 
+        uint32_t GetLivingEntityCount() const { return livingEntityCount; }
+
         void SetSignature(EntityID entity, ComponentSignature signature) {
             if (entity >= MAX_ENTITIES) {
                 throw std::runtime_error("Entity out of range.");
@@ -35,6 +35,11 @@ namespace ECS {
             return entityManager->CreateEntity();
         }
 
+        // Nombre d'entités vivantes
+        uint32_t GetEntityCount() const {
+            return entityManager->GetLivingEntityCount();
+        }
+
         /**
          * @brief Détruit une entité et tous ses composants
          * @param entity ID de l'entité à détruire
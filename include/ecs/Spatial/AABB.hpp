@@ -0,0 +1,61 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace Tesseract {
+namespace ECS {
+
+    // Boîte englobante alignée sur les axes (2D), utilisée par les index spatiaux
+    struct AABB {
+        glm::vec2 Min = {0.0f, 0.0f};
+        glm::vec2 Max = {0.0f, 0.0f};
+
+        AABB() = default;
+        AABB(const glm::vec2& min, const glm::vec2& max)
+            : Min(min), Max(max) {}
+
+        static AABB FromCenter(const glm::vec2& center, const glm::vec2& halfExtents) {
+            return AABB(center - halfExtents, center + halfExtents);
+        }
+
+        glm::vec2 GetCenter() const { return (Min + Max) * 0.5f; }
+        glm::vec2 GetSize() const { return Max - Min; }
+        float GetArea() const { return (Max.x - Min.x) * (Max.y - Min.y); }
+
+        bool Overlaps(const AABB& other) const {
+            return Min.x <= other.Max.x && Max.x >= other.Min.x &&
+                   Min.y <= other.Max.y && Max.y >= other.Min.y;
+        }
+
+        bool Contains(const glm::vec2& point) const {
+            return point.x >= Min.x && point.x <= Max.x &&
+                   point.y >= Min.y && point.y <= Max.y;
+        }
+
+        bool Contains(const AABB& other) const {
+            return other.Min.x >= Min.x && other.Max.x <= Max.x &&
+                   other.Min.y >= Min.y && other.Max.y <= Max.y;
+        }
+
+        // Distance au carré entre un point et la boîte (0 si le point est à l'intérieur)
+        float DistanceSquared(const glm::vec2& point) const {
+            float dx = std::max(std::max(Min.x - point.x, 0.0f), point.x - Max.x);
+            float dy = std::max(std::max(Min.y - point.y, 0.0f), point.y - Max.y);
+            return dx * dx + dy * dy;
+        }
+
+        // Agrandit la boîte pour englober 'other'
+        void Merge(const AABB& other) {
+            Min.x = std::min(Min.x, other.Min.x);
+            Min.y = std::min(Min.y, other.Min.y);
+            Max.x = std::max(Max.x, other.Max.x);
+            Max.y = std::max(Max.y, other.Max.y);
+        }
+
+        bool operator==(const AABB& other) const { return Min == other.Min && Max == other.Max; }
+        bool operator!=(const AABB& other) const { return !(*this == other); }
+    };
+
+}} // namespace Tesseract::ECS
@@ -0,0 +1,293 @@
+#pragma once
+
+#include "ecs/Spatial/SpatialIndex.hpp"
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+#include <cstdint>
+
+namespace Tesseract {
+namespace ECS {
+
+    /**
+     * @class LooseQuadtree
+     * @brief Quadtree lâche implicite (facteur de relâchement 2)
+     *
+     * Le niveau L découpe le monde en 2^L x 2^L cellules ; chaque nœud couvre sa
+     * cellule agrandie d'une demi-cellule de chaque côté. Une entité est placée
+     * dans le niveau le plus profond dont la cellule est au moins aussi grande
+     * qu'elle, dans la cellule qui contient son centre : insertion et mise à jour
+     * en O(1), sans subdivision ni rééquilibrage. Seuls les nœuds occupés sont
+     * stockés. Les entités qui sortent du monde sont rangées à part.
+     */
+    class LooseQuadtree : public ISpatialIndex {
+    public:
+        static constexpr uint32_t MaxSupportedDepth = 15;
+
+        explicit LooseQuadtree(const AABB& worldBounds = AABB({-64.0f, -64.0f}, {64.0f, 64.0f}), uint32_t maxDepth = 8)
+            : m_WorldBounds(worldBounds)
+        {
+            uint32_t depth = std::min(maxDepth, MaxSupportedDepth);
+            m_Levels.resize(depth + 1);
+            glm::vec2 worldSize = m_WorldBounds.GetSize();
+            for (uint32_t level = 0; level <= depth; ++level) {
+                m_Levels[level].Resolution = 1 << level;
+                m_Levels[level].CellSize = worldSize / (float)m_Levels[level].Resolution;
+            }
+        }
+
+        SpatialIndexType GetType() const override { return SpatialIndexType::LooseQuadtree; }
+        const AABB& GetWorldBounds() const { return m_WorldBounds; }
+
+        void Insert(EntityID entity, const AABB& bounds) override {
+            if (Contains(entity)) {
+                Update(entity, bounds);
+                return;
+            }
+
+            if (entity >= m_Entries.size())
+                m_Entries.resize((size_t)entity + 1);
+
+            Entry& entry = m_Entries[entity];
+            entry.Bounds = bounds;
+            entry.Alive = true;
+            Locate(bounds, entry.Level, entry.Key);
+            AddToNode(entity, entry.Level, entry.Key);
+
+            GrowContentBounds(bounds);
+            ++m_Size;
+        }
+
+        void Update(EntityID entity, const AABB& bounds) override {
+            if (!Contains(entity)) {
+                Insert(entity, bounds);
+                return;
+            }
+
+            Entry& entry = m_Entries[entity];
+            int32_t level;
+            uint32_t key;
+            Locate(bounds, level, key);
+            if (level != entry.Level || key != entry.Key) {
+                RemoveFromNode(entity, entry.Level, entry.Key);
+                AddToNode(entity, level, key);
+                entry.Level = level;
+                entry.Key = key;
+            }
+            entry.Bounds = bounds;
+            GrowContentBounds(bounds);
+        }
+
+        void Remove(EntityID entity) override {
+            if (!Contains(entity))
+                return;
+
+            Entry& entry = m_Entries[entity];
+            RemoveFromNode(entity, entry.Level, entry.Key);
+            entry.Alive = false;
+            --m_Size;
+        }
+
+        void Clear() override {
+            for (auto& level : m_Levels) {
+                level.Nodes.clear();
+                level.Count = 0;
+            }
+            m_Outside.clear();
+            m_Entries.clear();
+            m_Size = 0;
+            m_HasContent = false;
+        }
+
+        bool Contains(EntityID entity) const override {
+            return entity < m_Entries.size() && m_Entries[entity].Alive;
+        }
+
+        const AABB& GetBounds(EntityID entity) const override { return m_Entries[entity].Bounds; }
+        size_t GetSize() const override { return m_Size; }
+        AABB GetContentBounds() const override { return m_ContentBounds; }
+
+        void QueryRange(const AABB& range, std::vector<EntityID>& out) const override {
+            if (m_Size == 0)
+                return;
+
+            for (const Level& level : m_Levels) {
+                if (level.Count == 0)
+                    continue;
+
+                // Cellules dont les bornes lâches (cellule + demi-cellule) chevauchent la zone
+                glm::vec2 half = level.CellSize * 0.5f;
+                int32_t minX = CellIndex(range.Min.x - half.x, m_WorldBounds.Min.x, level.CellSize.x, level.Resolution);
+                int32_t minY = CellIndex(range.Min.y - half.y, m_WorldBounds.Min.y, level.CellSize.y, level.Resolution);
+                int32_t maxX = CellIndex(range.Max.x + half.x, m_WorldBounds.Min.x, level.CellSize.x, level.Resolution);
+                int32_t maxY = CellIndex(range.Max.y + half.y, m_WorldBounds.Min.y, level.CellSize.y, level.Resolution);
+                size_t cellCount = (size_t)(maxX - minX + 1) * (size_t)(maxY - minY + 1);
+
+                if (cellCount > level.Nodes.size()) {
+                    // Moins de nœuds occupés que de cellules candidates : parcourir les nœuds
+                    for (const auto& [key, node] : level.Nodes) {
+                        int32_t x = (int32_t)(key & 0xFFFF);
+                        int32_t y = (int32_t)(key >> 16);
+                        if (x < minX || x > maxX || y < minY || y > maxY)
+                            continue;
+                        CollectOverlapping(node, range, out);
+                    }
+                } else {
+                    for (int32_t y = minY; y <= maxY; ++y) {
+                        for (int32_t x = minX; x <= maxX; ++x) {
+                            auto it = level.Nodes.find(MakeKey(x, y));
+                            if (it != level.Nodes.end())
+                                CollectOverlapping(it->second, range, out);
+                        }
+                    }
+                }
+            }
+            CollectOverlapping(m_Outside, range, out);
+        }
+
+        void QueryPoint(const glm::vec2& point, std::vector<EntityID>& out) const override {
+            if (m_Size == 0)
+                return;
+
+            for (const Level& level : m_Levels) {
+                if (level.Count == 0)
+                    continue;
+
+                // Un point n'appartient qu'aux bornes lâches des 2x2 cellules voisines
+                glm::vec2 half = level.CellSize * 0.5f;
+                int32_t minX = CellIndex(point.x - half.x, m_WorldBounds.Min.x, level.CellSize.x, level.Resolution);
+                int32_t minY = CellIndex(point.y - half.y, m_WorldBounds.Min.y, level.CellSize.y, level.Resolution);
+                int32_t maxX = CellIndex(point.x + half.x, m_WorldBounds.Min.x, level.CellSize.x, level.Resolution);
+                int32_t maxY = CellIndex(point.y + half.y, m_WorldBounds.Min.y, level.CellSize.y, level.Resolution);
+                for (int32_t y = minY; y <= maxY; ++y) {
+                    for (int32_t x = minX; x <= maxX; ++x) {
+                        auto it = level.Nodes.find(MakeKey(x, y));
+                        if (it == level.Nodes.end())
+                            continue;
+                        for (EntityID entity : it->second) {
+                            if (m_Entries[entity].Bounds.Contains(point))
+                                out.push_back(entity);
+                        }
+                    }
+                }
+            }
+            for (EntityID entity : m_Outside) {
+                if (m_Entries[entity].Bounds.Contains(point))
+                    out.push_back(entity);
+            }
+        }
+
+    protected:
+        float GetNearestSearchRadius() const override {
+            const glm::vec2& cell = m_Levels.back().CellSize;
+            return std::max(cell.x, cell.y);
+        }
+
+    private:
+        static constexpr int32_t OutsideLevel = -1;
+
+        struct Level {
+            uint32_t Resolution = 1;
+            glm::vec2 CellSize = {1.0f, 1.0f};
+            std::unordered_map<uint32_t, std::vector<EntityID>> Nodes; // Nœuds occupés uniquement
+            size_t Count = 0;
+        };
+
+        struct Entry {
+            AABB Bounds;
+            int32_t Level = OutsideLevel;
+            uint32_t Key = 0;
+            bool Alive = false;
+        };
+
+        static uint32_t MakeKey(int32_t x, int32_t y) {
+            return (uint32_t)x | ((uint32_t)y << 16);
+        }
+
+        static int32_t CellIndex(float value, float origin, float cellSize, uint32_t resolution) {
+            int32_t index = (int32_t)std::floor((value - origin) / cellSize);
+            return std::max(0, std::min(index, (int32_t)resolution - 1));
+        }
+
+        // Calcule le niveau et la cellule d'une boîte
+        void Locate(const AABB& bounds, int32_t& outLevel, uint32_t& outKey) const {
+            if (!m_WorldBounds.Contains(bounds)) {
+                outLevel = OutsideLevel;
+                outKey = 0;
+                return;
+            }
+
+            glm::vec2 size = bounds.GetSize();
+            int32_t level = (int32_t)m_Levels.size() - 1;
+            while (level > 0 && (size.x > m_Levels[level].CellSize.x || size.y > m_Levels[level].CellSize.y))
+                --level;
+
+            const Level& target = m_Levels[level];
+            glm::vec2 center = bounds.GetCenter();
+            int32_t x = CellIndex(center.x, m_WorldBounds.Min.x, target.CellSize.x, target.Resolution);
+            int32_t y = CellIndex(center.y, m_WorldBounds.Min.y, target.CellSize.y, target.Resolution);
+            outLevel = level;
+            outKey = MakeKey(x, y);
+        }
+
+        void AddToNode(EntityID entity, int32_t level, uint32_t key) {
+            if (level == OutsideLevel) {
+                m_Outside.push_back(entity);
+                return;
+            }
+            m_Levels[level].Nodes[key].push_back(entity);
+            m_Levels[level].Count++;
+        }
+
+        static void EraseOne(std::vector<EntityID>& node, EntityID entity) {
+            for (size_t i = 0; i < node.size(); ++i) {
+                if (node[i] == entity) {
+                    node[i] = node.back();
+                    node.pop_back();
+                    return;
+                }
+            }
+        }
+
+        void RemoveFromNode(EntityID entity, int32_t level, uint32_t key) {
+            if (level == OutsideLevel) {
+                EraseOne(m_Outside, entity);
+                return;
+            }
+            Level& target = m_Levels[level];
+            auto it = target.Nodes.find(key);
+            if (it == target.Nodes.end())
+                return;
+            EraseOne(it->second, entity);
+            if (it->second.empty())
+                target.Nodes.erase(it);
+            target.Count--;
+        }
+
+        void CollectOverlapping(const std::vector<EntityID>& node, const AABB& range, std::vector<EntityID>& out) const {
+            for (EntityID entity : node) {
+                if (m_Entries[entity].Bounds.Overlaps(range))
+                    out.push_back(entity);
+            }
+        }
+
+        void GrowContentBounds(const AABB& bounds) {
+            if (!m_HasContent) {
+                m_ContentBounds = bounds;
+                m_HasContent = true;
+            } else {
+                m_ContentBounds.Merge(bounds);
+            }
+        }
+
+        AABB m_WorldBounds;
+        std::vector<Level> m_Levels;
+        std::vector<EntityID> m_Outside;
+        std::vector<Entry> m_Entries; // Indexé par EntityID
+
+        size_t m_Size = 0;
+        AABB m_ContentBounds;
+        bool m_HasContent = false;
+    };
+
+}} // namespace Tesseract::ECS
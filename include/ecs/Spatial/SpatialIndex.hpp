@@ -0,0 +1,129 @@
+#pragma once
+
+#include "ecs/Core.hpp"
+#include "ecs/Spatial/AABB.hpp"
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+namespace Tesseract {
+namespace ECS {
+
+    // Type de structure d'accélération spatiale
+    enum class SpatialIndexType {
+        Auto = 0,       // Choisi selon la densité de la scène
+        UniformGrid,    // Grille uniforme hachée : tailles homogènes, scène dense
+        LooseQuadtree   // Quadtree lâche : tailles hétérogènes ou scène clairsemée
+    };
+
+    inline const char* SpatialIndexTypeToString(SpatialIndexType type) {
+        switch (type) {
+            case SpatialIndexType::Auto:          return "Auto";
+            case SpatialIndexType::UniformGrid:   return "UniformGrid";
+            case SpatialIndexType::LooseQuadtree: return "LooseQuadtree";
+        }
+        return "Unknown";
+    }
+
+    /**
+     * @brief Choisit la structure adaptée à la scène
+     * @param count Nombre d'entités indexées
+     * @param sceneBounds Boîte englobant toutes les entités
+     * @param meanExtent Taille moyenne (plus grande dimension) des entités
+     * @param maxExtent Taille maximale des entités
+     * @return UniformGrid pour une scène dense aux tailles homogènes, LooseQuadtree sinon
+     */
+    inline SpatialIndexType ChooseSpatialIndexType(size_t count, const AABB& sceneBounds, float meanExtent, float maxExtent) {
+        if (count == 0 || meanExtent <= 0.0f)
+            return SpatialIndexType::UniformGrid;
+
+        // Tailles très hétérogènes : une cellule de grille unique ne convient à personne
+        if (maxExtent > 4.0f * meanExtent)
+            return SpatialIndexType::LooseQuadtree;
+
+        // Fraction de la scène couverte par les entités : très faible = scène clairsemée/groupée
+        float area = std::max(sceneBounds.GetArea(), meanExtent * meanExtent);
+        float coverage = (float)count * meanExtent * meanExtent / area;
+        return coverage < 0.01f ? SpatialIndexType::LooseQuadtree : SpatialIndexType::UniformGrid;
+    }
+
+    /**
+     * @class ISpatialIndex
+     * @brief Interface commune des index spatiaux 2D (grille uniforme, quadtree lâche)
+     *
+     * Les entités sont indexées par leur AABB. Les requêtes ne sont pas thread-safe
+     * entre elles (elles réutilisent des tampons internes).
+     */
+    class ISpatialIndex {
+    public:
+        virtual ~ISpatialIndex() = default;
+
+        virtual SpatialIndexType GetType() const = 0;
+
+        virtual void Insert(EntityID entity, const AABB& bounds) = 0;
+        // Met à jour la boîte d'une entité (ne touche la structure que si la cellule change)
+        virtual void Update(EntityID entity, const AABB& bounds) = 0;
+        virtual void Remove(EntityID entity) = 0;
+        virtual void Clear() = 0;
+
+        virtual bool Contains(EntityID entity) const = 0;
+        virtual const AABB& GetBounds(EntityID entity) const = 0;
+        virtual size_t GetSize() const = 0;
+
+        // Boîte (conservatrice) englobant tout le contenu indexé
+        virtual AABB GetContentBounds() const = 0;
+
+        // Ajoute à 'out' les entités dont l'AABB chevauche 'range'
+        virtual void QueryRange(const AABB& range, std::vector<EntityID>& out) const = 0;
+        // Ajoute à 'out' les entités dont l'AABB contient 'point'
+        virtual void QueryPoint(const glm::vec2& point, std::vector<EntityID>& out) const = 0;
+
+        /**
+         * @brief Trouve l'entité dont l'AABB est la plus proche d'un point
+         * @param point Point de recherche
+         * @param outEntity Entité trouvée
+         * @param maxDistance Distance maximale de recherche
+         * @return true si une entité a été trouvée
+         */
+        virtual bool QueryNearest(const glm::vec2& point, EntityID& outEntity,
+                                  float maxDistance = std::numeric_limits<float>::max()) const {
+            if (GetSize() == 0)
+                return false;
+
+            // Au-delà de cette distance il n'y a plus rien à trouver
+            AABB content = GetContentBounds();
+            glm::vec2 farthest = glm::max(glm::abs(point - content.Min), glm::abs(point - content.Max));
+            float limit = std::min(maxDistance, glm::length(farthest));
+
+            // Rayons croissants : on s'arrête dès que le meilleur candidat est dans le rayon
+            float radius = std::min(std::max(GetNearestSearchRadius(), 1e-4f), limit);
+            std::vector<EntityID>& candidates = m_NearestScratch;
+            while (true) {
+                candidates.clear();
+                QueryRange(AABB::FromCenter(point, glm::vec2(radius)), candidates);
+
+                float bestDistanceSq = std::numeric_limits<float>::max();
+                for (EntityID entity : candidates) {
+                    float distanceSq = GetBounds(entity).DistanceSquared(point);
+                    if (distanceSq < bestDistanceSq) {
+                        bestDistanceSq = distanceSq;
+                        outEntity = entity;
+                    }
+                }
+
+                if (bestDistanceSq <= radius * radius)
+                    return bestDistanceSq <= maxDistance * maxDistance;
+                if (radius >= limit)
+                    return false;
+                radius = std::min(radius * 2.0f, limit);
+            }
+        }
+
+    protected:
+        // Rayon initial de la recherche du plus proche voisin (typiquement une cellule)
+        virtual float GetNearestSearchRadius() const = 0;
+
+        mutable std::vector<EntityID> m_NearestScratch;
+    };
+
+}} // namespace Tesseract::ECS
@@ -0,0 +1,260 @@
+#pragma once
+
+#include "ecs/Spatial/SpatialIndex.hpp"
+#include <vector>
+#include <cmath>
+#include <cstdint>
+
+namespace Tesseract {
+namespace ECS {
+
+    /**
+     * @class UniformGrid
+     * @brief Grille uniforme hachée (taille de cellule fixe, monde non borné)
+     *
+     * Chaque entité est référencée dans toutes les cellules que son AABB recouvre.
+     * Les cellules sont hachées dans un tableau de buckets de taille puissance de 2 ;
+     * une collision de hachage ne coûte que des tests de chevauchement en plus.
+     * Les entités trop grandes (plus de MaxCellsPerEntity cellules) sont rangées
+     * à part et testées à chaque requête.
+     */
+    class UniformGrid : public ISpatialIndex {
+    public:
+        static constexpr int32_t MaxCellsPerEntity = 64;
+
+        explicit UniformGrid(float cellSize = 1.0f, size_t bucketCount = 4096)
+            : m_CellSize(cellSize > 0.0f ? cellSize : 1.0f), m_InvCellSize(1.0f / m_CellSize)
+        {
+            size_t count = 1;
+            while (count < bucketCount) count <<= 1;
+            m_Buckets.resize(count);
+        }
+
+        SpatialIndexType GetType() const override { return SpatialIndexType::UniformGrid; }
+        float GetCellSize() const { return m_CellSize; }
+
+        void Insert(EntityID entity, const AABB& bounds) override {
+            if (Contains(entity)) {
+                Update(entity, bounds);
+                return;
+            }
+
+            if (entity >= m_Entries.size()) {
+                m_Entries.resize((size_t)entity + 1);
+                m_QueryStamps.resize((size_t)entity + 1, 0);
+            }
+
+            Entry& entry = m_Entries[entity];
+            entry.Bounds = bounds;
+            entry.Cells = ComputeCellRange(bounds);
+            entry.Alive = true;
+            AddToCells(entity, entry.Cells);
+
+            GrowContentBounds(bounds);
+            ++m_Size;
+
+            // Garder une charge raisonnable par bucket
+            if (m_Size > m_Buckets.size() * 2)
+                Rehash(m_Buckets.size() * 4);
+        }
+
+        void Update(EntityID entity, const AABB& bounds) override {
+            if (!Contains(entity)) {
+                Insert(entity, bounds);
+                return;
+            }
+
+            Entry& entry = m_Entries[entity];
+            CellRange cells = ComputeCellRange(bounds);
+            if (cells != entry.Cells) {
+                RemoveFromCells(entity, entry.Cells);
+                AddToCells(entity, cells);
+                entry.Cells = cells;
+            }
+            entry.Bounds = bounds;
+            GrowContentBounds(bounds);
+        }
+
+        void Remove(EntityID entity) override {
+            if (!Contains(entity))
+                return;
+
+            Entry& entry = m_Entries[entity];
+            RemoveFromCells(entity, entry.Cells);
+            entry.Alive = false;
+            --m_Size;
+        }
+
+        void Clear() override {
+            for (auto& bucket : m_Buckets)
+                bucket.clear();
+            m_Oversized.clear();
+            m_Entries.clear();
+            m_QueryStamps.clear();
+            m_Size = 0;
+            m_HasContent = false;
+        }
+
+        bool Contains(EntityID entity) const override {
+            return entity < m_Entries.size() && m_Entries[entity].Alive;
+        }
+
+        const AABB& GetBounds(EntityID entity) const override { return m_Entries[entity].Bounds; }
+        size_t GetSize() const override { return m_Size; }
+        AABB GetContentBounds() const override { return m_ContentBounds; }
+
+        void QueryRange(const AABB& range, std::vector<EntityID>& out) const override {
+            if (m_Size == 0)
+                return;
+
+            uint32_t stamp = NextQueryStamp();
+            CellRange cells = ComputeCellRange(range);
+            int64_t cellCount = (int64_t)(cells.MaxX - cells.MinX + 1) * (int64_t)(cells.MaxY - cells.MinY + 1);
+
+            auto visit = [&](const std::vector<EntityID>& bucket) {
+                for (EntityID entity : bucket) {
+                    if (m_QueryStamps[entity] == stamp)
+                        continue;
+                    m_QueryStamps[entity] = stamp;
+                    if (m_Entries[entity].Bounds.Overlaps(range))
+                        out.push_back(entity);
+                }
+            };
+
+            if (cellCount > (int64_t)m_Buckets.size()) {
+                // Zone plus grande que la table : parcourir chaque bucket une seule fois
+                for (const auto& bucket : m_Buckets)
+                    visit(bucket);
+            } else {
+                for (int32_t y = cells.MinY; y <= cells.MaxY; ++y)
+                    for (int32_t x = cells.MinX; x <= cells.MaxX; ++x)
+                        visit(m_Buckets[BucketIndex(x, y)]);
+            }
+            visit(m_Oversized);
+        }
+
+        void QueryPoint(const glm::vec2& point, std::vector<EntityID>& out) const override {
+            if (m_Size == 0)
+                return;
+
+            for (EntityID entity : m_Buckets[BucketIndex(CellCoord(point.x), CellCoord(point.y))]) {
+                if (m_Entries[entity].Bounds.Contains(point))
+                    out.push_back(entity);
+            }
+            for (EntityID entity : m_Oversized) {
+                if (m_Entries[entity].Bounds.Contains(point))
+                    out.push_back(entity);
+            }
+        }
+
+    protected:
+        float GetNearestSearchRadius() const override { return m_CellSize; }
+
+    private:
+        struct CellRange {
+            int32_t MinX = 0, MinY = 0, MaxX = -1, MaxY = -1;
+
+            bool IsOversized() const {
+                return (int64_t)(MaxX - MinX + 1) * (int64_t)(MaxY - MinY + 1) > MaxCellsPerEntity;
+            }
+            bool operator==(const CellRange& o) const {
+                return MinX == o.MinX && MinY == o.MinY && MaxX == o.MaxX && MaxY == o.MaxY;
+            }
+            bool operator!=(const CellRange& o) const { return !(*this == o); }
+        };
+
+        struct Entry {
+            AABB Bounds;
+            CellRange Cells;
+            bool Alive = false;
+        };
+
+        int32_t CellCoord(float value) const {
+            return (int32_t)std::floor(value * m_InvCellSize);
+        }
+
+        CellRange ComputeCellRange(const AABB& bounds) const {
+            return { CellCoord(bounds.Min.x), CellCoord(bounds.Min.y), CellCoord(bounds.Max.x), CellCoord(bounds.Max.y) };
+        }
+
+        size_t BucketIndex(int32_t x, int32_t y) const {
+            uint32_t hash = ((uint32_t)x * 73856093u) ^ ((uint32_t)y * 19349663u);
+            return hash & (m_Buckets.size() - 1);
+        }
+
+        void AddToCells(EntityID entity, const CellRange& cells) {
+            if (cells.IsOversized()) {
+                m_Oversized.push_back(entity);
+                return;
+            }
+            for (int32_t y = cells.MinY; y <= cells.MaxY; ++y)
+                for (int32_t x = cells.MinX; x <= cells.MaxX; ++x)
+                    m_Buckets[BucketIndex(x, y)].push_back(entity);
+        }
+
+        static void EraseOne(std::vector<EntityID>& bucket, EntityID entity) {
+            for (size_t i = 0; i < bucket.size(); ++i) {
+                if (bucket[i] == entity) {
+                    bucket[i] = bucket.back();
+                    bucket.pop_back();
+                    return;
+                }
+            }
+        }
+
+        void RemoveFromCells(EntityID entity, const CellRange& cells) {
+            if (cells.IsOversized()) {
+                EraseOne(m_Oversized, entity);
+                return;
+            }
+            // Une occurrence par cellule recouverte (même si deux cellules partagent un bucket)
+            for (int32_t y = cells.MinY; y <= cells.MaxY; ++y)
+                for (int32_t x = cells.MinX; x <= cells.MaxX; ++x)
+                    EraseOne(m_Buckets[BucketIndex(x, y)], entity);
+        }
+
+        void Rehash(size_t bucketCount) {
+            m_Buckets.clear();
+            m_Buckets.resize(bucketCount);
+            m_Oversized.clear();
+            for (EntityID entity = 0; entity < (EntityID)m_Entries.size(); ++entity) {
+                if (m_Entries[entity].Alive)
+                    AddToCells(entity, m_Entries[entity].Cells);
+            }
+        }
+
+        void GrowContentBounds(const AABB& bounds) {
+            if (!m_HasContent) {
+                m_ContentBounds = bounds;
+                m_HasContent = true;
+            } else {
+                m_ContentBounds.Merge(bounds);
+            }
+        }
+
+        uint32_t NextQueryStamp() const {
+            if (++m_CurrentStamp == 0) {
+                // Débordement du compteur : réinitialiser les tampons
+                std::fill(m_QueryStamps.begin(), m_QueryStamps.end(), 0);
+                m_CurrentStamp = 1;
+            }
+            return m_CurrentStamp;
+        }
+
+        float m_CellSize;
+        float m_InvCellSize;
+
+        std::vector<std::vector<EntityID>> m_Buckets;
+        std::vector<EntityID> m_Oversized;
+        std::vector<Entry> m_Entries; // Indexé par EntityID
+
+        // Marqueurs de déduplication (une entité peut apparaître dans plusieurs cellules)
+        mutable std::vector<uint32_t> m_QueryStamps;
+        mutable uint32_t m_CurrentStamp = 0;
+
+        size_t m_Size = 0;
+        AABB m_ContentBounds;
+        bool m_HasContent = false;
+    };
+
+}} // namespace Tesseract::ECS
@@ -5,6 +5,7 @@
 #include <memory>
 #include <unordered_map>
 #include "core/Timestep.hpp"
+#include "core/Profiler.hpp"
 
 namespace Tesseract {
 namespace ECS {
@@ -92,6 +93,7 @@ namespace ECS {
         }
 
         void UpdateSystems(Timestep ts) {
+            TS_PROFILE_SCOPE("SystemManager::UpdateSystems");
             for (auto& pair : systems) {
                 auto& system = pair.second;
                 system->OnUpdate(ts);
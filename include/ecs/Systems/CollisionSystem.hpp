@@ -0,0 +1,177 @@
+#pragma once
+
+#include "ecs/System.hpp"
+#include "ecs/Components.hpp"
+#include "ecs/Collision/BroadPhase.hpp"
+#include "ecs/Collision/NarrowPhase.hpp"
+#include "core/Logger.hpp"
+#include <chrono>
+
+namespace Tesseract {
+namespace ECS {
+
+    // Forward declaration pour éviter la dépendance circulaire
+    class Registry;
+
+    // Contact entre deux entités, exposé à la logique de jeu
+    struct EntityContact {
+        EntityID A;
+        EntityID B;
+        glm::vec2 Normal; // De A vers B
+        float Penetration;
+        bool IsTrigger;
+    };
+
+    /**
+     * @class CollisionSystem
+     * @brief Détection et résolution des collisions entre entités
+     *
+     * Chaque frame : collecte des formes dans des tableaux contigus, phase large
+     * (sweep and prune ou hachage spatial), phase étroite, puis résolution simple
+     * des contacts (séparation et rebond) pour les entités ayant une vitesse.
+     * Les entités sans VelocityComponent sont statiques.
+     */
+    class CollisionSystem : public System {
+    public:
+        struct Statistics {
+            uint32_t BodyCount = 0;
+            uint32_t PairCount = 0;
+            uint32_t ContactCount = 0;
+            float BroadPhaseMs = 0.0f;
+            float NarrowPhaseMs = 0.0f;
+        };
+
+        CollisionSystem() = default;
+
+        virtual void OnUpdate([[maybe_unused]] Timestep ts) override {
+            TS_PROFILE_SCOPE("CollisionSystem::OnUpdate");
+            try {
+                if (!m_Registry)
+                    return;
+
+                using Clock = std::chrono::steady_clock;
+
+                {
+                    TS_PROFILE_SCOPE("CollisionSystem::GatherShapes");
+                    GatherShapes();
+                }
+
+                auto start = Clock::now();
+                const auto& pairs = m_BroadPhase.FindPairs(m_Bounds);
+                auto broadEnd = Clock::now();
+                const auto& contacts = m_NarrowPhase.Run(m_Shapes, pairs);
+                auto narrowEnd = Clock::now();
+
+                m_Stats.BodyCount = (uint32_t)m_Entities.size();
+                m_Stats.PairCount = (uint32_t)pairs.size();
+                m_Stats.ContactCount = (uint32_t)contacts.size();
+                m_Stats.BroadPhaseMs = std::chrono::duration<float, std::milli>(broadEnd - start).count();
+                m_Stats.NarrowPhaseMs = std::chrono::duration<float, std::milli>(narrowEnd - broadEnd).count();
+
+                ResolveContacts(contacts);
+            } catch (const std::exception& e) {
+                Logger::Error("Exception dans CollisionSystem::OnUpdate: {}", e.what());
+                // Ne pas relancer l'exception pour continuer l'exécution
+            }
+        }
+
+        void SetRegistry(Registry* registry) {
+            m_Registry = registry;
+        }
+
+        void SetBroadPhaseMethod(BroadPhaseMethod method) { m_BroadPhase.SetMethod(method); }
+        BroadPhaseMethod GetBroadPhaseMethod() const { return m_BroadPhase.GetMethod(); }
+
+        // Contacts de la dernière mise à jour
+        const std::vector<EntityContact>& GetContacts() const { return m_EntityContacts; }
+        const Statistics& GetStats() const { return m_Stats; }
+
+    private:
+        void GatherShapes() {
+            m_Entities.clear();
+            m_Shapes.clear();
+            m_Bounds.clear();
+            m_Colliders.clear();
+
+            for (auto entity : GetEntities()) {
+                if (!m_Registry->HasComponent<TransformComponent>(entity) ||
+                    !m_Registry->HasComponent<ColliderComponent>(entity))
+                    continue;
+
+                const auto& transform = m_Registry->GetComponent<TransformComponent>(entity);
+                const auto& collider = m_Registry->GetComponent<ColliderComponent>(entity);
+
+                CollisionShape shape;
+                shape.Shape = collider.Shape;
+                shape.Center = glm::vec2(transform.Position.x, transform.Position.y) + collider.Offset;
+                shape.HalfExtents = collider.HalfExtents;
+                shape.Radius = collider.Radius;
+
+                m_Entities.push_back(entity);
+                m_Shapes.push_back(shape);
+                m_Bounds.push_back(shape.GetBounds());
+                m_Colliders.push_back(&collider);
+            }
+        }
+
+        void ResolveContacts(const std::vector<Contact>& contacts) {
+            m_EntityContacts.clear();
+            m_EntityContacts.reserve(contacts.size());
+
+            for (const Contact& contact : contacts) {
+                EntityID a = m_Entities[contact.A];
+                EntityID b = m_Entities[contact.B];
+                const ColliderComponent& colliderA = *m_Colliders[contact.A];
+                const ColliderComponent& colliderB = *m_Colliders[contact.B];
+                bool trigger = colliderA.IsTrigger || colliderB.IsTrigger;
+
+                m_EntityContacts.push_back({ a, b, contact.Normal, contact.Penetration, trigger });
+                if (trigger)
+                    continue;
+
+                // Masse unitaire pour les corps dynamiques, infinie pour les statiques
+                VelocityComponent* velocityA = m_Registry->HasComponent<VelocityComponent>(a) ? &m_Registry->GetComponent<VelocityComponent>(a) : nullptr;
+                VelocityComponent* velocityB = m_Registry->HasComponent<VelocityComponent>(b) ? &m_Registry->GetComponent<VelocityComponent>(b) : nullptr;
+                float inverseMassA = velocityA ? 1.0f : 0.0f;
+                float inverseMassB = velocityB ? 1.0f : 0.0f;
+                float inverseMassSum = inverseMassA + inverseMassB;
+                if (inverseMassSum == 0.0f)
+                    continue;
+
+                // Séparation des corps proportionnellement à leur masse inverse
+                glm::vec2 correction = contact.Normal * (contact.Penetration / inverseMassSum);
+                auto& transformA = m_Registry->GetComponent<TransformComponent>(a);
+                auto& transformB = m_Registry->GetComponent<TransformComponent>(b);
+                transformA.Position -= glm::vec3(correction * inverseMassA, 0.0f);
+                transformB.Position += glm::vec3(correction * inverseMassB, 0.0f);
+
+                // Impulsion le long de la normale si les corps se rapprochent
+                glm::vec2 vA = velocityA ? glm::vec2(velocityA->Velocity) : glm::vec2(0.0f);
+                glm::vec2 vB = velocityB ? glm::vec2(velocityB->Velocity) : glm::vec2(0.0f);
+                float approach = glm::dot(vB - vA, contact.Normal);
+                if (approach >= 0.0f)
+                    continue;
+
+                float restitution = std::min(colliderA.Restitution, colliderB.Restitution);
+                float impulse = -(1.0f + restitution) * approach / inverseMassSum;
+                if (velocityA) velocityA->Velocity -= glm::vec3(contact.Normal * (impulse * inverseMassA), 0.0f);
+                if (velocityB) velocityB->Velocity += glm::vec3(contact.Normal * (impulse * inverseMassB), 0.0f);
+            }
+        }
+
+        Registry* m_Registry = nullptr;
+
+        BroadPhase m_BroadPhase;
+        NarrowPhase m_NarrowPhase;
+
+        // Données contiguës de la frame courante (même indice = même corps)
+        std::vector<EntityID> m_Entities;
+        std::vector<CollisionShape> m_Shapes;
+        std::vector<AABB> m_Bounds;
+        std::vector<const ColliderComponent*> m_Colliders;
+
+        std::vector<EntityContact> m_EntityContacts;
+        Statistics m_Stats;
+    };
+
+}} // namespace Tesseract::ECS
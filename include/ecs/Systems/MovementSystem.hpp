@@ -16,6 +16,7 @@ namespace ECS {
         MovementSystem() = default;
 
         virtual void OnUpdate(Timestep ts) override {
+            TS_PROFILE_SCOPE("MovementSystem::OnUpdate");
             try {
                 // Parcourir toutes les entités avec Transform et Velocity
                 for (auto entity : GetEntities()) {
@@ -27,6 +28,10 @@ namespace ECS {
                     auto& transform = m_Registry->GetComponent<TransformComponent>(entity);
                     auto& velocity = m_Registry->GetComponent<VelocityComponent>(entity);
 
+                    // Mémoriser l'état précédent pour l'interpolation du rendu
+                    velocity.PreviousPosition = transform.Position;
+                    velocity.HasPreviousPosition = true;
+
                     // Mettre à jour la position en fonction de la vitesse
                     transform.Position += velocity.Velocity * (float)ts;
 
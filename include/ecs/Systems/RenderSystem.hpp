@@ -18,6 +18,7 @@ namespace ECS {
         RenderSystem() : m_Camera(-1.0f, 1.0f, -1.0f, 1.0f) {}
 
         virtual void OnUpdate([[maybe_unused]] Timestep ts) override {
+            TS_PROFILE_SCOPE("RenderSystem::OnUpdate");
             try {
                 // Trouver la caméra principale si définie
                 OrthographicCamera* mainCamera = nullptr;
@@ -51,7 +52,8 @@ namespace ECS {
                 // Commencer le rendu de la scène
                 Renderer2D::BeginScene(*mainCamera);
 
-                // Rendre toutes les entités avec Transform et Sprite
+                // Collecte des quads visibles, générés ensuite en parallèle par Renderer2D
+                m_Instances.clear();
                 for (auto entity : GetEntities()) {
                     if (!m_Registry ||
                         !m_Registry->HasComponent<TransformComponent>(entity) ||
@@ -61,21 +63,33 @@ namespace ECS {
                     auto& transform = m_Registry->GetComponent<TransformComponent>(entity);
                     auto& sprite = m_Registry->GetComponent<SpriteComponent>(entity);
 
-                    // Si l'entité a une texture
-                    if (sprite.Texture) {
-                        // TODO: Implémenter le rendu de textures quand Renderer2D le supportera
-                        // Pour l'instant, on utilise juste la couleur
-                        Renderer2D::DrawQuad(transform.Position, transform.Scale, sprite.Color);
+                    // Entités simulées : position interpolée entre les deux derniers ticks
+                    glm::vec3 position = transform.Position;
+                    if (m_Registry->HasComponent<VelocityComponent>(entity)) {
+                        const auto& velocity = m_Registry->GetComponent<VelocityComponent>(entity);
+                        if (velocity.HasPreviousPosition)
+                            position = glm::mix(velocity.PreviousPosition, transform.Position, m_InterpolationAlpha);
+                    }
+
+                    Renderer2D::QuadInstance quad;
+                    quad.Size = glm::vec2(transform.Scale);
+                    quad.Color = sprite.Color;
+                    quad.Texture = sprite.Texture.get();
+                    quad.UVMin = sprite.UVMin;
+                    quad.UVMax = sprite.UVMax;
+                    quad.TilingFactor = sprite.TilingFactor;
+
+                    if (transform.Rotation.z != 0.0f) {
+                        // Quad tourné : la position est le centre
+                        quad.Position = position;
+                        quad.Rotation = transform.Rotation.z;
                     } else {
-                        // Dessiner un quad coloré
-                        if (transform.Rotation.z != 0.0f) {
-                            Renderer2D::DrawRotatedQuad(transform.Position, transform.Scale,
-                                                    transform.Rotation.z, sprite.Color);
-                        } else {
-                            Renderer2D::DrawQuad(transform.Position, transform.Scale, sprite.Color);
-                        }
+                        // Quad simple : la position est le coin inférieur gauche
+                        quad.Position = { position.x + quad.Size.x * 0.5f, position.y + quad.Size.y * 0.5f, position.z };
                     }
+                    m_Instances.push_back(quad);
                 }
+                Renderer2D::DrawQuads(m_Instances);
 
                 // Terminer le rendu de la scène
                 Renderer2D::EndScene();
@@ -93,9 +107,16 @@ namespace ECS {
             m_Camera = camera;
         }
 
+        // Fraction du tick de simulation écoulée (voir Application::GetFixedUpdateAlpha)
+        void SetInterpolationAlpha(float alpha) {
+            m_InterpolationAlpha = alpha;
+        }
+
     private:
         Registry* m_Registry = nullptr;
         OrthographicCamera m_Camera;
+        float m_InterpolationAlpha = 1.0f;
+        std::vector<Renderer2D::QuadInstance> m_Instances;
     };
 
 }} // namespace Tesseract::ECS
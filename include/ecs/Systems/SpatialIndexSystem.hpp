@@ -0,0 +1,222 @@
+#pragma once
+
+#include "ecs/System.hpp"
+#include "ecs/Components.hpp"
+#include "ecs/Spatial/UniformGrid.hpp"
+#include "ecs/Spatial/LooseQuadtree.hpp"
+#include "core/Core.hpp"
+#include "core/Logger.hpp"
+#include <cmath>
+
+namespace Tesseract {
+namespace ECS {
+
+    // Forward declaration pour éviter la dépendance circulaire
+    class Registry;
+
+    // Boîte englobante d'une entité telle que dessinée par le RenderSystem :
+    // quad posé à partir de Position sans rotation, centré sur Position sinon
+    inline AABB ComputeEntityBounds(const TransformComponent& transform) {
+        glm::vec2 position = { transform.Position.x, transform.Position.y };
+        glm::vec2 size = { std::abs(transform.Scale.x), std::abs(transform.Scale.y) };
+
+        if (transform.Rotation.z == 0.0f)
+            return AABB(position, position + size);
+
+        float c = std::abs(std::cos(transform.Rotation.z));
+        float s = std::abs(std::sin(transform.Rotation.z));
+        glm::vec2 halfExtents = 0.5f * glm::vec2(size.x * c + size.y * s, size.x * s + size.y * c);
+        return AABB::FromCenter(position, halfExtents);
+    }
+
+    // Test exact (quad orienté) d'un point contre une entité
+    inline bool EntityContainsPoint(const TransformComponent& transform, const glm::vec2& point) {
+        if (transform.Rotation.z == 0.0f)
+            return ComputeEntityBounds(transform).Contains(point);
+
+        // Ramener le point dans le repère local du quad
+        glm::vec2 local = point - glm::vec2(transform.Position.x, transform.Position.y);
+        float c = std::cos(-transform.Rotation.z);
+        float s = std::sin(-transform.Rotation.z);
+        local = { local.x * c - local.y * s, local.x * s + local.y * c };
+        return std::abs(local.x) <= 0.5f * std::abs(transform.Scale.x) &&
+               std::abs(local.y) <= 0.5f * std::abs(transform.Scale.y);
+    }
+
+    /**
+     * @class SpatialIndexSystem
+     * @brief Maintient un index spatial des entités possédant un TransformComponent
+     *
+     * L'index est mis à jour de façon incrémentale dans OnUpdate : seules les
+     * entités dont la boîte a changé sont déplacées dans la structure. En mode
+     * Auto, la structure (grille uniforme ou quadtree lâche) est choisie d'après
+     * la densité de la scène et reconstruite quand la population double ou diminue
+     * de moitié.
+     */
+    class SpatialIndexSystem : public System {
+    public:
+        SpatialIndexSystem() = default;
+
+        virtual void OnEntityRemoved(EntityID entity) override {
+            if (m_Index)
+                m_Index->Remove(entity);
+        }
+
+        virtual void OnUpdate([[maybe_unused]] Timestep ts) override {
+            TS_PROFILE_SCOPE("SpatialIndexSystem::OnUpdate");
+            try {
+                if (!m_Registry)
+                    return;
+
+                if (NeedsRebuild())
+                    Rebuild();
+
+                m_UpdatedCount = 0;
+                for (auto entity : GetEntities()) {
+                    if (!m_Registry->HasComponent<TransformComponent>(entity))
+                        continue;
+
+                    AABB bounds = ComputeEntityBounds(m_Registry->GetComponent<TransformComponent>(entity));
+                    if (!m_Index->Contains(entity)) {
+                        m_Index->Insert(entity, bounds);
+                        ++m_UpdatedCount;
+                    } else if (m_Index->GetBounds(entity) != bounds) {
+                        m_Index->Update(entity, bounds);
+                        ++m_UpdatedCount;
+                    }
+                }
+            } catch (const std::exception& e) {
+                Logger::Error("Exception dans SpatialIndexSystem::OnUpdate: {}", e.what());
+                // Ne pas relancer l'exception pour continuer l'exécution
+            }
+        }
+
+        void SetRegistry(Registry* registry) {
+            m_Registry = registry;
+        }
+
+        /**
+         * @brief Force le type de structure (Auto pour le choix automatique)
+         * @param type Type de structure souhaité
+         */
+        void SetIndexType(SpatialIndexType type) {
+            m_RequestedType = type;
+            m_Index.reset(); // Reconstruction au prochain OnUpdate
+        }
+
+        SpatialIndexType GetRequestedType() const { return m_RequestedType; }
+        SpatialIndexType GetActiveType() const { return m_Index ? m_Index->GetType() : SpatialIndexType::Auto; }
+        const ISpatialIndex* GetIndex() const { return m_Index.get(); }
+
+        // Nombre d'entités déplacées dans l'index lors du dernier OnUpdate
+        uint32_t GetUpdatedCount() const { return m_UpdatedCount; }
+
+        void QueryRange(const AABB& range, std::vector<EntityID>& out) const {
+            if (m_Index)
+                m_Index->QueryRange(range, out);
+        }
+
+        bool QueryNearest(const glm::vec2& point, EntityID& outEntity,
+                          float maxDistance = std::numeric_limits<float>::max()) const {
+            return m_Index && m_Index->QueryNearest(point, outEntity, maxDistance);
+        }
+
+        /**
+         * @brief Trouve l'entité visible sous un point (coordonnées monde)
+         * @param point Point en coordonnées monde
+         * @param outEntity Entité trouvée (la plus en avant si plusieurs se chevauchent)
+         * @return true si une entité a été trouvée
+         */
+        bool Pick(const glm::vec2& point, EntityID& outEntity) {
+            if (!m_Index || !m_Registry)
+                return false;
+
+            m_PickScratch.clear();
+            m_Index->QueryPoint(point, m_PickScratch);
+
+            bool found = false;
+            float bestDepth = -std::numeric_limits<float>::max();
+            for (EntityID entity : m_PickScratch) {
+                const auto& transform = m_Registry->GetComponent<TransformComponent>(entity);
+                if (!EntityContainsPoint(transform, point))
+                    continue;
+                if (!found || transform.Position.z >= bestDepth) {
+                    bestDepth = transform.Position.z;
+                    outEntity = entity;
+                    found = true;
+                }
+            }
+            return found;
+        }
+
+    private:
+        bool NeedsRebuild() const {
+            if (!m_Index)
+                return true;
+            if (m_RequestedType != SpatialIndexType::Auto)
+                return false;
+
+            // Réévaluer le choix de structure quand la population change d'ordre de grandeur
+            size_t count = GetEntities().size();
+            return count > m_BuiltCount * 2 + 16 || count * 2 + 16 < m_BuiltCount;
+        }
+
+        void Rebuild() {
+            // Statistiques de la scène pour dimensionner la structure
+            AABB sceneBounds;
+            float meanExtent = 0.0f;
+            float maxExtent = 0.0f;
+            size_t count = 0;
+            for (auto entity : GetEntities()) {
+                if (!m_Registry->HasComponent<TransformComponent>(entity))
+                    continue;
+
+                AABB bounds = ComputeEntityBounds(m_Registry->GetComponent<TransformComponent>(entity));
+                glm::vec2 size = bounds.GetSize();
+                float extent = std::max(size.x, size.y);
+                meanExtent += extent;
+                maxExtent = std::max(maxExtent, extent);
+                if (count++ == 0)
+                    sceneBounds = bounds;
+                else
+                    sceneBounds.Merge(bounds);
+            }
+            meanExtent = count > 0 ? meanExtent / (float)count : 1.0f;
+            if (meanExtent <= 0.0f)
+                meanExtent = 1.0f;
+
+            SpatialIndexType type = m_RequestedType;
+            if (type == SpatialIndexType::Auto)
+                type = ChooseSpatialIndexType(count, sceneBounds, meanExtent, maxExtent);
+
+            if (type == SpatialIndexType::LooseQuadtree) {
+                // Monde deux fois plus grand que la scène pour absorber les déplacements
+                glm::vec2 center = sceneBounds.GetCenter();
+                glm::vec2 size = sceneBounds.GetSize();
+                float half = std::max(std::max(size.x, size.y), meanExtent);
+                AABB world = AABB::FromCenter(center, glm::vec2(half));
+
+                // Profondeur telle que les plus petites cellules aient la taille moyenne des entités
+                uint32_t depth = 0;
+                while (depth < LooseQuadtree::MaxSupportedDepth && 2.0f * half / (float)(1 << (depth + 1)) >= meanExtent)
+                    ++depth;
+                m_Index = CreateScope<LooseQuadtree>(world, depth);
+            } else {
+                m_Index = CreateScope<UniformGrid>(2.0f * meanExtent, std::max<size_t>(count, 1024));
+            }
+
+            m_BuiltCount = count;
+            Logger::Debug("SpatialIndexSystem: index {} reconstruit ({} entités)", SpatialIndexTypeToString(type), count);
+        }
+
+        Registry* m_Registry = nullptr;
+
+        SpatialIndexType m_RequestedType = SpatialIndexType::Auto;
+        Scope<ISpatialIndex> m_Index;
+        size_t m_BuiltCount = 0;
+        uint32_t m_UpdatedCount = 0;
+
+        std::vector<EntityID> m_PickScratch;
+    };
+
+}} // namespace Tesseract::ECS
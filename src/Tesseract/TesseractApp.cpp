@@ -5,7 +5,16 @@
 #include "Tesseract/TesseractLayer.hpp"
 
 namespace Tesseract {
-    TesseractApp::TesseractApp() : Application("Tesseract Sandbox") {
+    static ApplicationSpecification MakeSandboxSpecification() {
+        ApplicationSpecification specification;
+        specification.Name = "Tesseract Sandbox";
+        specification.FixedTickRate = 60;
+        specification.MaxFixedStepsPerFrame = 5;
+        specification.ThreadedRendering = true;
+        return specification;
+    }
+
+    TesseractApp::TesseractApp() : Application(MakeSandboxSpecification()) {
         TS_INFO("TesseractApp created!");
         PushLayer(CreateRef<TesseractLayer>());
     }
@@ -1,8 +1,13 @@
 #include "Tesseract/TesseractLayer.hpp"
 #include "core/Input.hpp"
+#include "core/InputRecorder.hpp"
 #include "core/Logger.hpp"
 #include "core/Asset/AssetManager.hpp"
+#include "core/Application.hpp"
+#include "core/Metrics.hpp"
+#include "core/Profiler.hpp"
 #include <SDL2/SDL_scancode.h>
+#include <SDL2/SDL_gamecontroller.h>
 #include <SDL2/SDL_mouse.h>
 #include <imgui.h>
 
@@ -10,9 +15,12 @@
 #include "core/Events/KeyEvent.hpp"
 #include "core/Events/MouseEvent.hpp"
 #include "core/Timestep.hpp"
+#include "core/Renderer/GpuProfiler.hpp"
 #include "core/Renderer/RenderCommand.hpp"
 #include "core/Renderer/Renderer2D.hpp"
+#include "core/Renderer/RenderThread.hpp"
 #include <glm/gtc/type_ptr.hpp>
+#include <cstdio>
 
 namespace Tesseract {
 
@@ -40,12 +48,34 @@ namespace Tesseract {
     void TesseractLayer::OnAttach() {
         Logger::Debug("TesseractLayer attached.");
 
+        EventBus& bus = Application::Get().GetEventBus();
+        bus.Subscribe<&TesseractLayer::OnKeyPressed>(this);
+        bus.Subscribe<&TesseractLayer::OnMouseButtonPressed>(this);
+
+        // Caméra : évaluée une fois par frame lors de la capture des entrées
+        m_MoveXAction = Input::RegisterAction("CameraMoveX");
+        Input::ClearBindings(m_MoveXAction);
+        Input::BindAction(m_MoveXAction, InputBinding::Key(SDL_SCANCODE_A, -1.0f));
+        Input::BindAction(m_MoveXAction, InputBinding::Key(SDL_SCANCODE_D));
+        Input::BindAction(m_MoveXAction, InputBinding::GamepadAxis(SDL_CONTROLLER_AXIS_LEFTX));
+        m_MoveYAction = Input::RegisterAction("CameraMoveY");
+        Input::ClearBindings(m_MoveYAction);
+        Input::BindAction(m_MoveYAction, InputBinding::Key(SDL_SCANCODE_W));
+        Input::BindAction(m_MoveYAction, InputBinding::Key(SDL_SCANCODE_S, -1.0f));
+        Input::BindAction(m_MoveYAction, InputBinding::GamepadAxis(SDL_CONTROLLER_AXIS_LEFTY, -1.0f)); // Y vers le bas chez SDL
+        m_RotateAction = Input::RegisterAction("CameraRotate");
+        Input::ClearBindings(m_RotateAction);
+        Input::BindAction(m_RotateAction, InputBinding::Key(SDL_SCANCODE_Q));
+        Input::BindAction(m_RotateAction, InputBinding::Key(SDL_SCANCODE_E, -1.0f));
+        Input::BindAction(m_RotateAction, InputBinding::GamepadAxis(SDL_CONTROLLER_AXIS_RIGHTX, -1.0f));
+
         try {
             // Enregistrer les composants nécessaires
             m_Registry.RegisterComponent<ECS::TransformComponent>();
             m_Registry.RegisterComponent<ECS::SpriteComponent>();
             m_Registry.RegisterComponent<ECS::TagComponent>();
             m_Registry.RegisterComponent<ECS::VelocityComponent>();
+            m_Registry.RegisterComponent<ECS::ColliderComponent>();
 
             // Configurer le système de rendu
             m_RenderSystem = m_Registry.RegisterSystem<ECS::RenderSystem>();
@@ -72,6 +102,25 @@ namespace Tesseract {
             // Configurer le système de mouvement
             m_MovementSystem->SetRegistry(&m_Registry);
 
+            // Configurer le système de collision
+            m_CollisionSystem = m_Registry.RegisterSystem<ECS::CollisionSystem>();
+
+            ECS::ComponentSignature collisionSignature;
+            collisionSignature.set(m_Registry.GetComponentType<ECS::TransformComponent>(), true);
+            collisionSignature.set(m_Registry.GetComponentType<ECS::ColliderComponent>(), true);
+            m_Registry.SetSystemSignature<ECS::CollisionSystem>(collisionSignature);
+
+            m_CollisionSystem->SetRegistry(&m_Registry);
+
+            // Configurer l'index spatial (toutes les entités positionnées)
+            m_SpatialIndexSystem = m_Registry.RegisterSystem<ECS::SpatialIndexSystem>();
+
+            ECS::ComponentSignature spatialSignature;
+            spatialSignature.set(m_Registry.GetComponentType<ECS::TransformComponent>(), true);
+            m_Registry.SetSystemSignature<ECS::SpatialIndexSystem>(spatialSignature);
+
+            m_SpatialIndexSystem->SetRegistry(&m_Registry);
+
             // Créer les entités de démo
             CreateDemoEntities();
 
@@ -85,6 +134,7 @@ namespace Tesseract {
     }
 
     void TesseractLayer::OnDetach() {
+        Application::Get().GetEventBus().Unsubscribe(this);
         Logger::Debug("TesseractLayer detached.");
     }
 
@@ -103,6 +153,9 @@ namespace Tesseract {
             auto& redSprite = m_Registry.GetComponent<ECS::SpriteComponent>(redSquare);
             redSprite.Color = {0.8f, 0.2f, 0.3f, 1.0f};
 
+            // Les quads sans rotation sont dessinés à partir de Position : collider centré sur le quad
+            m_Registry.AddComponent<ECS::ColliderComponent>(redSquare, ECS::ColliderComponent(glm::vec2(0.4f, 0.4f), glm::vec2(0.4f, 0.4f)));
+
             // 2. Un carré bleu à droite
             auto blueSquare = m_Registry.CreateEntity();
             m_Registry.AddComponent<ECS::TagComponent>(blueSquare, ECS::TagComponent("BlueSquare"));
@@ -116,6 +169,8 @@ namespace Tesseract {
             auto& blueSprite = m_Registry.GetComponent<ECS::SpriteComponent>(blueSquare);
             blueSprite.Color = m_SquareColor;
 
+            m_Registry.AddComponent<ECS::ColliderComponent>(blueSquare, ECS::ColliderComponent(glm::vec2(0.25f, 0.375f), glm::vec2(0.25f, 0.375f)));
+
             // 3. Un carré vert pivoté au centre
             auto greenSquare = m_Registry.CreateEntity();
             m_Registry.AddComponent<ECS::TagComponent>(greenSquare, ECS::TagComponent("GreenSquare"));
@@ -130,6 +185,9 @@ namespace Tesseract {
             auto& greenSprite = m_Registry.GetComponent<ECS::SpriteComponent>(greenSquare);
             greenSprite.Color = {0.2f, 0.8f, 0.2f, 1.0f};
 
+            // Quad pivoté (centré sur Position) : approximé par un cercle
+            m_Registry.AddComponent<ECS::ColliderComponent>(greenSquare, ECS::ColliderComponent(0.3f));
+
             Logger::Debug("Entités de démo créées avec succès");
         } catch (const std::exception& e) {
             Logger::Error("Exception dans CreateDemoEntities: {}", e.what());
@@ -158,6 +216,8 @@ namespace Tesseract {
             auto& velocity_comp = m_Registry.GetComponent<ECS::VelocityComponent>(entity);
             velocity_comp.Velocity = velocity;
 
+            m_Registry.AddComponent<ECS::ColliderComponent>(entity, ECS::ColliderComponent(glm::vec2(0.1f, 0.1f), glm::vec2(0.1f, 0.1f)));
+
             Logger::Debug("Entité en mouvement créée avec succès: {}", entity);
         } catch (const std::exception& e) {
             Logger::Error("Exception dans CreateMovingEntity: {}", e.what());
@@ -173,12 +233,10 @@ namespace Tesseract {
         float cameraMoveSpeed = 5.0f;
         float cameraRotationSpeed = 180.0f;
 
-        if (Input::IsKeyPressed(SDL_SCANCODE_A))      position.x -= cameraMoveSpeed * ts;
-        else if (Input::IsKeyPressed(SDL_SCANCODE_D)) position.x += cameraMoveSpeed * ts;
-        if (Input::IsKeyPressed(SDL_SCANCODE_W))      position.y += cameraMoveSpeed * ts;
-        else if (Input::IsKeyPressed(SDL_SCANCODE_S)) position.y -= cameraMoveSpeed * ts;
-        if (Input::IsKeyPressed(SDL_SCANCODE_Q))      rotation += cameraRotationSpeed * ts;
-        if (Input::IsKeyPressed(SDL_SCANCODE_E))      rotation -= cameraRotationSpeed * ts;
+        // Valeurs [-1, 1] lues dans l'instantané de la frame (clavier ou manette)
+        position.x += Input::GetActionValue(m_MoveXAction) * cameraMoveSpeed * ts;
+        position.y += Input::GetActionValue(m_MoveYAction) * cameraMoveSpeed * ts;
+        rotation += Input::GetActionValue(m_RotateAction) * cameraRotationSpeed * ts;
 
         m_Camera.SetPosition(position); // Mettre à jour la position
         m_Camera.SetRotation(rotation); // Mettre à jour la rotation
@@ -186,8 +244,8 @@ namespace Tesseract {
         // Mettre à jour la caméra du système de rendu ECS
         m_RenderSystem->SetCamera(m_Camera);
 
-        // --- Mise à jour des systèmes ECS ---
-        m_MovementSystem->OnUpdate(ts);
+        // La simulation ECS tourne dans OnFixedUpdate ; le rendu interpole entre les deux derniers ticks
+        m_RenderSystem->SetInterpolationAlpha(Application::Get().GetFixedUpdateAlpha());
 
         // --- PAS DE CODE IMGUI ICI ---
 
@@ -196,7 +254,11 @@ namespace Tesseract {
         RenderCommand::Clear();
 
         // --- Utiliser notre système de rendu directement ---
-        m_RenderSystem->OnUpdate(ts);
+        static Metric& renderSystemTime = Metrics::GetTimer("System.Render");
+        {
+            Metric::ScopedTimer timer(renderSystemTime);
+            m_RenderSystem->OnUpdate(ts);
+        }
 
         // Alternative : continuer à utiliser l'approche directe pour comparaison
         if (false) { // Désactivé pour l'instant
@@ -209,6 +271,28 @@ namespace Tesseract {
         }
     }
 
+    void TesseractLayer::OnFixedUpdate(Timestep fixedTs) {
+        // --- Mise à jour des systèmes ECS (pas fixe) ---
+        // Timers cumulés sur la frame (plusieurs ticks possibles)
+        static Metric& movementTime = Metrics::GetTimer("System.Movement");
+        static Metric& collisionTime = Metrics::GetTimer("System.Collision");
+        static Metric& spatialIndexTime = Metrics::GetTimer("System.SpatialIndex");
+        static Metric& entityCount = Metrics::GetGauge("ECS.Entities");
+        {
+            Metric::ScopedTimer timer(movementTime);
+            m_MovementSystem->OnUpdate(fixedTs);
+        }
+        {
+            Metric::ScopedTimer timer(collisionTime);
+            m_CollisionSystem->OnUpdate(fixedTs);
+        }
+        {
+            Metric::ScopedTimer timer(spatialIndexTime);
+            m_SpatialIndexSystem->OnUpdate(fixedTs); // Après le mouvement : l'index reflète les positions du tick
+        }
+        entityCount.Set((float)m_Registry.GetEntityCount());
+    }
+
     void TesseractLayer::OnImGuiRender() {
         // --- TOUT LE CODE IMGUI POUR CETTE COUCHE ICI ---
 
@@ -303,6 +387,21 @@ namespace Tesseract {
 
             ImGui::Separator();
 
+            // Index spatial et sélection à la souris
+            if (const ECS::ISpatialIndex* index = m_SpatialIndexSystem->GetIndex()) {
+                ImGui::Text("Spatial Index: %s (%zu entities, %u updated)",
+                            ECS::SpatialIndexTypeToString(index->GetType()), index->GetSize(),
+                            m_SpatialIndexSystem->GetUpdatedCount());
+            }
+            if (m_HasSelectedEntity && m_Registry.HasComponent<ECS::TagComponent>(m_SelectedEntity)) {
+                ImGui::Text("Selected: %s (ID %u)",
+                            m_Registry.GetComponent<ECS::TagComponent>(m_SelectedEntity).Tag.c_str(), m_SelectedEntity);
+            } else {
+                ImGui::Text("Selected: none");
+            }
+
+            ImGui::Separator();
+
             if (ImGui::Button("Create Random Entity")) {
                 try {
                     // Créer une entité avec une position et une couleur aléatoires
@@ -378,25 +477,175 @@ namespace Tesseract {
         ImGui::Text("Quads: %d", stats.QuadCount);
         ImGui::Text("Vertices: %d", stats.GetTotalVertexCount());
         ImGui::Text("Indices: %d", stats.GetTotalIndexCount());
+        ImGui::Text("Vertex Upload: %.1f KB", stats.VertexBytes / 1024.0f);
+        ImGui::Text("Texture Binds: %d", stats.TextureBinds);
+        auto stateStats = RenderCommand::GetStateStatistics();
+        ImGui::Text("GL State Calls: %llu issued, %llu skipped",
+                    (unsigned long long)(stateStats.IssuedCalls - m_LastStateStats.IssuedCalls),
+                    (unsigned long long)(stateStats.SkippedCalls - m_LastStateStats.SkippedCalls));
+        m_LastStateStats = stateStats;
+        auto assetStats = AssetManager::Get().GetAsyncStats();
+        ImGui::Text("Async Textures: %u pending, %u uploaded (%.2f ms)", assetStats.PendingCount,
+                    assetStats.UploadedLastFrame, assetStats.UploadMsLastFrame);
+        const auto& memoryStats = AssetManager::Get().GetMemoryStats();
+        ImGui::Text("Asset Memory: GPU %.1f MB, CPU %.1f MB (%u textures, %u atlases)",
+                    memoryStats.GetGPUBytes() / (1024.0f * 1024.0f), memoryStats.GetCPUBytes() / (1024.0f * 1024.0f),
+                    memoryStats.Textures.Count, memoryStats.Atlases.Count);
+
+        // Simulation à pas fixe
+        const Application& app = Application::Get();
+        ImGui::Separator();
+        ImGui::Text("Fixed Tick: %u Hz | Steps this frame: %u | Alpha: %.2f",
+                    app.GetSpecification().FixedTickRate, app.GetFixedStepsLastFrame(), app.GetFixedUpdateAlpha());
+
+        // Thread de rendu
+        if (RenderThread::IsRunning()) {
+            auto renderStats = RenderThread::GetStats();
+            ImGui::Text("Render Thread: %.3f ms | Main wait: %.3f ms", renderStats.ExecuteMs, renderStats.MainThreadWaitMs);
+            ImGui::Text("Commands: %u | Queue: %.1f KB", renderStats.CommandCount, renderStats.QueueBytes / 1024.0f);
+        } else {
+            ImGui::Text("Render Thread: off");
+        }
+
+        // Chronométrage GPU (résultats lus avec GpuProfiler::FramesInFlight frames de retard)
+        if (GpuProfiler::IsSupported()) {
+            auto gpuFrame = GpuProfiler::GetLastFrame();
+            // GPU occupé presque toute la frame : c'est lui qui limite le framerate
+            float frameMs = 1000.0f / std::max(ImGui::GetIO().Framerate, 1.0f);
+            ImGui::Text("Frame %.2f ms | GPU %.2f ms (%s-bound)", frameMs, gpuFrame.GpuMs,
+                        gpuFrame.GpuMs > frameMs * 0.9f ? "GPU" : "CPU");
+            // Zones de même nom et profondeur cumulées (un Flush par batch)
+            for (size_t i = 1; i < gpuFrame.Zones.size(); ++i) {
+                const auto& zone = gpuFrame.Zones[i];
+                bool seen = false;
+                for (size_t j = 1; j < i && !seen; ++j)
+                    seen = gpuFrame.Zones[j].Depth == zone.Depth && gpuFrame.Zones[j].Name == zone.Name;
+                if (seen)
+                    continue;
+                float totalMs = 0.0f;
+                uint32_t count = 0;
+                for (size_t j = i; j < gpuFrame.Zones.size(); ++j) {
+                    if (gpuFrame.Zones[j].Depth == zone.Depth && gpuFrame.Zones[j].Name == zone.Name) {
+                        totalMs += gpuFrame.Zones[j].DurationMs;
+                        count++;
+                    }
+                }
+                ImGui::Text("%*sGPU %s: %.3f ms (x%u)", (int)zone.Depth * 2, "", zone.Name, totalMs, count);
+            }
+        } else {
+            ImGui::Text("GPU timing: unavailable");
+        }
+
+        // Profileur CPU : trace des dernières zones (chrome://tracing, Perfetto)
+        if (Profiler::IsCompiled()) {
+            if (ImGui::Button("Capture Trace"))
+                Profiler::WriteChromeTrace("profiles/capture.json");
+        } else {
+            ImGui::TextDisabled("Profiler: off (TESSERACT_ENABLE_PROFILING)");
+        }
+
+        // Statistiques de collision
+        const auto& collisionStats = m_CollisionSystem->GetStats();
+        ImGui::Separator();
+        int method = (int)m_CollisionSystem->GetBroadPhaseMethod();
+        if (ImGui::Combo("Broad Phase", &method, "SweepAndPrune\0SpatialHash\0"))
+            m_CollisionSystem->SetBroadPhaseMethod((ECS::BroadPhaseMethod)method);
+        ImGui::Text("Bodies: %u | Pairs: %u | Contacts: %u", collisionStats.BodyCount, collisionStats.PairCount, collisionStats.ContactCount);
+        ImGui::Text("Broad: %.3f ms | Narrow: %.3f ms", collisionStats.BroadPhaseMs, collisionStats.NarrowPhaseMs);
         ImGui::End();
         Renderer2D::ResetStats(); // Remettre à zéro après affichage
+
+        if (m_ShowMetrics)
+            DrawMetricsWindow();
     }
 
-    void TesseractLayer::OnEvent(Event& event) {
-        EventDispatcher dispatcher(event);
+    void TesseractLayer::DrawMetricsWindow() {
+        ImGui::Begin("Metrics", &m_ShowMetrics);
+
+        // Graphe du temps de frame sur l'historique complet
+        static const Metric& frameTime = Metrics::GetGauge("Frame.TimeMs", "ms");
+        std::vector<float> history = frameTime.GetHistory();
+        Metric::Summary frameSummary = frameTime.GetSummary();
+        if (!history.empty()) {
+            char overlay[64];
+            snprintf(overlay, sizeof(overlay), "p99 %.2f ms | max %.2f ms", frameSummary.P99, frameSummary.Max);
+            ImGui::PlotLines("Frame (ms)", history.data(), (int)history.size(), 0, overlay,
+                             0.0f, std::max(frameSummary.Max, 1.0f), ImVec2(0, 80));
+        }
 
-        dispatcher.Dispatch<KeyPressedEvent>([](KeyPressedEvent& e) -> bool {
-            if (e.GetKeyCode() == SDL_SCANCODE_ESCAPE) {
-                Logger::Warn("Échap pressée ! (Événement géré par TesseractLayer)");
-                return true;
+        if (ImGui::BeginTable("MetricsTable", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Metric");
+            ImGui::TableSetupColumn("Last");
+            ImGui::TableSetupColumn("p50");
+            ImGui::TableSetupColumn("p95");
+            ImGui::TableSetupColumn("p99");
+            ImGui::TableSetupColumn("Max");
+            ImGui::TableHeadersRow();
+            for (const Metric* metric : Metrics::GetAll()) {
+                Metric::Summary summary = metric->GetSummary();
+                if (summary.Count == 0)
+                    continue;
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%s%s%s", metric->GetName().c_str(), metric->GetUnit().empty() ? "" : " ",
+                            metric->GetUnit().c_str());
+                const float values[] = { summary.Last, summary.P50, summary.P95, summary.P99, summary.Max };
+                for (float value : values) {
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.2f", value);
+                }
             }
-            return false;
-        });
+            ImGui::EndTable();
+        }
+
+        // Export pour le suivi des régressions
+        if (ImGui::Button("Dump CSV"))
+            Metrics::WriteCSV("metrics/metrics.csv");
+        ImGui::SameLine();
+        if (ImGui::Button("Dump JSON"))
+            Metrics::WriteJSON("metrics/metrics.json");
 
-        dispatcher.Dispatch<MouseButtonPressedEvent>([](MouseButtonPressedEvent& e) -> bool {
-            Logger::Debug("Clic souris détecté par TesseractLayer: Bouton {}", e.GetMouseButton());
+        ImGui::End();
+    }
+
+    bool TesseractLayer::OnKeyPressed(KeyPressedEvent& e) {
+        if (e.GetKeyCode() == SDL_SCANCODE_ESCAPE) {
+            Logger::Warn("Échap pressée ! (Événement géré par TesseractLayer)");
+            return true;
+        }
+        return false;
+    }
+
+    bool TesseractLayer::OnMouseButtonPressed(MouseButtonPressedEvent& e) {
+        Logger::Debug("Clic souris détecté par TesseractLayer: Bouton {}", e.GetMouseButton());
+        if (e.GetMouseButton() != SDL_BUTTON_LEFT)
             return false;
-        });
+        // Capture ImGui ignorée en rejeu (elle dépend du vrai curseur, pas de la session)
+        // et en headless, où aucun contexte ImGui n'existe
+        if (!InputRecorder::IsReplaying() && ImGui::GetCurrentContext() && ImGui::GetIO().WantCaptureMouse)
+            return false;
+
+        // Sélection de l'entité sous le curseur, à la position du clic (l'instantané
+        // d'Input date de la frame précédente pendant la distribution des événements)
+        glm::vec2 world = ScreenToWorld((float)e.GetX(), (float)e.GetY());
+        ECS::EntityID entity;
+        m_HasSelectedEntity = m_SpatialIndexSystem->Pick(world, entity);
+        if (m_HasSelectedEntity) {
+            m_SelectedEntity = entity;
+            Logger::Debug("Entité sélectionnée: {}", entity);
+        }
+        return false;
+    }
+
+    glm::vec2 TesseractLayer::ScreenToWorld(float x, float y) const {
+        Application& app = Application::Get();
+        float width = (float)std::max<uint32_t>(app.GetViewportWidth(), 1);
+        float height = (float)std::max<uint32_t>(app.GetViewportHeight(), 1);
+
+        // Pixels -> NDC (Y vers le haut) -> monde via l'inverse de la vue-projection
+        glm::vec4 ndc = { 2.0f * x / width - 1.0f, 1.0f - 2.0f * y / height, 0.0f, 1.0f };
+        glm::vec4 world = glm::inverse(m_Camera.GetViewProjectionMatrix()) * ndc;
+        return { world.x, world.y };
     }
 
 } // namespace Tesseract
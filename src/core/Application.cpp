@@ -4,38 +4,113 @@
 #include "core/ImGui/ImGuiLayer.hpp"
 #include "core/Timestep.hpp"
 #include "core/Renderer/RenderCommand.hpp"
+#include "core/Renderer/GpuProfiler.hpp"
 #include "core/Renderer/Renderer2D.hpp"
+#include "core/Renderer/RendererUniforms.hpp"
+#include "core/Renderer/RenderThread.hpp"
+#include "core/Renderer/Shader.hpp"
 #include "core/Input.hpp"
+#include "core/JobSystem.hpp"
+#include "core/Metrics.hpp"
+#include "core/Profiler.hpp"
+#include "core/Asset/AssetManager.hpp"
 #include <SDL2/SDL.h>
-#include <functional> // Pour std::bind et placeholders
 #include <memory> // Pour std::shared_ptr
+#include <cmath>
+#include <cstdlib>
 
 namespace Tesseract {
     Application* Application::s_Instance = nullptr;
+    std::vector<std::string> Application::s_CommandLineArgs;
 
-    Application::Application(const std::string& name) {
+    static ApplicationSpecification MakeSpecification(const std::string& name) {
+        ApplicationSpecification specification;
+        specification.Name = name;
+        return specification;
+    }
+
+    void Application::SetCommandLineArgs(int argc, char** argv) {
+        s_CommandLineArgs.assign(argv, argv + argc);
+    }
+
+    Application::Application(const std::string& name)
+        : Application(MakeSpecification(name)) {}
+
+    Application::Application(const ApplicationSpecification& specification)
+        : m_Specification(specification) {
         TS_ASSERT(!s_Instance, "Application already exists!");
         s_Instance = this;
 
+        for (size_t i = 1; i < s_CommandLineArgs.size(); ++i) {
+            if (s_CommandLineArgs[i] == "--headless")
+                m_Specification.Headless = true;
+            else if (s_CommandLineArgs[i] == "--frames" && i + 1 < s_CommandLineArgs.size())
+                m_Specification.MaxFrames = (uint32_t)std::strtoul(s_CommandLineArgs[++i].c_str(), nullptr, 10);
+        }
+
+        if (m_Specification.FixedTickRate == 0)
+            m_Specification.FixedTickRate = 60;
+        if (m_Specification.MaxFixedStepsPerFrame == 0)
+            m_Specification.MaxFixedStepsPerFrame = 1;
+
+        const std::string& name = m_Specification.Name;
         Logger::Info("Creating Application: {}", name);
 
-        m_Window = CreateScope<Window>(WindowProps(name));
-        // Lier Application::OnEvent au callback de la fenêtre
-        m_Window->SetEventCallback(std::bind(&Application::OnEvent, this, std::placeholders::_1));
+        // Pool de workers partagé (collisions, génération de sommets, chargements...)
+        JobSystem::Init();
+        Logger::Info("JobSystem: {} workers", JobSystem::GetWorkerCount());
+
+        Profiler::SetSpikeCapture(m_Specification.ProfileSpikeThresholdMs);
+
+        InputRecordSettings recording = m_Specification.InputRecording;
+        if (recording.Mode == InputRecordMode::Off)
+            recording = InputRecorder::GetCommandLineSettings();
+        if (recording.Mode != InputRecordMode::Off)
+            InputRecorder::Start(recording, m_Specification.FixedTickRate, m_Specification.MaxFixedStepsPerFrame);
+
+        for (const std::string& archive : m_Specification.AssetArchives)
+            AssetManager::Get().MountArchive(archive);
+
+        WindowProps windowProps(name);
+        m_ViewportWidth = windowProps.Width;
+        m_ViewportHeight = windowProps.Height;
+        if (m_Specification.Headless) {
+            // Ni fenêtre ni contexte : ressources de rendu en mémoire, commandes ignorées
+            Logger::Info("Headless mode: no window, null renderer");
+            RendererAPI::SetAPI(RendererAPI::API::Null);
+            m_Specification.ThreadedRendering = false;
+        } else {
+            m_Window = CreateScope<Window>(windowProps);
+            // La fenêtre publie ses événements sur le bus ; l'Application les voit avant les couches
+            m_Window->SetEventBus(&m_EventBus);
+        }
+        m_EventBus.Subscribe<&Application::OnWindowClose>(this, EventBus::ApplicationPriority);
+        m_EventBus.Subscribe<&Application::OnWindowResize>(this, EventBus::ApplicationPriority);
+        Input::Init(m_EventBus);
 
         // Initialisation des systèmes de rendu APRES la création de la fenêtre/contexte
-        RenderCommand::Init(); // Initialise l'API de rendu (OpenGL)
+        Shader::SetBinaryCacheDirectory(m_Specification.ShaderCacheDirectory);
+        RenderCommand::Init(); // Initialise l'API de rendu (OpenGL, ou Null sans fenêtre)
+        GpuProfiler::Init();   // Requêtes de timestamp GPU (si disponibles)
+        RendererUniforms::Init(); // Blocs d'uniforms partagés (avant la création des shaders)
         Renderer2D::Init();    // Initialise le renderer 2D
 
-        // Création et ajout de la couche ImGui
-        m_ImGuiLayer = CreateRef<ImGuiLayer>();
-        PushOverlay(m_ImGuiLayer);
+        // Création et ajout de la couche ImGui (liée à la fenêtre SDL et au contexte GL)
+        if (m_Window) {
+            m_ImGuiLayer = CreateRef<ImGuiLayer>();
+            PushOverlay(m_ImGuiLayer);
+        }
     }
 
     Application::~Application() {
         Logger::Warn("Destroying Application...");
         // Assurez-vous que Renderer2D est arrêté avant que le contexte OpenGL ne soit détruit
         Renderer2D::Shutdown();
+        RendererUniforms::Shutdown();
+        GpuProfiler::Shutdown();
+        RenderCommand::Shutdown();
+        JobSystem::Shutdown();
+        Input::Shutdown();
         // Les smart pointers (m_Window, m_ImGuiLayer, m_LayerStack) gèrent leur propre nettoyage.
     }
 
@@ -51,34 +126,140 @@ namespace Tesseract {
 
     void Application::Run() {
         Logger::Info("Starting Application Run Loop...");
+        TS_PROFILE_THREAD("Main");
+
+        const double counterFrequency = (double)SDL_GetPerformanceFrequency();
+        const double fixedStep = 1.0 / (double)m_Specification.FixedTickRate;
+        m_LastFrameCounter = SDL_GetPerformanceCounter();
+        m_FixedAccumulator = 0.0;
+        double elapsedTime = 0.0;
+        uint32_t frameIndex = 0;
+        uint32_t frameCount = 0;
+
+        // Les ressources créées pendant l'initialisation l'ont été directement ;
+        // à partir d'ici le contexte GL appartient au thread de rendu
+        if (m_Specification.ThreadedRendering)
+            RenderThread::Start(*m_Window);
+
+        Metric& frameTimeMetric = Metrics::GetGauge("Frame.TimeMs", "ms");
+        Metric& fixedStepsMetric = Metrics::GetGauge("Frame.FixedSteps");
 
         while (m_Running) {
-            // Calcul du Timestep
-            float time = (float)SDL_GetTicks() / 1000.0f; // Temps en secondes
-            Timestep timestep = time - m_LastFrameTime;
-            m_LastFrameTime = time;
+            TS_PROFILE_SCOPE("Frame");
+            if (m_Specification.MaxFrames && frameCount++ == m_Specification.MaxFrames)
+                break;
+
+            // Calcul du Timestep (horloge haute résolution)
+            uint64_t counter = SDL_GetPerformanceCounter();
+            const double wallTime = (double)(counter - m_LastFrameCounter) / counterFrequency;
+            m_LastFrameCounter = counter;
+            // Durée réelle de la frame précédente : c'est elle que mesure Frame.TimeMs
+            frameTimeMetric.Set((float)(wallTime * 1000.0));
+
+            // Rejeu : la durée enregistrée remplace l'horloge (mêmes ticks à chaque exécution)
+            double frameTime = wallTime;
+            if (!InputRecorder::BeginFrame(frameTime)) {
+                bool close = InputRecorder::GetSettings().CloseOnReplayEnd;
+                InputRecorder::Stop();
+                if (close)
+                    break;
+            }
+            elapsedTime += frameTime;
+            Timestep timestep = (float)frameTime;
+
+            // Textures décodées en arrière-plan : envoi au GPU sous le budget de la frame
+            {
+                TS_PROFILE_SCOPE("AssetManager::Update");
+                AssetManager::Get().Update();
+            }
 
             // Ne pas rendre si la fenêtre est minimisée
             if (!m_Minimized) {
-                // 1. Nettoyage de l'écran avec une couleur distinctive pour débug
+                // 1. Simulation à pas fixe : coût constant par tick, indépendant du framerate
+                m_FixedAccumulator += frameTime;
+                m_FixedStepsLastFrame = 0;
+                while (m_FixedAccumulator >= fixedStep && m_FixedStepsLastFrame < m_Specification.MaxFixedStepsPerFrame) {
+                    TS_PROFILE_SCOPE("Layer::OnFixedUpdate");
+                    for (auto& layer : m_LayerStack)
+                        layer->OnFixedUpdate((float)fixedStep);
+                    m_FixedAccumulator -= fixedStep;
+                    m_FixedStepsLastFrame++;
+                }
+                // Trop de retard (frame très longue) : abandonner plutôt que de s'enliser
+                if (m_FixedAccumulator >= fixedStep)
+                    m_FixedAccumulator = std::fmod(m_FixedAccumulator, fixedStep);
+                m_FixedUpdateAlpha = (float)(m_FixedAccumulator / fixedStep);
+                fixedStepsMetric.Set((float)m_FixedStepsLastFrame);
+
+                // Bloc Frame partagé par tous les shaders, envoyé une fois par frame
+                FrameUniforms frame;
+                frame.Time = (float)elapsedTime;
+                frame.DeltaTime = timestep;
+                frame.FixedAlpha = m_FixedUpdateAlpha;
+                frame.FrameIndex = frameIndex++;
+                frame.ViewportSize = { (float)m_ViewportWidth, (float)m_ViewportHeight };
+                frame.InverseViewportSize = 1.0f / glm::max(frame.ViewportSize, glm::vec2(1.0f));
+                RendererUniforms::SetFrame(frame);
+
+                // 2. Nettoyage de l'écran avec une couleur distinctive pour débug
+                GpuProfiler::BeginFrame();
                 RenderCommand::SetClearColor({0.1f, 0.1f, 0.2f, 1.0f}); // Bleu foncé
                 RenderCommand::Clear();
 
-                // 2. Mise à jour des couches (Logique du jeu/moteur)
-                for (auto& layer : m_LayerStack)
-                    layer->OnUpdate(timestep);
+                // 3. Mise à jour des couches à chaque frame (caméra, rendu interpolé)
+                {
+                    TS_PROFILE_SCOPE("Layer::OnUpdate");
+                    TS_PROFILE_GPU("Scene");
+                    for (auto& layer : m_LayerStack)
+                        layer->OnUpdate(timestep);
+                }
+
+                // 4. Rendu ImGui - Assurons-nous qu'ImGui fonctionne correctement
+                if (m_ImGuiLayer) {
+                    TS_PROFILE_SCOPE("ImGui");
+                    m_ImGuiLayer->Begin();
+                    for (auto& layer : m_LayerStack)
+                        layer->OnImGuiRender();
+                    m_ImGuiLayer->End();
+                }
+                GpuProfiler::EndFrame();
+            }
 
-                // 3. Rendu ImGui - Assurons-nous qu'ImGui fonctionne correctement
-                m_ImGuiLayer->Begin();
-                for (auto& layer : m_LayerStack)
-                    layer->OnImGuiRender();
-                m_ImGuiLayer->End();
+            // 5. Mise à jour de la fenêtre (Polling events, Swap Buffers) puis distribution
+            //    des événements de la frame, par lots de même type
+            if (m_Window) {
+                TS_PROFILE_SCOPE("Window::OnUpdate");
+                m_Window->OnUpdate();
+            } else if (InputRecorder::IsReplaying()) {
+                // Sans fenêtre, les événements rejoués sont publiés directement
+                for (const RecordedEvent& event : InputRecorder::GetReplayedEvents())
+                    event.Post(m_EventBus);
             }
+            m_EventBus.Dispatch();
+            // Instantané des entrées lu par la frame suivante (couches, workers)
+            if (InputRecorder::IsReplaying())
+                Input::Update(InputRecorder::GetReplayedState());
+            else if (m_Window)
+                Input::Update();
+            else
+                Input::Update(InputState()); // Headless : aucun périphérique
+            InputRecorder::EndFrame(Input::GetState());
 
-            // 4. Mise à jour de la fenêtre (Polling events, Swap Buffers)
-            m_Window->OnUpdate();
+            // 6. Frame confiée au thread de rendu (sans effet en mode mono-thread)
+            {
+                TS_PROFILE_SCOPE("RenderThread::EndFrame");
+                RenderThread::EndFrame();
+            }
+            // 7. Relevé des mesures de la frame (percentiles, export)
+            Metrics::EndFrame();
+            TS_PROFILE_FRAME();
         }
 
+        // Le contexte revient au thread principal pour la destruction des ressources
+        RenderThread::Stop();
+        // Enregistrement complété sur le disque, résumé du rejeu
+        InputRecorder::Stop();
+
         Logger::Info("Exiting Application Run Loop.");
     }
 
@@ -86,23 +267,6 @@ namespace Tesseract {
         m_Running = false;
     }
 
-    // --- Implémentation de Application::OnEvent ---
-    void Application::OnEvent(Event& e) {
-        EventDispatcher dispatcher(e);
-        // Gère la fermeture de la fenêtre directement dans l'Application
-        dispatcher.Dispatch<WindowCloseEvent>(std::bind(&Application::OnWindowClose, this, std::placeholders::_1));
-
-        // Gère le redimensionnement de la fenêtre
-        dispatcher.Dispatch<WindowResizeEvent>(std::bind(&Application::OnWindowResize, this, std::placeholders::_1));
-
-        // Propage l'événement aux couches, du haut vers le bas (overlays d'abord)
-        for (auto it = m_LayerStack.rbegin(); it != m_LayerStack.rend(); ++it) {
-            if (e.Handled)
-                break;
-            (*it)->OnEvent(e);
-        }
-    }
-
     bool Application::OnWindowClose([[maybe_unused]] WindowCloseEvent& e) {
         m_Running = false;
         return true; // L'événement est géré
@@ -114,6 +278,8 @@ namespace Tesseract {
             return false;
         }
         m_Minimized = false;
+        m_ViewportWidth = e.GetWidth();
+        m_ViewportHeight = e.GetHeight();
         RenderCommand::SetViewport(0, 0, e.GetWidth(), e.GetHeight());
         return false; // Laisser d'autres couches réagir
     }
@@ -0,0 +1,292 @@
+#include "core/Asset/AssetArchive.hpp"
+#include "core/Logger.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifdef TESSERACT_HAS_LZ4
+    #include <lz4.h>
+#endif
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Tesseract {
+
+    static_assert(sizeof(AssetArchive::Header) == 24, "En-tête .tpak : disposition fixe");
+    static_assert(sizeof(AssetArchive::Entry) == 40, "Entrée .tpak : disposition fixe");
+
+    namespace {
+
+        // Décompresse une entrée LZ4 (bloc brut, taille d'origine connue)
+        bool Decompress(const uint8_t* source, size_t storedSize, std::vector<uint8_t>& destination) {
+#ifdef TESSERACT_HAS_LZ4
+            int size = LZ4_decompress_safe(reinterpret_cast<const char*>(source), reinterpret_cast<char*>(destination.data()),
+                                           (int)storedSize, (int)destination.size());
+            return size == (int)destination.size();
+#else
+            (void)source; (void)storedSize; (void)destination;
+            return false;
+#endif
+        }
+
+    } // namespace
+
+    std::string AssetArchive::NormalizePath(const std::string& path) {
+        std::string normalized = path;
+        std::replace(normalized.begin(), normalized.end(), '\\', '/');
+        while (normalized.compare(0, 2, "./") == 0)
+            normalized.erase(0, 2);
+        return normalized;
+    }
+
+    uint64_t AssetArchive::HashPath(const std::string& path) {
+        // FNV-1a 64 bits
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : NormalizePath(path)) {
+            hash ^= (uint8_t)c;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    Ref<AssetArchive> AssetArchive::Open(const std::string& filepath) {
+        Ref<AssetArchive> archive(new AssetArchive());
+        archive->m_Path = filepath;
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            Logger::Error("AssetArchive: impossible d'ouvrir '{}'", filepath);
+            return nullptr;
+        }
+        archive->m_FileHandle = file;
+        LARGE_INTEGER fileSize;
+        GetFileSizeEx(file, &fileSize);
+        archive->m_MappingSize = (size_t)fileSize.QuadPart;
+        if (archive->m_MappingSize >= sizeof(Header)) {
+            archive->m_MappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (archive->m_MappingHandle)
+                archive->m_Mapping = static_cast<const uint8_t*>(MapViewOfFile(archive->m_MappingHandle, FILE_MAP_READ, 0, 0, 0));
+        }
+#else
+        int fd = ::open(filepath.c_str(), O_RDONLY);
+        if (fd < 0) {
+            Logger::Error("AssetArchive: impossible d'ouvrir '{}'", filepath);
+            return nullptr;
+        }
+        struct stat info;
+        if (fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(Header)) {
+            archive->m_MappingSize = (size_t)info.st_size;
+            void* mapping = mmap(nullptr, archive->m_MappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED)
+                archive->m_Mapping = static_cast<const uint8_t*>(mapping);
+        }
+        // Le mapping reste valide après la fermeture du descripteur
+        ::close(fd);
+#endif
+
+        if (!archive->m_Mapping) {
+            Logger::Error("AssetArchive: impossible de mapper '{}'", filepath);
+            return nullptr;
+        }
+
+        Header header;
+        std::memcpy(&header, archive->m_Mapping, sizeof(Header));
+        if (header.Magic != Magic || header.Version != Version
+            || header.TableOffset % alignof(Entry) != 0
+            || header.TableOffset > archive->m_MappingSize
+            || (archive->m_MappingSize - header.TableOffset) / sizeof(Entry) < header.EntryCount) {
+            Logger::Error("AssetArchive: '{}' n'est pas une archive valide (version {} attendue)", filepath, Version);
+            return nullptr;
+        }
+
+        // Le mapping est aligné sur une page et la table sur 8 : lecture directe
+        archive->m_Entries = reinterpret_cast<const Entry*>(archive->m_Mapping + header.TableOffset);
+        archive->m_EntryCount = header.EntryCount;
+        for (uint32_t i = 0; i < archive->m_EntryCount; ++i) {
+            const Entry& entry = archive->m_Entries[i];
+            if (entry.Offset > archive->m_MappingSize || entry.StoredSize > archive->m_MappingSize - entry.Offset) {
+                Logger::Error("AssetArchive: entrée {} hors du fichier dans '{}'", i, filepath);
+                return nullptr;
+            }
+        }
+
+        Logger::Info("AssetArchive: '{}' monté ({} entrées, {} Ko)", filepath, archive->m_EntryCount,
+                     archive->m_MappingSize / 1024);
+        return archive;
+    }
+
+    AssetArchive::~AssetArchive() {
+#ifdef _WIN32
+        if (m_Mapping)
+            UnmapViewOfFile(m_Mapping);
+        if (m_MappingHandle)
+            CloseHandle(m_MappingHandle);
+        if (m_FileHandle)
+            CloseHandle(m_FileHandle);
+#else
+        if (m_Mapping)
+            munmap(const_cast<uint8_t*>(m_Mapping), m_MappingSize);
+#endif
+    }
+
+    const AssetArchive::Entry* AssetArchive::Find(const std::string& path) const {
+        uint64_t hash = HashPath(path);
+        const Entry* end = m_Entries + m_EntryCount;
+        const Entry* entry = std::lower_bound(m_Entries, end, hash,
+                                              [](const Entry& e, uint64_t h) { return e.PathHash < h; });
+        return entry != end && entry->PathHash == hash ? entry : nullptr;
+    }
+
+    AssetData AssetArchive::Read(const std::string& path) const {
+        AssetData data;
+        const Entry* entry = Find(path);
+        if (!entry)
+            return data;
+
+        const uint8_t* source = m_Mapping + entry->Offset;
+        if (!(entry->Flags & EntryCompressedLZ4)) {
+            // Aucune copie : l'AssetData garde l'archive (et donc le mapping) vivante
+            data.Data = source;
+            data.Size = (size_t)entry->StoredSize;
+            data.Source = std::const_pointer_cast<AssetArchive>(shared_from_this());
+            return data;
+        }
+
+        data.Storage.resize((size_t)entry->OriginalSize);
+        if (!Decompress(source, (size_t)entry->StoredSize, data.Storage)) {
+            Logger::Error("AssetArchive: décompression de '{}' impossible dans '{}'", path, m_Path);
+            return {};
+        }
+        data.Data = data.Storage.data();
+        data.Size = data.Storage.size();
+        return data;
+    }
+
+    // --- AssetArchiveWriter ---
+
+    bool AssetArchiveWriter::IsCompressionAvailable() {
+#ifdef TESSERACT_HAS_LZ4
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void AssetArchiveWriter::AddData(const std::string& path, std::vector<uint8_t> data, bool compress) {
+        PendingFile file;
+        file.Path = AssetArchive::NormalizePath(path);
+        file.Hash = AssetArchive::HashPath(file.Path);
+        file.OriginalSize = data.size();
+        file.Flags = 0;
+
+#ifdef TESSERACT_HAS_LZ4
+        if (compress && !data.empty()) {
+            std::vector<uint8_t> compressed((size_t)LZ4_compressBound((int)data.size()));
+            int size = LZ4_compress_default(reinterpret_cast<const char*>(data.data()), reinterpret_cast<char*>(compressed.data()),
+                                            (int)data.size(), (int)compressed.size());
+            // Déjà compressé (PNG, BCn...) : garder les données brutes, lisibles sans copie
+            if (size > 0 && (size_t)size < data.size() - data.size() / 10) {
+                compressed.resize((size_t)size);
+                data = std::move(compressed);
+                file.Flags |= AssetArchive::EntryCompressedLZ4;
+            }
+        }
+#else
+        (void)compress;
+#endif
+
+        file.Data = std::move(data);
+        m_Files.push_back(std::move(file));
+    }
+
+    bool AssetArchiveWriter::AddFile(const std::string& path, const std::string& filepath, bool compress) {
+        std::ifstream stream(filepath, std::ios::binary);
+        if (!stream) {
+            Logger::Error("AssetArchiveWriter: impossible de lire '{}'", filepath);
+            return false;
+        }
+        std::vector<uint8_t> data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        AddData(path, std::move(data), compress);
+        return true;
+    }
+
+    bool AssetArchiveWriter::Write(const std::string& filepath) const {
+        std::vector<const PendingFile*> files;
+        files.reserve(m_Files.size());
+        for (const PendingFile& file : m_Files)
+            files.push_back(&file);
+        std::sort(files.begin(), files.end(),
+                  [](const PendingFile* a, const PendingFile* b) { return a->Hash < b->Hash; });
+
+        for (size_t i = 1; i < files.size(); ++i) {
+            if (files[i]->Hash == files[i - 1]->Hash) {
+                Logger::Error("AssetArchiveWriter: '{}' et '{}' ont le même hash", files[i - 1]->Path, files[i]->Path);
+                return false;
+            }
+        }
+
+        std::ofstream stream(filepath, std::ios::binary | std::ios::trunc);
+        if (!stream) {
+            Logger::Error("AssetArchiveWriter: impossible d'écrire '{}'", filepath);
+            return false;
+        }
+
+        auto align = [](uint64_t offset) {
+            return (offset + AssetArchive::DataAlignment - 1) & ~(AssetArchive::DataAlignment - 1);
+        };
+        const char padding[AssetArchive::DataAlignment] = {};
+
+        // Données d'abord, table en fin de fichier
+        std::vector<AssetArchive::Entry> entries;
+        entries.reserve(files.size());
+        uint64_t offset = sizeof(AssetArchive::Header);
+        stream.write(padding, (std::streamsize)offset); // En-tête réécrit à la fin
+        for (const PendingFile* file : files) {
+            uint64_t aligned = align(offset);
+            stream.write(padding, (std::streamsize)(aligned - offset));
+            stream.write(reinterpret_cast<const char*>(file->Data.data()), (std::streamsize)file->Data.size());
+            entries.push_back({ file->Hash, aligned, file->Data.size(), file->OriginalSize, file->Flags, 0 });
+            offset = aligned + file->Data.size();
+        }
+
+        AssetArchive::Header header = { AssetArchive::Magic, AssetArchive::Version, (uint32_t)entries.size(), 0, align(offset) };
+        stream.write(padding, (std::streamsize)(header.TableOffset - offset));
+        stream.write(reinterpret_cast<const char*>(entries.data()), (std::streamsize)(entries.size() * sizeof(AssetArchive::Entry)));
+        stream.seekp(0);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        if (!stream) {
+            Logger::Error("AssetArchiveWriter: échec d'écriture de '{}'", filepath);
+            return false;
+        }
+        return true;
+    }
+
+    uint64_t AssetArchiveWriter::GetStoredBytes() const {
+        uint64_t total = 0;
+        for (const PendingFile& file : m_Files)
+            total += file.Data.size();
+        return total;
+    }
+
+    uint64_t AssetArchiveWriter::GetOriginalBytes() const {
+        uint64_t total = 0;
+        for (const PendingFile& file : m_Files)
+            total += file.OriginalSize;
+        return total;
+    }
+
+} // namespace Tesseract
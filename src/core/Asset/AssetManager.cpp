@@ -1,6 +1,13 @@
 #include "core/Asset/AssetManager.hpp"
 #include "core/Logger.hpp"
+#include "core/BinaryLog.hpp"
+#include "core/JobSystem.hpp"
+#include "core/Metrics.hpp"
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
 
 namespace Tesseract {
 
@@ -17,9 +24,9 @@ namespace Tesseract {
         std::string textureName = name.empty() ? ExtractNameFromFilePath(filepath) : name;
 
         // Vérifier si la texture est déjà chargée
-        if (m_TextureCache.find(textureName) != m_TextureCache.end()) {
-            Logger::Debug("Texture '{}' already loaded, returning cached version.", textureName);
-            return m_TextureCache[textureName];
+        if (Ref<Texture2D> cached = m_Textures.Get(m_Textures.Find(textureName), m_FrameIndex)) {
+            TS_BLOG_DEBUG("Texture '{}' already loaded, returning cached version.", textureName);
+            return cached;
         }
 
         // Charger la nouvelle texture
@@ -30,47 +37,339 @@ namespace Tesseract {
         }
 
         // Ajouter au cache
-        m_TextureCache[textureName] = texture;
+        m_Textures.Add(textureName, texture, m_FrameIndex);
         Logger::Debug("Texture '{}' loaded successfully from '{}'.", textureName, filepath);
 
         return texture;
     }
 
+    Ref<Texture2D> AssetManager::LoadTextureAsync(const std::string& filepath, const std::string& name) {
+        std::string textureName = name.empty() ? ExtractNameFromFilePath(filepath) : name;
+
+        if (Ref<Texture2D> cached = m_Textures.Get(m_Textures.Find(textureName), m_FrameIndex)) {
+            TS_BLOG_DEBUG("Texture '{}' already loaded, returning cached version.", textureName);
+            return cached;
+        }
+
+        Ref<Texture2D> texture = Texture2D::CreatePending(filepath);
+        if (!texture) {
+            Logger::Error("Failed to create texture: {}", filepath);
+            return nullptr;
+        }
+        m_Textures.Add(textureName, texture, m_FrameIndex);
+        m_PendingLoads++;
+
+        // Le worker ne touche qu'à l'image : la texture n'est manipulée que par Update()
+        JobSystem::Submit([this, texture, filepath]() {
+            auto start = std::chrono::steady_clock::now();
+            DecodedTexture decoded;
+            decoded.Texture = texture;
+            decoded.Filepath = filepath;
+            decoded.Pixels = Image::Load(filepath);
+            decoded.DecodeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            std::lock_guard<std::mutex> lock(m_DecodedMutex);
+            m_DecodedTextures.push_back(std::move(decoded));
+        });
+
+        return texture;
+    }
+
+    void AssetManager::Update() {
+        using Clock = std::chrono::steady_clock;
+        auto start = Clock::now();
+        size_t uploadedBytes = 0;
+        uint32_t uploaded = 0;
+
+        while (true) {
+            DecodedTexture decoded;
+            {
+                std::lock_guard<std::mutex> lock(m_DecodedMutex);
+                if (m_DecodedTextures.empty())
+                    break;
+                // Budget épuisé : la suite attend la frame suivante
+                if (uploaded > 0 && uploadedBytes + m_DecodedTextures.front().Pixels.GetSize() > m_UploadBudget.Bytes)
+                    break;
+                decoded = std::move(m_DecodedTextures.front());
+                m_DecodedTextures.pop_front();
+            }
+            m_PendingLoads--;
+
+            if (!decoded.Pixels.IsValid()) {
+                Logger::Error("Failed to load texture: {}", decoded.Filepath);
+                continue;
+            }
+
+            size_t size = decoded.Pixels.GetSize();
+            Logger::Debug("Texture '{}' decoded in {:.2f} ms ({}x{})", decoded.Filepath, decoded.DecodeMs,
+                          decoded.Pixels.Width, decoded.Pixels.Height);
+            decoded.Texture->SetImage(std::move(decoded.Pixels));
+            uploadedBytes += size;
+            uploaded++;
+
+            if (std::chrono::duration<float, std::milli>(Clock::now() - start).count() >= m_UploadBudget.TimeMs)
+                break;
+        }
+
+        m_AsyncStats.PendingCount = m_PendingLoads;
+        m_AsyncStats.UploadedLastFrame = uploaded;
+        m_AsyncStats.UploadMsLastFrame = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+
+        static Metric& textureUploads = Metrics::GetCounter("Assets.TextureUploads");
+        static Metric& uploadBytes = Metrics::GetCounter("Assets.UploadBytes", "B");
+        static Metric& uploadMs = Metrics::GetGauge("Assets.UploadMs", "ms");
+        static Metric& pendingLoads = Metrics::GetGauge("Assets.PendingLoads");
+        textureUploads.Increment(uploaded);
+        uploadBytes.Increment((int64_t)uploadedBytes);
+        uploadMs.Set(m_AsyncStats.UploadMsLastFrame);
+        pendingLoads.Set((float)m_AsyncStats.PendingCount);
+
+        EnforceMemoryBudget();
+        m_FrameIndex++;
+    }
+
+    uint32_t AssetManager::EnforceMemoryBudget() {
+        // Ressource évinçable : plus aucune Ref hors de l'AssetManager
+        struct Candidate {
+            uint64_t LastUsedFrame;
+            AssetMemory Memory;
+            bool IsTexture;
+            uint32_t Handle;
+        };
+        std::vector<Candidate> candidates;
+
+        MemoryStats stats;
+        m_Textures.ForEach([&](TextureHandle handle, const AssetStorage<Texture2D>::Entry& entry) {
+            AssetMemory memory{ entry.Asset->GetMemorySize(), 0 };
+            stats.Textures.Count++;
+            stats.Textures.GPUBytes += memory.GPUBytes;
+            if (entry.Asset.use_count() > 1)
+                stats.Textures.Referenced++;
+            else
+                candidates.push_back({ entry.LastUsedFrame, memory, true, handle.ID });
+        });
+        m_Atlases.ForEach([&](TextureAtlasHandle handle, const AssetStorage<TextureAtlas>::Entry& entry) {
+            AssetMemory memory = entry.Asset->GetMemoryUsage();
+            stats.Atlases.Count++;
+            stats.Atlases.GPUBytes += memory.GPUBytes;
+            stats.Atlases.CPUBytes += memory.CPUBytes;
+            if (entry.Asset.use_count() > 1)
+                stats.Atlases.Referenced++;
+            else
+                candidates.push_back({ entry.LastUsedFrame, memory, false, handle.ID });
+        });
+
+        size_t gpuBytes = stats.GetGPUBytes();
+        size_t cpuBytes = stats.GetCPUBytes();
+        auto overBudget = [&]() {
+            return (m_MemoryBudget.GPUBytes && gpuBytes > m_MemoryBudget.GPUBytes) ||
+                   (m_MemoryBudget.CPUBytes && cpuBytes > m_MemoryBudget.CPUBytes);
+        };
+
+        uint32_t evicted = 0;
+        if (overBudget()) {
+            std::sort(candidates.begin(), candidates.end(),
+                      [](const Candidate& a, const Candidate& b) { return a.LastUsedFrame < b.LastUsedFrame; });
+
+            for (const Candidate& candidate : candidates) {
+                if (!overBudget())
+                    break;
+
+                AssetTypeStats& typeStats = candidate.IsTexture ? stats.Textures : stats.Atlases;
+                if (candidate.IsTexture)
+                    m_Textures.Remove(TextureHandle(candidate.Handle));
+                else
+                    m_Atlases.Remove(TextureAtlasHandle(candidate.Handle));
+
+                typeStats.Count--;
+                typeStats.GPUBytes -= candidate.Memory.GPUBytes;
+                typeStats.CPUBytes -= candidate.Memory.CPUBytes;
+                gpuBytes -= candidate.Memory.GPUBytes;
+                cpuBytes -= candidate.Memory.CPUBytes;
+                evicted++;
+            }
+
+            if (overBudget())
+                Logger::Warn("AssetManager: memory budget exceeded by referenced assets (GPU {} KB, CPU {} KB)",
+                             gpuBytes / 1024, cpuBytes / 1024);
+            else
+                Logger::Debug("AssetManager: evicted {} unreferenced assets to fit the memory budget", evicted);
+        }
+
+        stats.EvictedLastFrame = evicted;
+        m_MemoryStats = stats;
+        return evicted;
+    }
+
     Ref<Texture2D> AssetManager::GetTexture(const std::string& name) {
-        auto it = m_TextureCache.find(name);
-        if (it != m_TextureCache.end()) {
-            return it->second;
+        if (Ref<Texture2D> texture = m_Textures.Get(m_Textures.Find(name), m_FrameIndex)) {
+            return texture;
         }
 
         Logger::Warn("Texture '{}' not found in AssetManager!", name);
         return nullptr;
     }
 
+    Ref<Texture2D> AssetManager::GetTexture(TextureHandle handle) {
+        return m_Textures.Get(handle, m_FrameIndex);
+    }
+
+    TextureHandle AssetManager::GetTextureHandle(const std::string& name) const {
+        return m_Textures.Find(name);
+    }
+
     bool AssetManager::HasTexture(const std::string& name) const {
-        return m_TextureCache.find(name) != m_TextureCache.end();
+        return m_Textures.Find(name).IsValid();
     }
 
     void AssetManager::RemoveTexture(const std::string& name) {
-        auto it = m_TextureCache.find(name);
-        if (it != m_TextureCache.end()) {
-            m_TextureCache.erase(it);
+        if (m_Textures.Remove(m_Textures.Find(name))) {
             Logger::Debug("Texture '{}' removed from AssetManager.", name);
         }
     }
 
     std::vector<std::string> AssetManager::GetLoadedTextureNames() const {
         std::vector<std::string> names;
-        names.reserve(m_TextureCache.size());
+        names.reserve(m_Textures.GetCount());
 
-        for (const auto& [name, _] : m_TextureCache) {
-            names.push_back(name);
-        }
+        m_Textures.ForEach([&names](TextureHandle, const AssetStorage<Texture2D>::Entry& entry) {
+            names.push_back(entry.Name);
+        });
 
         return names;
     }
 
+    Ref<TextureAtlas> AssetManager::LoadTextureAtlas(const std::string& name, const std::vector<std::string>& filepaths,
+                                                     const std::string& cachePath) {
+        namespace fs = std::filesystem;
+
+        if (Ref<TextureAtlas> cached = m_Atlases.Get(m_Atlases.Find(name), m_FrameIndex)) {
+            TS_BLOG_DEBUG("Texture atlas '{}' already loaded, returning cached version.", name);
+            return cached;
+        }
+
+        // Atlas pré-calculé encore à jour : pas de placement au démarrage
+        Ref<TextureAtlas> atlas;
+        if (!cachePath.empty() && fs::exists(cachePath)) {
+            std::error_code error;
+            auto cacheTime = fs::last_write_time(cachePath, error);
+            bool upToDate = !error;
+            for (const std::string& filepath : filepaths) {
+                if (!upToDate)
+                    break;
+                auto sourceTime = fs::last_write_time(filepath, error);
+                upToDate = !error && sourceTime <= cacheTime;
+            }
+            if (upToDate)
+                atlas = TextureAtlas::Load(cachePath);
+
+            // Le cache doit correspondre à la liste demandée (image ajoutée ou retirée depuis)
+            if (atlas) {
+                bool matches = atlas->GetRegionCount() <= filepaths.size();
+                for (const std::string& filepath : filepaths) {
+                    if (!matches)
+                        break;
+                    matches = atlas->HasRegion(ExtractNameFromFilePath(filepath));
+                }
+                if (!matches) {
+                    Logger::Info("Texture atlas cache '{}' does not match '{}', rebuilding.", cachePath, name);
+                    atlas = nullptr;
+                }
+            }
+        }
+
+        if (!atlas) {
+            atlas = CreateRef<TextureAtlas>();
+            for (const std::string& filepath : filepaths)
+                atlas->AddImageFromFile(ExtractNameFromFilePath(filepath), filepath);
+
+            if (atlas->GetRegionCount() == 0) {
+                Logger::Error("Failed to build texture atlas '{}': no image could be packed.", name);
+                return nullptr;
+            }
+            if (!cachePath.empty())
+                atlas->Save(cachePath);
+        }
+
+        m_Atlases.Add(name, atlas, m_FrameIndex);
+        Logger::Debug("Texture atlas '{}' loaded: {} regions in {} pages.", name, atlas->GetRegionCount(), atlas->GetPageCount());
+        return atlas;
+    }
+
+    Ref<TextureAtlas> AssetManager::GetTextureAtlas(const std::string& name) {
+        if (Ref<TextureAtlas> atlas = m_Atlases.Get(m_Atlases.Find(name), m_FrameIndex)) {
+            return atlas;
+        }
+
+        Logger::Warn("Texture atlas '{}' not found in AssetManager!", name);
+        return nullptr;
+    }
+
+    Ref<TextureAtlas> AssetManager::GetTextureAtlas(TextureAtlasHandle handle) {
+        return m_Atlases.Get(handle, m_FrameIndex);
+    }
+
+    TextureAtlasHandle AssetManager::GetTextureAtlasHandle(const std::string& name) const {
+        return m_Atlases.Find(name);
+    }
+
+    bool AssetManager::MountArchive(const std::string& filepath) {
+        Ref<AssetArchive> archive = AssetArchive::Open(filepath);
+        if (!archive)
+            return false;
+
+        std::unique_lock<std::shared_mutex> lock(m_ArchivesMutex);
+        m_Archives.push_back(archive);
+        return true;
+    }
+
+    void AssetManager::UnmountArchive(const std::string& filepath) {
+        // Les AssetData déjà lues gardent leur archive vivante
+        std::unique_lock<std::shared_mutex> lock(m_ArchivesMutex);
+        m_Archives.erase(std::remove_if(m_Archives.begin(), m_Archives.end(),
+                                        [&](const Ref<AssetArchive>& archive) { return archive->GetPath() == filepath; }),
+                         m_Archives.end());
+    }
+
+    AssetData AssetManager::ReadAsset(const std::string& filepath) const {
+        {
+            std::shared_lock<std::shared_mutex> lock(m_ArchivesMutex);
+            for (auto it = m_Archives.rbegin(); it != m_Archives.rend(); ++it) {
+                if ((*it)->Contains(filepath))
+                    return (*it)->Read(filepath);
+            }
+        }
+
+        AssetData data;
+        std::ifstream stream(filepath, std::ios::binary);
+        if (!stream)
+            return data;
+        data.Storage.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        // Un fichier vide reste une lecture réussie
+        static const uint8_t Empty = 0;
+        data.Data = data.Storage.empty() ? &Empty : data.Storage.data();
+        data.Size = data.Storage.size();
+        return data;
+    }
+
+    bool AssetManager::IsInArchive(const std::string& filepath) const {
+        std::shared_lock<std::shared_mutex> lock(m_ArchivesMutex);
+        for (const Ref<AssetArchive>& archive : m_Archives) {
+            if (archive->Contains(filepath))
+                return true;
+        }
+        return false;
+    }
+
     void AssetManager::Clear() {
-        m_TextureCache.clear();
+        m_Textures.Clear();
+        m_Atlases.Clear();
+        {
+            // Les décodages encore en cours termineront dans la file, sans effet visible
+            std::lock_guard<std::mutex> lock(m_DecodedMutex);
+            m_PendingLoads -= (uint32_t)m_DecodedTextures.size();
+            m_DecodedTextures.clear();
+        }
         Logger::Debug("AssetManager cleared all resources.");
     }
 
@@ -0,0 +1,218 @@
+#include "core/Asset/Image.hpp"
+#include "core/Asset/AssetManager.hpp"
+#include "core/Logger.hpp"
+
+// STB_IMAGE_IMPLEMENTATION est défini par CMake : ce fichier doit rester le seul à inclure stb_image.h
+#include <stb_image.h>
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace Tesseract {
+
+    namespace {
+
+        template<typename T>
+        T ReadValue(const uint8_t* data, size_t offset) {
+            T value;
+            std::memcpy(&value, data + offset, sizeof(T));
+            return value;
+        }
+
+        bool HasExtension(const std::string& filepath, const char* extension) {
+            size_t length = std::strlen(extension);
+            if (filepath.size() < length)
+                return false;
+            return std::equal(filepath.end() - (std::ptrdiff_t)length, filepath.end(), extension,
+                              [](char a, char b) { return std::tolower((unsigned char)a) == b; });
+        }
+
+        // Niveaux d'une chaîne complète (jusqu'à 1x1) : borne des compteurs lus dans les en-têtes,
+        // au-delà glTextureStorage2D refuse l'allocation
+        uint32_t GetMaxLevelCount(uint32_t width, uint32_t height) {
+            uint32_t levels = 1;
+            for (uint32_t size = std::max(width, height); size > 1; size /= 2)
+                levels++;
+            return levels;
+        }
+
+        // Découpe la chaîne de mips stockée à partir de offset (niveaux du plus grand au plus petit)
+        bool BuildLevels(Image& image, uint32_t levelCount, size_t offset, size_t fileSize) {
+            uint32_t width = image.Width, height = image.Height;
+            for (uint32_t level = 0; level < levelCount; ++level) {
+                size_t size = Image::GetCompressedSize(image.Format, width, height);
+                if (offset > fileSize || size > fileSize - offset)
+                    return false;
+                image.Levels.push_back({ width, height, offset, size });
+                offset += size;
+                width = std::max(1u, width / 2);
+                height = std::max(1u, height / 2);
+            }
+            return true;
+        }
+
+        // Garde uniquement les données des niveaux (décalages relatifs à Pixels)
+        void CompactLevels(Image& image, const uint8_t* file) {
+            size_t total = 0;
+            for (const ImageLevel& level : image.Levels)
+                total += level.Size;
+            image.Pixels.resize(total);
+
+            size_t offset = 0;
+            for (ImageLevel& level : image.Levels) {
+                std::memcpy(image.Pixels.data() + offset, file + level.Offset, level.Size);
+                level.Offset = offset;
+                offset += level.Size;
+            }
+        }
+
+        // DDS : en-tête de 128 octets (+20 pour l'extension DX10)
+        bool LoadDDS(const uint8_t* file, size_t fileSize, Image& image) {
+            constexpr size_t HeaderSize = 128;
+            if (fileSize < HeaderSize || std::memcmp(file, "DDS ", 4) != 0)
+                return false;
+
+            image.Height = ReadValue<uint32_t>(file, 12);
+            image.Width = ReadValue<uint32_t>(file, 16);
+            if (image.Width == 0 || image.Height == 0)
+                return false;
+            uint32_t mipCount = std::clamp(ReadValue<uint32_t>(file, 28), 1u, GetMaxLevelCount(image.Width, image.Height));
+
+            size_t dataOffset = HeaderSize;
+            char fourCC[4];
+            std::memcpy(fourCC, file + 84, 4);
+            if (std::memcmp(fourCC, "DXT1", 4) == 0) {
+                image.Format = ImageFormat::BC1;
+            } else if (std::memcmp(fourCC, "DXT5", 4) == 0) {
+                image.Format = ImageFormat::BC3;
+            } else if (std::memcmp(fourCC, "DX10", 4) == 0) {
+                if (fileSize < HeaderSize + 20)
+                    return false;
+                switch (ReadValue<uint32_t>(file, HeaderSize)) { // DXGI_FORMAT
+                    case 71: case 72: image.Format = ImageFormat::BC1; break;
+                    case 77: case 78: image.Format = ImageFormat::BC3; break;
+                    case 98: case 99: image.Format = ImageFormat::BC7; break;
+                    default: return false;
+                }
+                dataOffset += 20;
+            } else {
+                return false;
+            }
+
+            return BuildLevels(image, mipCount, dataOffset, fileSize);
+        }
+
+        // KTX2 : index des niveaux après l'en-tête, sans supercompression
+        bool LoadKTX2(const uint8_t* file, size_t fileSize, Image& image) {
+            static const uint8_t Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+            constexpr size_t LevelIndexOffset = 80;
+            if (fileSize < LevelIndexOffset || std::memcmp(file, Identifier, sizeof(Identifier)) != 0)
+                return false;
+
+            switch (ReadValue<uint32_t>(file, 12)) { // VkFormat
+                case 131: case 132: case 133: case 134: image.Format = ImageFormat::BC1; break;
+                case 137: case 138: image.Format = ImageFormat::BC3; break;
+                case 145: case 146: image.Format = ImageFormat::BC7; break;
+                default: return false;
+            }
+            image.Width = ReadValue<uint32_t>(file, 20);
+            image.Height = std::max(1u, ReadValue<uint32_t>(file, 24));
+            if (image.Width == 0)
+                return false;
+            uint32_t levelCount = std::clamp(ReadValue<uint32_t>(file, 40), 1u, GetMaxLevelCount(image.Width, image.Height));
+            if (ReadValue<uint32_t>(file, 44) != 0) // supercompressionScheme
+                return false;
+            if (fileSize < LevelIndexOffset + (size_t)levelCount * 24)
+                return false;
+
+            // Chaque niveau a son propre décalage dans le fichier (niveau 0 = le plus grand)
+            uint32_t width = image.Width, height = image.Height;
+            for (uint32_t level = 0; level < levelCount; ++level) {
+                size_t entry = LevelIndexOffset + (size_t)level * 24;
+                size_t offset = (size_t)ReadValue<uint64_t>(file, entry);
+                size_t size = (size_t)ReadValue<uint64_t>(file, entry + 8);
+                if (offset > fileSize || size > fileSize - offset || size < Image::GetCompressedSize(image.Format, width, height))
+                    return false;
+                image.Levels.push_back({ width, height, offset, Image::GetCompressedSize(image.Format, width, height) });
+                width = std::max(1u, width / 2);
+                height = std::max(1u, height / 2);
+            }
+            return true;
+        }
+
+        bool IsContainer(const std::string& filepath) {
+            return HasExtension(filepath, ".dds") || HasExtension(filepath, ".ktx2");
+        }
+
+        Image LoadContainer(const uint8_t* file, size_t fileSize, bool dds, const std::string& name) {
+            Image image;
+            bool loaded = dds ? LoadDDS(file, fileSize, image) : LoadKTX2(file, fileSize, image);
+            if (!loaded || image.Width == 0 || image.Levels.empty()) {
+                Logger::Error("Unsupported or corrupt texture container '{}' (BC1/BC3/BC7 expected)", name);
+                return {};
+            }
+
+            image.Channels = 4;
+            CompactLevels(image, file);
+            return image;
+        }
+
+    } // namespace
+
+    size_t Image::GetCompressedSize(ImageFormat format, uint32_t width, uint32_t height) {
+        size_t blockSize = format == ImageFormat::BC1 ? 8 : 16;
+        return (size_t)((width + 3) / 4) * ((height + 3) / 4) * blockSize;
+    }
+
+    Image Image::Load(const std::string& filepath, uint32_t desiredChannels) {
+        // Archive montée ou fichier isolé
+        AssetData file = AssetManager::Get().ReadAsset(filepath);
+        if (!file.IsValid()) {
+            Logger::Error("Failed to open image '{}'", filepath);
+            return {};
+        }
+        return LoadFromMemory(file.Data, file.Size, filepath, desiredChannels);
+    }
+
+    Image Image::LoadFromMemory(const uint8_t* data, size_t size, const std::string& name, uint32_t desiredChannels) {
+        if (IsContainer(name))
+            return LoadContainer(data, size, HasExtension(name, ".dds"), name);
+
+        Image image;
+
+        // Retournement par thread : le décodage peut se faire sur les workers
+        stbi_set_flip_vertically_on_load_thread(1);
+
+        int width, height, channels;
+        stbi_uc* pixels = stbi_load_from_memory(data, (int)size, &width, &height, &channels, (int)desiredChannels);
+        if (!pixels) {
+            Logger::Error("Failed to load image '{}': {}", name, stbi_failure_reason());
+            return image;
+        }
+
+        image.Width = (uint32_t)width;
+        image.Height = (uint32_t)height;
+        image.Channels = desiredChannels ? desiredChannels : (uint32_t)channels;
+        image.Pixels.resize((size_t)image.Width * image.Height * image.Channels);
+        std::memcpy(image.Pixels.data(), pixels, image.Pixels.size());
+        stbi_image_free(pixels);
+        return image;
+    }
+
+    bool Image::WritePNG(const std::string& filepath) const {
+        if (!IsValid() || IsCompressed())
+            return false;
+
+        // Les lignes sont stockées de bas en haut : retourner à l'écriture
+        stbi_flip_vertically_on_write(1);
+        if (!stbi_write_png(filepath.c_str(), (int)Width, (int)Height, (int)Channels, Pixels.data(), (int)(Width * Channels))) {
+            Logger::Error("Failed to write image '{}'", filepath);
+            return false;
+        }
+        return true;
+    }
+
+} // namespace Tesseract
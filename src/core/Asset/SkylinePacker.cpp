@@ -0,0 +1,105 @@
+#include "core/Asset/SkylinePacker.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace Tesseract {
+
+    void SkylinePacker::Reset(uint32_t width, uint32_t height) {
+        m_Width = width;
+        m_Height = height;
+        m_UsedArea = 0;
+        m_Skyline.clear();
+        m_Skyline.push_back({ 0, 0, width });
+    }
+
+    bool SkylinePacker::Fit(size_t index, uint32_t width, uint32_t height, uint32_t& outY) const {
+        uint32_t x = m_Skyline[index].X;
+        if (x + width > m_Width)
+            return false;
+
+        // Le rectangle repose sur le plus haut des segments qu'il recouvre
+        uint32_t y = 0;
+        uint32_t remaining = width;
+        for (size_t i = index; remaining > 0; ++i) {
+            if (i == m_Skyline.size())
+                return false;
+            y = std::max(y, m_Skyline[i].Y);
+            if (y + height > m_Height)
+                return false;
+            remaining -= std::min(remaining, m_Skyline[i].Width);
+        }
+        outY = y;
+        return true;
+    }
+
+    bool SkylinePacker::Insert(uint32_t width, uint32_t height, uint32_t& outX, uint32_t& outY) {
+        if (width == 0 || height == 0)
+            return false;
+
+        size_t bestIndex = m_Skyline.size();
+        uint32_t bestTop = std::numeric_limits<uint32_t>::max();
+        uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+        uint32_t bestY = 0;
+
+        for (size_t i = 0; i < m_Skyline.size(); ++i) {
+            uint32_t y;
+            if (!Fit(i, width, height, y))
+                continue;
+
+            uint32_t top = y + height;
+            if (top < bestTop || (top == bestTop && m_Skyline[i].Width < bestWidth)) {
+                bestIndex = i;
+                bestTop = top;
+                bestWidth = m_Skyline[i].Width;
+                bestY = y;
+            }
+        }
+
+        if (bestIndex == m_Skyline.size())
+            return false;
+
+        outX = m_Skyline[bestIndex].X;
+        outY = bestY;
+        AddLevel(bestIndex, outX, outY, width, height);
+        m_UsedArea += (uint64_t)width * height;
+        return true;
+    }
+
+    void SkylinePacker::AddLevel(size_t index, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+        m_Skyline.insert(m_Skyline.begin() + index, { x, y + height, width });
+
+        // Raboter ou retirer les segments recouverts par le nouveau
+        for (size_t i = index + 1; i < m_Skyline.size();) {
+            Segment& segment = m_Skyline[i];
+            uint32_t newEnd = x + width;
+            if (segment.X >= newEnd)
+                break;
+
+            uint32_t segmentEnd = segment.X + segment.Width;
+            if (segmentEnd <= newEnd) {
+                m_Skyline.erase(m_Skyline.begin() + i);
+                continue;
+            }
+            segment.Width = segmentEnd - newEnd;
+            segment.X = newEnd;
+            break;
+        }
+
+        // Fusionner les segments voisins de même hauteur
+        for (size_t i = 0; i + 1 < m_Skyline.size();) {
+            if (m_Skyline[i].Y == m_Skyline[i + 1].Y) {
+                m_Skyline[i].Width += m_Skyline[i + 1].Width;
+                m_Skyline.erase(m_Skyline.begin() + i + 1);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    float SkylinePacker::GetOccupancy() const {
+        uint64_t area = (uint64_t)m_Width * m_Height;
+        return area ? (float)((double)m_UsedArea / (double)area) : 0.0f;
+    }
+
+} // namespace Tesseract
@@ -0,0 +1,270 @@
+#include "core/Asset/TextureAtlas.hpp"
+#include "core/Logger.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace Tesseract {
+
+    namespace {
+
+        constexpr const char* AtlasMagic = "tesseract-atlas";
+        constexpr uint32_t AtlasVersion = 1;
+
+        // Convertit une image 1 à 4 canaux en RGBA8
+        Image ToRGBA(const Image& image) {
+            if (image.Channels == 4)
+                return image;
+
+            Image rgba;
+            rgba.Width = image.Width;
+            rgba.Height = image.Height;
+            rgba.Channels = 4;
+            rgba.Pixels.resize((size_t)image.Width * image.Height * 4);
+
+            const size_t pixelCount = (size_t)image.Width * image.Height;
+            for (size_t i = 0; i < pixelCount; ++i) {
+                const uint8_t* src = &image.Pixels[i * image.Channels];
+                uint8_t* dst = &rgba.Pixels[i * 4];
+                switch (image.Channels) {
+                    case 1: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = 255; break;
+                    case 2: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = src[1]; break;
+                    default: dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = 255; break;
+                }
+            }
+            return rgba;
+        }
+
+        std::string PageFilePath(const std::filesystem::path& metadataPath, uint32_t index) {
+            std::filesystem::path page = metadataPath;
+            page.replace_filename(metadataPath.stem().string() + "_" + std::to_string(index) + ".png");
+            return page.string();
+        }
+
+    } // namespace
+
+    TextureAtlas::TextureAtlas(uint32_t pageSize, uint32_t padding)
+        : m_PageSize(pageSize), m_Padding(padding) {
+    }
+
+    TextureAtlas::Page& TextureAtlas::AddPage() {
+        Page& page = m_Pages.emplace_back();
+        page.Pixels.Width = m_PageSize;
+        page.Pixels.Height = m_PageSize;
+        page.Pixels.Channels = 4;
+        page.Pixels.Pixels.assign((size_t)m_PageSize * m_PageSize * 4, 0);
+        page.Packer.Reset(m_PageSize, m_PageSize);
+        return page;
+    }
+
+    void TextureAtlas::Blit(Page& page, const Image& image, uint32_t x, uint32_t y) {
+        // Copie l'image et étend ses bords sur la bordure (x, y = coin de la zone avec bordure)
+        const int32_t padding = (int32_t)m_Padding;
+        const int32_t width = (int32_t)image.Width;
+        const int32_t height = (int32_t)image.Height;
+
+        for (int32_t row = -padding; row < height + padding; ++row) {
+            int32_t srcRow = std::clamp(row, 0, height - 1);
+            uint8_t* dst = &page.Pixels.Pixels[((size_t)(y + padding + row) * m_PageSize + x) * 4];
+            const uint8_t* src = &image.Pixels[(size_t)srcRow * width * 4];
+
+            for (int32_t column = 0; column < padding; ++column)
+                std::copy_n(src, 4, dst + column * 4);
+            std::copy_n(src, (size_t)width * 4, dst + padding * 4);
+            for (int32_t column = 0; column < padding; ++column)
+                std::copy_n(src + (width - 1) * 4, 4, dst + (padding + width + column) * 4);
+        }
+        page.Dirty = true;
+    }
+
+    bool TextureAtlas::AddImage(const std::string& name, const Image& image) {
+        if (!image.IsValid()) {
+            Logger::Error("TextureAtlas: image '{}' invalide", name);
+            return false;
+        }
+        if (image.IsCompressed()) {
+            Logger::Error("TextureAtlas: image compressée '{}' non supportée", name);
+            return false;
+        }
+        if (HasRegion(name)) {
+            Logger::Warn("TextureAtlas: la région '{}' existe déjà", name);
+            return false;
+        }
+
+        uint32_t paddedWidth = image.Width + m_Padding * 2;
+        uint32_t paddedHeight = image.Height + m_Padding * 2;
+        if (paddedWidth > m_PageSize || paddedHeight > m_PageSize) {
+            Logger::Error("TextureAtlas: '{}' ({}x{}) dépasse la taille d'une page ({})", name, image.Width, image.Height, m_PageSize);
+            return false;
+        }
+
+        // Première page qui l'accepte, sinon une nouvelle page
+        uint32_t x = 0, y = 0;
+        uint32_t pageIndex = 0;
+        for (; pageIndex < m_Pages.size(); ++pageIndex) {
+            Page& page = m_Pages[pageIndex];
+            if (!page.Sealed && page.Packer.Insert(paddedWidth, paddedHeight, x, y))
+                break;
+        }
+        if (pageIndex == m_Pages.size()) {
+            AddPage().Packer.Insert(paddedWidth, paddedHeight, x, y);
+            Logger::Debug("TextureAtlas: nouvelle page {} ({}x{})", pageIndex, m_PageSize, m_PageSize);
+        }
+
+        Blit(m_Pages[pageIndex], image.Channels == 4 ? image : ToRGBA(image), x, y);
+        m_Regions[name] = { pageIndex, x + m_Padding, y + m_Padding, image.Width, image.Height };
+        return true;
+    }
+
+    bool TextureAtlas::AddImageFromFile(const std::string& name, const std::string& filepath) {
+        Image image = Image::Load(filepath, 4);
+        if (!image.IsValid()) {
+            Logger::Error("TextureAtlas: impossible de charger '{}'", filepath);
+            return false;
+        }
+        return AddImage(name, image);
+    }
+
+    bool TextureAtlas::HasRegion(const std::string& name) const {
+        return m_Regions.find(name) != m_Regions.end();
+    }
+
+    const TextureAtlas::Region* TextureAtlas::GetRegion(const std::string& name) const {
+        auto it = m_Regions.find(name);
+        return it != m_Regions.end() ? &it->second : nullptr;
+    }
+
+    SubTexture2D TextureAtlas::GetSubTexture(const std::string& name) {
+        const Region* region = GetRegion(name);
+        if (!region) {
+            Logger::Warn("TextureAtlas: région '{}' introuvable", name);
+            return {};
+        }
+
+        float size = (float)m_PageSize;
+        glm::vec2 uvMin = { region->X / size, region->Y / size };
+        glm::vec2 uvMax = { (region->X + region->Width) / size, (region->Y + region->Height) / size };
+        return SubTexture2D(GetPageTexture(region->Page), uvMin, uvMax);
+    }
+
+    void TextureAtlas::Upload() {
+        for (Page& page : m_Pages) {
+            if (!page.Dirty)
+                continue;
+            if (!page.Texture)
+                page.Texture = Texture2D::Create(m_PageSize, m_PageSize);
+            page.Texture->SetData(page.Pixels.Pixels.data(), (uint32_t)page.Pixels.GetSize());
+            page.Dirty = false;
+        }
+    }
+
+    Ref<Texture2D> TextureAtlas::GetPageTexture(uint32_t page) {
+        if (page >= m_Pages.size())
+            return nullptr;
+        Upload();
+        return m_Pages[page].Texture;
+    }
+
+    AssetMemory TextureAtlas::GetMemoryUsage() const {
+        AssetMemory memory;
+        for (const Page& page : m_Pages) {
+            memory.CPUBytes += page.Pixels.GetSize();
+            if (page.Texture)
+                memory.GPUBytes += page.Texture->GetMemorySize();
+        }
+        return memory;
+    }
+
+    bool TextureAtlas::Save(const std::string& metadataPath) const {
+        namespace fs = std::filesystem;
+        fs::path path(metadataPath);
+        if (path.has_parent_path()) {
+            std::error_code error;
+            fs::create_directories(path.parent_path(), error);
+        }
+
+        std::ofstream file(metadataPath, std::ios::trunc);
+        if (!file) {
+            Logger::Error("TextureAtlas: impossible d'écrire '{}'", metadataPath);
+            return false;
+        }
+
+        file << AtlasMagic << ' ' << AtlasVersion << '\n';
+        file << "pagesize " << m_PageSize << ' ' << m_Padding << '\n';
+        for (uint32_t i = 0; i < m_Pages.size(); ++i) {
+            std::string pagePath = PageFilePath(path, i);
+            if (!m_Pages[i].Pixels.WritePNG(pagePath)) {
+                Logger::Error("TextureAtlas: impossible d'écrire la page '{}'", pagePath);
+                return false;
+            }
+            file << "page " << fs::path(pagePath).filename().string() << '\n';
+        }
+        // Le nom est en fin de ligne : il peut contenir des espaces
+        for (const auto& [name, region] : m_Regions)
+            file << "region " << region.Page << ' ' << region.X << ' ' << region.Y << ' '
+                 << region.Width << ' ' << region.Height << ' ' << name << '\n';
+
+        Logger::Info("TextureAtlas: {} régions, {} pages écrites dans '{}'", m_Regions.size(), m_Pages.size(), metadataPath);
+        return true;
+    }
+
+    Ref<TextureAtlas> TextureAtlas::Load(const std::string& metadataPath) {
+        namespace fs = std::filesystem;
+        std::ifstream file(metadataPath);
+        if (!file)
+            return nullptr;
+
+        std::string magic;
+        uint32_t version = 0;
+        file >> magic >> version;
+        if (magic != AtlasMagic || version != AtlasVersion) {
+            Logger::Warn("TextureAtlas: '{}' n'est pas un atlas valide (version {})", metadataPath, version);
+            return nullptr;
+        }
+
+        Ref<TextureAtlas> atlas;
+        std::string line;
+        while (std::getline(file, line)) {
+            std::istringstream stream(line);
+            std::string keyword;
+            stream >> keyword;
+
+            if (keyword == "pagesize") {
+                uint32_t pageSize = 0, padding = 0;
+                stream >> pageSize >> padding;
+                atlas = CreateRef<TextureAtlas>(pageSize, padding);
+            } else if (keyword == "page" && atlas) {
+                std::string filename;
+                stream >> filename;
+                fs::path pagePath = fs::path(metadataPath).replace_filename(filename);
+
+                Image pixels = Image::Load(pagePath.string(), 4);
+                if (pixels.Width != atlas->m_PageSize || pixels.Height != atlas->m_PageSize) {
+                    Logger::Warn("TextureAtlas: page '{}' absente ou de taille inattendue", pagePath.string());
+                    return nullptr;
+                }
+                Page& page = atlas->m_Pages.emplace_back();
+                page.Pixels = std::move(pixels);
+                page.Sealed = true;
+            } else if (keyword == "region" && atlas) {
+                Region region;
+                stream >> region.Page >> region.X >> region.Y >> region.Width >> region.Height;
+                std::string name;
+                stream.get();
+                std::getline(stream, name);
+                if (!stream.fail() && region.Page < atlas->m_Pages.size())
+                    atlas->m_Regions[name] = region;
+            }
+        }
+
+        if (!atlas) {
+            Logger::Warn("TextureAtlas: '{}' ne décrit aucune page", metadataPath);
+            return nullptr;
+        }
+        Logger::Info("TextureAtlas: {} régions chargées depuis '{}'", atlas->m_Regions.size(), metadataPath);
+        return atlas;
+    }
+
+} // namespace Tesseract
@@ -0,0 +1,193 @@
+#include "core/AsyncLogSink.hpp"
+
+#include <string>
+
+namespace Tesseract {
+
+    namespace {
+
+        // Attente du thread d'écriture quand la file est vide
+        constexpr auto IdleWait = std::chrono::milliseconds(2);
+
+        size_t RoundUpToPowerOfTwo(size_t value) {
+            size_t result = 2;
+            while (result < value)
+                result <<= 1;
+            return result;
+        }
+
+    } // namespace
+
+    AsyncLogSink::AsyncLogSink(std::vector<spdlog::sink_ptr> sinks, const LoggerSettings& settings)
+        : m_Sinks(std::move(sinks)), m_Overflow(settings.Overflow),
+          m_FlushInterval(std::chrono::milliseconds(settings.FlushIntervalMs)) {
+        size_t capacity = RoundUpToPowerOfTwo(settings.QueueCapacity);
+        m_Cells.reset(new Cell[capacity]);
+        m_Mask = capacity - 1;
+        for (size_t i = 0; i < capacity; ++i)
+            m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+
+        m_Running = true;
+        m_Writer = std::thread(&AsyncLogSink::WriterLoop, this);
+    }
+
+    AsyncLogSink::~AsyncLogSink() {
+        Stop();
+    }
+
+    bool AsyncLogSink::TryEnqueue(const spdlog::details::log_msg& msg) {
+        size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = m_Cells[pos & m_Mask];
+            size_t sequence = cell.Sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+            if (diff == 0) {
+                // Cellule libre : la réserver avant d'y copier le message
+                if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.Message = spdlog::details::log_msg_buffer(msg);
+                    cell.Sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // File pleine
+            } else {
+                pos = m_EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    AsyncLogSink::Cell* AsyncLogSink::Front() {
+        size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+        Cell& cell = m_Cells[pos & m_Mask];
+        if (cell.Sequence.load(std::memory_order_acquire) != pos + 1)
+            return nullptr;
+        return &cell;
+    }
+
+    void AsyncLogSink::PopFront() {
+        size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+        m_Cells[pos & m_Mask].Sequence.store(pos + m_Mask + 1, std::memory_order_release);
+        m_DequeuePos.store(pos + 1, std::memory_order_release);
+    }
+
+    void AsyncLogSink::log(const spdlog::details::log_msg& msg) {
+        // Après Stop (destructeurs statiques...) : écriture directe
+        if (!m_Running.load(std::memory_order_acquire)) {
+            for (auto& sink : m_Sinks) {
+                if (sink->should_log(msg.level))
+                    sink->log(msg);
+            }
+            return;
+        }
+
+        if (TryEnqueue(msg))
+            return;
+
+        // Les erreurs ne sont jamais perdues, quelle que soit la politique
+        if (m_Overflow == LogOverflowPolicy::Block || msg.level >= spdlog::level::err) {
+            do {
+                m_Wake.notify_one();
+                std::this_thread::yield();
+            } while (!TryEnqueue(msg));
+            return;
+        }
+
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+        m_TotalDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void AsyncLogSink::flush() {
+        m_FlushRequested.store(true, std::memory_order_release);
+    }
+
+    void AsyncLogSink::set_pattern(const std::string& pattern) {
+        for (auto& sink : m_Sinks)
+            sink->set_pattern(pattern);
+    }
+
+    void AsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> formatter) {
+        for (auto& sink : m_Sinks)
+            sink->set_formatter(formatter->clone());
+    }
+
+    void AsyncLogSink::Drain() {
+        if (!m_Running.load(std::memory_order_acquire) || std::this_thread::get_id() == m_Writer.get_id())
+            return;
+
+        // Un message réservé mais pas encore publié peut manquer au premier vidage : redemander
+        size_t target = m_EnqueuePos.load(std::memory_order_acquire);
+        while (m_FlushedPos.load(std::memory_order_acquire) < target) {
+            flush();
+            m_Wake.notify_one();
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+
+    void AsyncLogSink::Stop() {
+        if (!m_Running.exchange(false))
+            return;
+        m_Wake.notify_one();
+        m_Writer.join();
+    }
+
+    void AsyncLogSink::FlushSinks() {
+        for (auto& sink : m_Sinks)
+            sink->flush();
+    }
+
+    void AsyncLogSink::WriterLoop() {
+        using Clock = std::chrono::steady_clock;
+        auto lastFlush = Clock::now();
+        bool dirty = false;
+
+        while (true) {
+            bool wrote = false;
+            bool urgent = false;
+            while (Cell* cell = Front()) {
+                const spdlog::details::log_msg& msg = cell->Message;
+                for (auto& sink : m_Sinks) {
+                    if (sink->should_log(msg.level))
+                        sink->log(msg);
+                }
+                urgent |= msg.level >= spdlog::level::err;
+                PopFront();
+                wrote = true;
+            }
+
+            // Messages perdus (DropNewest) : signalés dans le journal lui-même
+            if (uint64_t dropped = m_Dropped.exchange(0, std::memory_order_relaxed)) {
+                std::string text = std::to_string(dropped) + " messages perdus (file de journalisation pleine)";
+                spdlog::details::log_msg msg("TESSERACT", spdlog::level::warn, text);
+                for (auto& sink : m_Sinks)
+                    sink->log(msg);
+                wrote = true;
+            }
+            dirty |= wrote;
+            size_t written = m_DequeuePos.load(std::memory_order_relaxed);
+
+            auto now = Clock::now();
+            bool requested = m_FlushRequested.exchange(false, std::memory_order_acq_rel);
+            if (requested || urgent || (dirty && now - lastFlush >= m_FlushInterval)) {
+                FlushSinks();
+                lastFlush = now;
+                dirty = false;
+                m_FlushedPos.store(written, std::memory_order_release);
+            }
+
+            if (!m_Running.load(std::memory_order_acquire)) {
+                if (Front())
+                    continue; // Vider la file avant de s'arrêter
+                break;
+            }
+
+            if (!wrote) {
+                std::unique_lock<std::mutex> lock(m_WakeMutex);
+                m_Wake.wait_for(lock, IdleWait);
+            }
+        }
+
+        FlushSinks();
+        m_FlushedPos.store(m_DequeuePos.load(std::memory_order_relaxed), std::memory_order_release);
+    }
+
+} // namespace Tesseract
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "core/Logger.hpp"
+
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/sinks/sink.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Tesseract {
+
+    /**
+     * @class AsyncLogSink
+     * @brief Sink spdlog qui confie l'écriture des messages à un thread dédié
+     *
+     * Les messages (déjà formatés par le logger) sont copiés dans une file
+     * bornée sans verrou (multi-producteurs) ; le thread d'écriture les
+     * transmet aux sinks réels, vide ceux-ci périodiquement et immédiatement
+     * après une erreur. Aucune E/S n'a lieu sur le thread qui journalise.
+     */
+    class AsyncLogSink : public spdlog::sinks::sink {
+    public:
+        AsyncLogSink(std::vector<spdlog::sink_ptr> sinks, const LoggerSettings& settings);
+        ~AsyncLogSink() override;
+
+        void log(const spdlog::details::log_msg& msg) override;
+        // Demande un vidage au thread d'écriture (ne bloque pas)
+        void flush() override;
+        void set_pattern(const std::string& pattern) override;
+        void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+        // Attend que les messages déjà soumis soient écrits et vidés
+        void Drain();
+        // Vide la file puis arrête le thread d'écriture
+        void Stop();
+
+        uint64_t GetDroppedCount() const { return m_TotalDropped.load(std::memory_order_relaxed); }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> Sequence{ 0 };
+            spdlog::details::log_msg_buffer Message;
+        };
+
+        bool TryEnqueue(const spdlog::details::log_msg& msg);
+        // Consommateur unique : message en tête lu sur place puis libéré
+        Cell* Front();
+        void PopFront();
+        void WriterLoop();
+        void FlushSinks();
+
+        std::vector<spdlog::sink_ptr> m_Sinks;
+        LogOverflowPolicy m_Overflow;
+        std::chrono::milliseconds m_FlushInterval;
+
+        // File bornée de D. Vyukov : une séquence par cellule, positions séparées
+        // sur des lignes de cache distinctes
+        std::unique_ptr<Cell[]> m_Cells;
+        size_t m_Mask = 0;
+        alignas(64) std::atomic<size_t> m_EnqueuePos{ 0 };
+        alignas(64) std::atomic<size_t> m_DequeuePos{ 0 };
+
+        alignas(64) std::atomic<uint64_t> m_Dropped{ 0 };
+        std::atomic<uint64_t> m_TotalDropped{ 0 };
+        std::atomic<bool> m_FlushRequested{ false };
+        std::atomic<size_t> m_FlushedPos{ 0 }; // Messages écrits et vidés (Drain)
+
+        std::thread m_Writer;
+        std::mutex m_WakeMutex;
+        std::condition_variable m_Wake;
+        std::atomic<bool> m_Running{ false };
+    };
+
+} // namespace Tesseract
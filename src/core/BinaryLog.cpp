@@ -0,0 +1,502 @@
+#include "core/BinaryLog.hpp"
+
+#include <spdlog/details/os.h>
+#if defined(SPDLOG_FMT_EXTERNAL)
+    #include <fmt/args.h>
+#else
+    #include <spdlog/fmt/bundled/args.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Tesseract {
+
+    std::atomic<int> BinaryLog::s_Level{ (int)spdlog::level::trace };
+
+    namespace {
+
+        // En-tête d'un enregistrement dans un tampon de thread, suivi des arguments ;
+        // chaque enregistrement occupe un multiple de sa taille
+        struct RecordHeader {
+            uint32_t Site;     // WrapSite : fin du tampon atteinte, reprendre au début
+            uint32_t ArgsSize;
+            int64_t TimeNs;
+        };
+        constexpr uint64_t RecordAlign = sizeof(RecordHeader);
+        constexpr uint32_t WrapSite = 0;
+        constexpr uint32_t MinThreadBufferSize = 4096;
+
+        // Fichier : en-tête puis blocs (définition de point d'appel avant son premier enregistrement)
+        constexpr uint32_t FileMagic = 0x4C425354; // "TSBL"
+        constexpr uint32_t FileVersion = 1;
+        constexpr uint8_t SiteBlock = 'S';
+        constexpr uint8_t RecordBlock = 'R';
+
+        // Anneau d'octets à un producteur (le thread propriétaire) et un consommateur (le décodeur)
+        struct ThreadBuffer {
+            std::unique_ptr<uint8_t[]> Data;
+            uint64_t Mask = 0;
+            uint64_t ThreadId = 0;
+            uint64_t Pending = 0; // Fin de l'enregistrement réservé, publiée par Commit
+            alignas(64) std::atomic<uint64_t> Head{ 0 };
+            alignas(64) std::atomic<uint64_t> Tail{ 0 };
+            std::atomic<bool> Abandoned{ false };
+        };
+
+        struct BinaryLogData {
+            BinaryLogSettings Settings;
+            std::atomic<bool> Running{ false };
+            std::atomic<uint64_t> Dropped{ 0 };
+            uint64_t ReportedDropped = 0;
+
+            std::mutex RegistryMutex;
+            std::vector<BinaryLog::Site> Sites; // Indice = identifiant - 1
+            std::vector<std::shared_ptr<ThreadBuffer>> Buffers;
+
+            std::thread Decoder;
+            std::mutex WakeMutex;
+            std::condition_variable Wake;
+
+            std::ofstream File;
+            std::vector<bool> SitesWritten;
+        };
+
+        BinaryLogData s_Data;
+
+        // Le tampon survit au thread : le décodeur le retire une fois vidé
+        struct ThreadBufferOwner {
+            std::shared_ptr<ThreadBuffer> Buffer;
+
+            ~ThreadBufferOwner() {
+                if (Buffer)
+                    Buffer->Abandoned.store(true, std::memory_order_release);
+            }
+        };
+
+        thread_local ThreadBufferOwner t_Owner;
+
+        uint64_t AlignRecord(uint64_t size) {
+            return (size + RecordAlign - 1) & ~(RecordAlign - 1);
+        }
+
+        ThreadBuffer& GetThreadBuffer() {
+            if (!t_Owner.Buffer) {
+                uint64_t capacity = MinThreadBufferSize;
+                while (capacity < s_Data.Settings.ThreadBufferSize)
+                    capacity <<= 1;
+
+                auto buffer = std::make_shared<ThreadBuffer>();
+                buffer->Data.reset(new uint8_t[capacity]);
+                buffer->Mask = capacity - 1;
+                buffer->ThreadId = (uint64_t)spdlog::details::os::thread_id();
+                {
+                    std::lock_guard<std::mutex> lock(s_Data.RegistryMutex);
+                    s_Data.Buffers.push_back(buffer);
+                }
+                t_Owner.Buffer = std::move(buffer);
+            }
+            return *t_Owner.Buffer;
+        }
+
+        int64_t NowNs() {
+            auto now = std::chrono::system_clock::now().time_since_epoch();
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+        }
+
+        template<typename T>
+        bool ReadValue(const uint8_t*& cursor, const uint8_t* end, T& value) {
+            if ((size_t)(end - cursor) < sizeof(T))
+                return false;
+            std::memcpy(&value, cursor, sizeof(T));
+            cursor += sizeof(T);
+            return true;
+        }
+
+        template<typename T>
+        void WriteValue(std::ofstream& file, const T& value) {
+            file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void WriteString(std::ofstream& file, const char* text) {
+            uint16_t length = (uint16_t)std::min<size_t>(std::strlen(text), 0xFFFF);
+            WriteValue(file, length);
+            file.write(text, length);
+        }
+
+        template<typename T>
+        bool ReadPod(std::ifstream& file, T& value) {
+            return (bool)file.read(reinterpret_cast<char*>(&value), sizeof(T));
+        }
+
+        bool ReadString(std::ifstream& file, std::string& text) {
+            uint16_t length = 0;
+            if (!ReadPod(file, length))
+                return false;
+            text.resize(length);
+            return length == 0 || (bool)file.read(text.data(), length);
+        }
+
+        // Points d'appel connus du décodeur (copie locale, complétée à la demande)
+        const BinaryLog::Site* FindSite(uint32_t id, std::vector<BinaryLog::Site>& cache) {
+            if (id > cache.size()) {
+                std::lock_guard<std::mutex> lock(s_Data.RegistryMutex);
+                cache = s_Data.Sites;
+            }
+            return id != WrapSite && id <= cache.size() ? &cache[id - 1] : nullptr;
+        }
+
+        void EmitDecoded(const ThreadBuffer& buffer, const RecordHeader& header, const uint8_t* args,
+                         const BinaryLog::Site& site) {
+            auto& logger = Logger::GetCoreLogger();
+            if (!logger)
+                return;
+
+            std::string text = BinaryLog::FormatArgs(site.Format, args, header.ArgsSize);
+            auto time = spdlog::log_clock::time_point(
+                std::chrono::duration_cast<spdlog::log_clock::duration>(std::chrono::nanoseconds(header.TimeNs)));
+            spdlog::details::log_msg msg(time, spdlog::source_loc(site.File, (int)site.Line, ""),
+                                         logger->name(), site.Level, text);
+            msg.thread_id = (size_t)buffer.ThreadId;
+
+            for (auto& sink : logger->sinks()) {
+                if (sink->should_log(msg.level)) {
+                    sink->log(msg);
+                    if (msg.level >= spdlog::level::err)
+                        sink->flush();
+                }
+            }
+        }
+
+        void EmitToFile(const ThreadBuffer& buffer, uint32_t siteId, const RecordHeader& header, const uint8_t* args,
+                        const BinaryLog::Site& site) {
+            std::ofstream& file = s_Data.File;
+            if (siteId > s_Data.SitesWritten.size())
+                s_Data.SitesWritten.resize(siteId, false);
+            if (!s_Data.SitesWritten[siteId - 1]) {
+                WriteValue(file, SiteBlock);
+                WriteValue(file, siteId);
+                WriteValue(file, (uint8_t)site.Level);
+                WriteValue(file, site.Line);
+                WriteString(file, site.File);
+                WriteString(file, site.Format);
+                s_Data.SitesWritten[siteId - 1] = true;
+            }
+
+            WriteValue(file, RecordBlock);
+            WriteValue(file, siteId);
+            WriteValue(file, buffer.ThreadId);
+            WriteValue(file, header.TimeNs);
+            WriteValue(file, header.ArgsSize);
+            file.write(reinterpret_cast<const char*>(args), header.ArgsSize);
+        }
+
+        struct Cursor {
+            ThreadBuffer* Buffer;
+            uint64_t Tail;
+            uint64_t Head;
+        };
+
+        // Prochain enregistrement du tampon (marqueurs de fin sautés), nul s'il est vide
+        const RecordHeader* Peek(Cursor& cursor) {
+            while (cursor.Tail < cursor.Head) {
+                uint64_t offset = cursor.Tail & cursor.Buffer->Mask;
+                auto* header = reinterpret_cast<const RecordHeader*>(cursor.Buffer->Data.get() + offset);
+                if (header->Site != WrapSite)
+                    return header;
+                cursor.Tail += cursor.Buffer->Mask + 1 - offset;
+            }
+            return nullptr;
+        }
+
+        // Relève tous les tampons en fusionnant les threads par horodatage
+        bool DecodePass(std::vector<BinaryLog::Site>& sites) {
+            std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+            {
+                std::lock_guard<std::mutex> lock(s_Data.RegistryMutex);
+                auto& registry = s_Data.Buffers;
+                registry.erase(std::remove_if(registry.begin(), registry.end(), [](const std::shared_ptr<ThreadBuffer>& buffer) {
+                    return buffer->Abandoned.load(std::memory_order_acquire) &&
+                           buffer->Tail.load(std::memory_order_relaxed) == buffer->Head.load(std::memory_order_acquire);
+                }), registry.end());
+                buffers = registry;
+            }
+
+            std::vector<Cursor> cursors;
+            cursors.reserve(buffers.size());
+            for (const auto& buffer : buffers)
+                cursors.push_back({ buffer.get(), buffer->Tail.load(std::memory_order_relaxed), buffer->Head.load(std::memory_order_acquire) });
+
+            bool wrote = false;
+            while (true) {
+                Cursor* next = nullptr;
+                const RecordHeader* nextHeader = nullptr;
+                for (Cursor& cursor : cursors) {
+                    const RecordHeader* header = Peek(cursor);
+                    if (header && (!nextHeader || header->TimeNs < nextHeader->TimeNs)) {
+                        next = &cursor;
+                        nextHeader = header;
+                    }
+                }
+                if (!next)
+                    break;
+
+                RecordHeader header = *nextHeader;
+                const uint8_t* args = reinterpret_cast<const uint8_t*>(nextHeader) + sizeof(RecordHeader);
+                if (const BinaryLog::Site* site = FindSite(header.Site, sites)) {
+                    if (s_Data.Settings.Mode == BinaryLogMode::File)
+                        EmitToFile(*next->Buffer, header.Site, header, args, *site);
+                    else
+                        EmitDecoded(*next->Buffer, header, args, *site);
+                    wrote = true;
+                }
+
+                // Place rendue au thread producteur aussitôt l'enregistrement traité
+                next->Tail += AlignRecord(sizeof(RecordHeader) + header.ArgsSize);
+                next->Buffer->Tail.store(next->Tail, std::memory_order_release);
+            }
+
+            uint64_t dropped = s_Data.Dropped.load(std::memory_order_relaxed);
+            if (dropped != s_Data.ReportedDropped) {
+                Logger::Warn("BinaryLog: {} messages perdus (tampon de thread plein)", dropped - s_Data.ReportedDropped);
+                s_Data.ReportedDropped = dropped;
+            }
+            return wrote;
+        }
+
+        void DecoderLoop() {
+            std::vector<BinaryLog::Site> sites;
+            auto interval = std::chrono::milliseconds(std::max<uint32_t>(s_Data.Settings.DecodeIntervalMs, 1));
+            while (true) {
+                bool running = s_Data.Running.load(std::memory_order_acquire);
+                if (DecodePass(sites) && s_Data.File.is_open())
+                    s_Data.File.flush();
+                if (!running)
+                    break; // Dernière relève faite après l'arrêt
+
+                std::unique_lock<std::mutex> lock(s_Data.WakeMutex);
+                s_Data.Wake.wait_for(lock, interval);
+            }
+        }
+
+    } // namespace
+
+    void BinaryLog::Init(const BinaryLogSettings& settings) {
+        if (s_Data.Running.load())
+            return;
+
+        s_Data.Settings = settings;
+        s_Data.SitesWritten.clear();
+        if (settings.Mode == BinaryLogMode::File) {
+            s_Data.File.open(settings.FilePath, std::ios::binary | std::ios::trunc);
+            if (!s_Data.File) {
+                Logger::Error("BinaryLog: impossible d'ouvrir '{}', décodage en direct", settings.FilePath);
+                s_Data.Settings.Mode = BinaryLogMode::Decode;
+            } else {
+                WriteValue(s_Data.File, FileMagic);
+                WriteValue(s_Data.File, FileVersion);
+            }
+        }
+
+        s_Data.Running.store(true, std::memory_order_release);
+        s_Data.Decoder = std::thread(DecoderLoop);
+    }
+
+    void BinaryLog::Shutdown() {
+        if (!s_Data.Running.exchange(false))
+            return;
+
+        s_Data.Wake.notify_one();
+        s_Data.Decoder.join();
+        if (s_Data.File.is_open())
+            s_Data.File.close();
+    }
+
+    void BinaryLog::Flush() {
+        if (!s_Data.Running.load(std::memory_order_acquire) || std::this_thread::get_id() == s_Data.Decoder.get_id())
+            return;
+
+        std::vector<std::pair<std::shared_ptr<ThreadBuffer>, uint64_t>> targets;
+        {
+            std::lock_guard<std::mutex> lock(s_Data.RegistryMutex);
+            for (const auto& buffer : s_Data.Buffers)
+                targets.emplace_back(buffer, buffer->Head.load(std::memory_order_acquire));
+        }
+        for (const auto& [buffer, head] : targets) {
+            while (buffer->Tail.load(std::memory_order_acquire) < head && s_Data.Running.load(std::memory_order_acquire)) {
+                s_Data.Wake.notify_one();
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+
+        if (s_Data.Settings.Mode == BinaryLogMode::Decode)
+            Logger::Flush();
+    }
+
+    uint64_t BinaryLog::GetDroppedCount() {
+        return s_Data.Dropped.load(std::memory_order_relaxed);
+    }
+
+    uint32_t BinaryLog::RegisterSite(const Site& site) {
+        std::lock_guard<std::mutex> lock(s_Data.RegistryMutex);
+        s_Data.Sites.push_back(site);
+        return (uint32_t)s_Data.Sites.size();
+    }
+
+    uint8_t* BinaryLog::Reserve(uint32_t site, uint32_t argsSize) {
+        if (!s_Data.Running.load(std::memory_order_relaxed))
+            return nullptr;
+
+        ThreadBuffer& buffer = GetThreadBuffer();
+        const uint64_t capacity = buffer.Mask + 1;
+        const uint64_t size = AlignRecord(sizeof(RecordHeader) + argsSize);
+        uint64_t head = buffer.Head.load(std::memory_order_relaxed);
+        uint64_t offset = head & buffer.Mask;
+        // Un enregistrement n'est jamais coupé en deux : la fin du tampon est sautée
+        uint64_t padding = offset + size > capacity ? capacity - offset : 0;
+        if (size > capacity / 2 || head + padding + size - buffer.Tail.load(std::memory_order_acquire) > capacity) {
+            s_Data.Dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        if (padding) {
+            RecordHeader wrap = { WrapSite, 0, 0 };
+            std::memcpy(buffer.Data.get() + offset, &wrap, sizeof(wrap));
+            head += padding;
+        }
+
+        RecordHeader header = { site, argsSize, NowNs() };
+        uint8_t* record = buffer.Data.get() + (head & buffer.Mask);
+        std::memcpy(record, &header, sizeof(header));
+        buffer.Pending = head + size;
+        return record + sizeof(RecordHeader);
+    }
+
+    void BinaryLog::Commit() {
+        ThreadBuffer& buffer = *t_Owner.Buffer;
+        buffer.Head.store(buffer.Pending, std::memory_order_release);
+    }
+
+    std::string BinaryLog::FormatArgs(const char* format, const uint8_t* args, size_t size) {
+        fmt::dynamic_format_arg_store<fmt::format_context> store;
+        const uint8_t* end = args + size;
+        bool valid = true;
+        while (valid && args < end) {
+            ArgType type = (ArgType)*args++;
+            switch (type) {
+                case ArgType::Bool:
+                case ArgType::Char: {
+                    uint8_t value = 0;
+                    valid = ReadValue(args, end, value);
+                    if (type == ArgType::Bool)
+                        store.push_back(value != 0);
+                    else
+                        store.push_back((char)value);
+                    break;
+                }
+                case ArgType::Int: {
+                    int64_t value = 0;
+                    valid = ReadValue(args, end, value);
+                    store.push_back(value);
+                    break;
+                }
+                case ArgType::UInt: {
+                    uint64_t value = 0;
+                    valid = ReadValue(args, end, value);
+                    store.push_back(value);
+                    break;
+                }
+                case ArgType::Double: {
+                    double value = 0.0;
+                    valid = ReadValue(args, end, value);
+                    store.push_back(value);
+                    break;
+                }
+                case ArgType::Pointer: {
+                    uint64_t value = 0;
+                    valid = ReadValue(args, end, value);
+                    store.push_back((const void*)(uintptr_t)value);
+                    break;
+                }
+                case ArgType::String: {
+                    uint32_t length = 0;
+                    valid = ReadValue(args, end, length) && (size_t)(end - args) >= length;
+                    if (valid) {
+                        store.push_back(std::string(reinterpret_cast<const char*>(args), length));
+                        args += length;
+                    }
+                    break;
+                }
+                default:
+                    valid = false;
+                    break;
+            }
+        }
+        if (!valid)
+            return std::string(format) + " [arguments corrompus]";
+
+        try {
+            return fmt::vformat(format, store);
+        } catch (const fmt::format_error& error) {
+            return std::string(format) + " [" + error.what() + "]";
+        }
+    }
+
+    bool BinaryLog::ReadFile(const std::string& filepath, const std::function<void(const DecodedRecord&)>& callback) {
+        std::ifstream file(filepath, std::ios::binary);
+        uint32_t magic = 0, version = 0;
+        if (!ReadPod(file, magic) || !ReadPod(file, version) || magic != FileMagic || version != FileVersion)
+            return false;
+
+        // Chaînes des points d'appel : adresses stables pour Site
+        std::deque<std::string> strings;
+        std::vector<Site> sites;
+        std::vector<uint8_t> args;
+        DecodedRecord record;
+
+        uint8_t block = 0;
+        while (ReadPod(file, block)) {
+            if (block == SiteBlock) {
+                uint32_t id = 0;
+                uint8_t level = 0;
+                Site site;
+                std::string& path = strings.emplace_back();
+                std::string& format = strings.emplace_back();
+                if (!ReadPod(file, id) || !ReadPod(file, level) || !ReadPod(file, site.Line) ||
+                    !ReadString(file, path) || !ReadString(file, format) || id == WrapSite)
+                    return false;
+                site.File = path.c_str();
+                site.Format = format.c_str();
+                site.Level = (spdlog::level::level_enum)level;
+                if (id > sites.size())
+                    sites.resize(id);
+                sites[id - 1] = site;
+            } else if (block == RecordBlock) {
+                uint32_t id = 0, argsSize = 0;
+                if (!ReadPod(file, id) || !ReadPod(file, record.ThreadId) || !ReadPod(file, record.TimeNs) ||
+                    !ReadPod(file, argsSize))
+                    return false;
+                if (id == WrapSite || id > sites.size() || !sites[id - 1].Format)
+                    return false;
+                args.resize(argsSize);
+                if (argsSize && !file.read(reinterpret_cast<char*>(args.data()), argsSize))
+                    return false;
+
+                record.CallSite = sites[id - 1];
+                record.Message = FormatArgs(record.CallSite.Format, args.data(), args.size());
+                callback(record);
+            } else {
+                return false;
+            }
+        }
+        return file.eof();
+    }
+
+} // namespace Tesseract
@@ -1,16 +1,24 @@
 #include "core/Application.hpp"
 #include "core/Logger.hpp"
+#include "core/BinaryLog.hpp"
+#include "core/InputRecorder.hpp"
 
 // Point d'entrée principal de l'application Tesseract
 // Défini dans le client (ex: SandboxApp.cpp via CreateApplication)
 extern Tesseract::Application* Tesseract::CreateApplication();
 
-int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+int main(int argc, char** argv) {
     // Initialisation du Logger
     Tesseract::Logger::Init();
+    Tesseract::BinaryLog::Init();
     TS_CORE_WARN("Initialized Core Logger");
     TS_INFO("Initialized Client Logger");
 
+    // --record <fichier> / --replay <fichier> [--replay-metrics <fichier.json>]
+    Tesseract::InputRecorder::ParseCommandLine(argc, argv);
+    // --headless [--frames N]
+    Tesseract::Application::SetCommandLineArgs(argc, argv);
+
     // Création de l'application client
     auto app = Tesseract::CreateApplication();
     TS_CORE_INFO("Application created, running...");
@@ -22,5 +30,8 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
     TS_CORE_INFO("Application finished, cleaning up.");
     delete app;
 
+    // Messages en attente écrits avant la sortie (le journal binaire alimente le logger)
+    Tesseract::BinaryLog::Shutdown();
+    Tesseract::Logger::Shutdown();
     return 0;
 }
@@ -1,6 +1,12 @@
 #include "core/ImGui/ImGuiLayer.hpp"
 #include "core/Application.hpp" // Pour GetWindow()
+#include "core/InputRecorder.hpp"
 #include "core/Logger.hpp"
+#include "core/Renderer/GpuProfiler.hpp"
+#include "core/Renderer/RenderCommand.hpp"
+#include "core/Renderer/RenderThread.hpp"
+#include "core/Events/KeyEvent.hpp"
+#include "core/Events/MouseEvent.hpp"
 
 #include <imgui.h>
 #include <backends/imgui_impl_sdl2.h>
@@ -10,6 +16,34 @@
 
 namespace Tesseract {
 
+    namespace {
+
+        // Copie profonde des listes de dessin d'une frame : ImGui réutilise les siennes
+        // dès la frame suivante, alors que le thread de rendu les dessine plus tard.
+        struct DrawDataSnapshot {
+            ImDrawData Data;
+
+            explicit DrawDataSnapshot(const ImDrawData& source)
+                : Data(source) {
+                for (int i = 0; i < Data.CmdListsCount; i++)
+                    Data.CmdLists[i] = source.CmdLists[i]->CloneOutput();
+#if IMGUI_VERSION_NUM >= 19200
+                // Les mises à jour de textures sont traitées à part (voir ImGuiLayer::End)
+                Data.Textures = nullptr;
+#endif
+            }
+
+            ~DrawDataSnapshot() {
+                for (int i = 0; i < Data.CmdListsCount; i++)
+                    IM_DELETE(Data.CmdLists[i]);
+            }
+
+            DrawDataSnapshot(const DrawDataSnapshot&) = delete;
+            DrawDataSnapshot& operator=(const DrawDataSnapshot&) = delete;
+        };
+
+    } // namespace
+
     ImGuiLayer::ImGuiLayer() : Layer("ImGuiLayer") {}
 
     ImGuiLayer::~ImGuiLayer() {}
@@ -24,6 +58,12 @@ namespace Tesseract {
         //io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
         io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;           // Enable Docking
         io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;         // Enable Multi-Viewport / Platform Windows
+        // Les fenêtres de plateforme rendent avec leur propre contexte GL depuis le thread
+        // principal : incompatible avec un thread de rendu propriétaire du contexte
+        if (Application::Get().GetSpecification().ThreadedRendering) {
+            io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+            Logger::Info("ImGui viewports disabled (threaded rendering)");
+        }
         //io.ConfigViewportsNoAutoMerge = true;
         //io.ConfigViewportsNoTaskBarIcon = true;
 
@@ -46,11 +86,22 @@ namespace Tesseract {
         ImGui_ImplSDL2_InitForOpenGL(window, context);
         ImGui_ImplOpenGL3_Init("#version 330"); // GLSL version
 
+        // Avant les couches : les entrées capturées par ImGui ne leur parviennent pas
+        EventBus& bus = app.GetEventBus();
+        bus.Subscribe<&ImGuiLayer::BlockIfCaptured<MouseMovedEvent>>(this, EventBus::OverlayPriority);
+        bus.Subscribe<&ImGuiLayer::BlockIfCaptured<MouseScrolledEvent>>(this, EventBus::OverlayPriority);
+        bus.Subscribe<&ImGuiLayer::BlockIfCaptured<MouseButtonPressedEvent>>(this, EventBus::OverlayPriority);
+        bus.Subscribe<&ImGuiLayer::BlockIfCaptured<MouseButtonReleasedEvent>>(this, EventBus::OverlayPriority);
+        bus.Subscribe<&ImGuiLayer::BlockIfCaptured<KeyPressedEvent>>(this, EventBus::OverlayPriority);
+        bus.Subscribe<&ImGuiLayer::BlockIfCaptured<KeyReleasedEvent>>(this, EventBus::OverlayPriority);
+        bus.Subscribe<&ImGuiLayer::BlockIfCaptured<KeyTypedEvent>>(this, EventBus::OverlayPriority);
+
         Logger::Info("ImGuiLayer Attached and Initialized.");
     }
 
     void ImGuiLayer::OnDetach() {
         Logger::Info("Detaching ImGuiLayer...");
+        Application::Get().GetEventBus().Unsubscribe(this);
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplSDL2_Shutdown();
         ImGui::DestroyContext();
@@ -59,7 +110,17 @@ namespace Tesseract {
 
     void ImGuiLayer::Begin() {
         // Start the Dear ImGui frame
-        ImGui_ImplOpenGL3_NewFrame();
+        // Le NewFrame du backend GL crée ses objets au premier appel (et, avant 1.92,
+        // l'atlas de police dans io.Fonts) : avec le thread de rendu, ce premier appel
+        // est attendu avant ImGui::NewFrame ; les suivants accompagnent RenderDrawData
+        if (!RenderThread::IsRunning()) {
+            ImGui_ImplOpenGL3_NewFrame();
+            m_RendererBackendReady = true;
+        } else if (!m_RendererBackendReady) {
+            RenderThread::Submit([]() { ImGui_ImplOpenGL3_NewFrame(); });
+            RenderThread::WaitIdle();
+            m_RendererBackendReady = true;
+        }
         ImGui_ImplSDL2_NewFrame();
         ImGui::NewFrame();
     }
@@ -74,7 +135,33 @@ namespace Tesseract {
         // Pas besoin de clear ici, c'est fait par Application::Run
         // glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
         // glClear(GL_COLOR_BUFFER_BIT);
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        ImDrawData* drawData = ImGui::GetDrawData();
+        GpuProfiler::BeginZone("ImGui");
+        if (RenderThread::IsRunning()) {
+#if IMGUI_VERSION_NUM >= 19200
+            // Création/mise à jour des textures ImGui (atlas de police) : l'état des
+            // ImTextureData appartient au thread principal, on attend donc leur envoi
+            if (drawData->Textures) {
+                bool texturesUpdated = false;
+                for (ImTextureData* texture : *drawData->Textures) {
+                    if (texture->Status != ImTextureStatus_OK) {
+                        RenderThread::Submit([texture]() { ImGui_ImplOpenGL3_UpdateTexture(texture); });
+                        texturesUpdated = true;
+                    }
+                }
+                if (texturesUpdated)
+                    RenderThread::WaitIdle();
+            }
+#endif
+            auto snapshot = CreateScope<DrawDataSnapshot>(*drawData);
+            RenderThread::Submit([snapshot = std::move(snapshot)]() {
+                ImGui_ImplOpenGL3_NewFrame(); // N'accède qu'aux données du backend une fois initialisé
+                ImGui_ImplOpenGL3_RenderDrawData(&snapshot->Data);
+            });
+        } else {
+            ImGui_ImplOpenGL3_RenderDrawData(drawData);
+        }
+        GpuProfiler::EndZone();
 
         // Update and Render additional Platform Windows
         // (Platform functions may change the current OpenGL context, so we save/restore it to be polite to the user.)
@@ -85,6 +172,9 @@ namespace Tesseract {
             ImGui::RenderPlatformWindowsDefault();
             SDL_GL_MakeCurrent(backup_current_window, backup_current_context);
         }
+
+        // Le backend OpenGL d'ImGui lie ses propres programme, VAO et textures
+        RenderCommand::InvalidateState();
     }
 
     void ImGuiLayer::OnImGuiRender() {
@@ -95,13 +185,19 @@ namespace Tesseract {
         //     ImGui::ShowDemoWindow(&show_demo_window);
     }
 
-    void ImGuiLayer::OnEvent(Event& event) {
-        // Gérer les événements pour ImGui ici si nécessaire,
-        // bien que ImGui_ImplSDL2_ProcessEvent dans Window::OnUpdate s'en charge déjà.
-        // On pourrait vouloir bloquer les événements si ImGui les capture.
+    template<typename T>
+    bool ImGuiLayer::BlockIfCaptured([[maybe_unused]] T& event) {
+        // ImGui_ImplSDL2_ProcessEvent (Window::OnUpdate) a déjà transmis l'entrée à ImGui ;
+        // il ne reste qu'à la masquer aux couches si ImGui la capture.
+        // En rejeu, ImGui ne reçoit pas les événements rejoués et suit le vrai curseur :
+        // sa capture ne doit pas changer le résultat de la session
+        if (InputRecorder::IsReplaying())
+            return false;
         ImGuiIO& io = ImGui::GetIO();
-        event.Handled |= event.IsInCategory(EventCategoryMouse) & io.WantCaptureMouse;
-        event.Handled |= event.IsInCategory(EventCategoryKeyboard) & io.WantCaptureKeyboard;
+        if constexpr (std::is_base_of_v<KeyEvent, T>)
+            return io.WantCaptureKeyboard;
+        else
+            return io.WantCaptureMouse;
     }
 
 } // namespace Tesseract
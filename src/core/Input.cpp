@@ -1,41 +1,392 @@
 #include "core/Input.hpp"
-#include "core/Application.hpp" // Pour accéder à la fenêtre SDL
+#include "core/EventBus.hpp"
+#include "core/Events/MouseEvent.hpp"
+#include "core/Logger.hpp"
+#include "core/Profiler.hpp"
 #include <SDL2/SDL.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
 namespace Tesseract {
 
-    bool Input::IsKeyPressed(int keycode) {
-        // Récupère l'état actuel de toutes les touches
-        const Uint8* state = SDL_GetKeyboardState(NULL);
-        // Vérifie si la touche correspondant au scancode SDL est pressée
-        // Note: SDL utilise des Scancodes, pas des Keycodes ici.
-        // Il faudrait une table de mapping si on veut utiliser des Keycodes abstraits.
-        // Pour l'instant, on utilisera directement les SDL_SCANCODE_*
-        if (keycode < SDL_NUM_SCANCODES) { // Vérification de sécurité
-            return state[keycode];
+    static_assert(InputState::KeyCount >= SDL_NUM_SCANCODES, "InputState::Keys trop petit pour les scancodes SDL");
+    static_assert(SDL_CONTROLLER_BUTTON_MAX <= 32, "InputState::Gamepad::Buttons trop petit");
+    static_assert(SDL_CONTROLLER_AXIS_MAX <= (int)InputState::GamepadAxisCount, "InputState::Gamepad::Axes trop petit");
+
+    namespace {
+
+        // Instantané publié : état de la frame, celui de la précédente (fronts) et actions évaluées
+        struct Snapshot {
+            InputState Current;
+            InputState Previous;
+            uint64_t ActionsDown = 0;
+            uint64_t PreviousActionsDown = 0;
+            float ActionValues[Input::MaxActions] = {};
+            uint64_t Frame = 0;
+        };
+
+        struct Action {
+            std::string Name;
+            std::vector<InputBinding> Bindings;
+        };
+
+        struct InputData {
+            // Triple tampon : Update écrit l'emplacement suivant puis le publie
+            Snapshot Slots[3];
+            std::atomic<uint32_t> Published{ 0 };
+
+            // Thread principal uniquement
+            float PendingScrollX = 0.0f;
+            float PendingScrollY = 0.0f;
+            float Deadzone = 0.15f;
+
+            SDL_GameController* Controllers[InputState::MaxGamepads] = {};
+            SDL_JoystickID ControllerIds[InputState::MaxGamepads] = {};
+            int KnownJoystickCount = -1;
+
+            std::vector<Action> Actions;
+            std::unordered_map<std::string, Input::ActionID> ActionIds;
+        };
+
+        InputData s_Data;
+
+        inline const Snapshot& Read() {
+            return s_Data.Slots[s_Data.Published.load(std::memory_order_acquire)];
+        }
+
+        inline bool IsButtonDown(uint32_t buttons, int button) {
+            return (uint32_t)button < 32 && (buttons >> button) & 1;
+        }
+
+        // Ouvre les manettes branchées depuis le dernier appel, ferme celles débranchées
+        void RefreshGamepads() {
+            bool rescan = false;
+            for (uint32_t i = 0; i < InputState::MaxGamepads; ++i) {
+                SDL_GameController*& controller = s_Data.Controllers[i];
+                if (controller && !SDL_GameControllerGetAttached(controller)) {
+                    Logger::Info("Input: gamepad {} disconnected", i);
+                    SDL_GameControllerClose(controller);
+                    controller = nullptr;
+                    rescan = true;
+                }
+            }
+
+            int count = SDL_NumJoysticks();
+            if (!rescan && count == s_Data.KnownJoystickCount)
+                return;
+            s_Data.KnownJoystickCount = count;
+
+            for (int device = 0; device < count; ++device) {
+                if (!SDL_IsGameController(device))
+                    continue;
+                SDL_JoystickID id = SDL_JoystickGetDeviceInstanceID(device);
+                auto* begin = s_Data.Controllers;
+                auto* end = s_Data.Controllers + InputState::MaxGamepads;
+                bool opened = false;
+                for (uint32_t i = 0; i < InputState::MaxGamepads; ++i)
+                    opened |= s_Data.Controllers[i] && s_Data.ControllerIds[i] == id;
+                if (opened)
+                    continue;
+
+                auto* slot = std::find(begin, end, nullptr);
+                if (slot == end)
+                    break; // Plus d'emplacement libre
+                *slot = SDL_GameControllerOpen(device);
+                if (!*slot) {
+                    Logger::Warn("Input: could not open gamepad device {}: {}", device, SDL_GetError());
+                    continue;
+                }
+                s_Data.ControllerIds[slot - begin] = id;
+                Logger::Info("Input: gamepad {} connected ({})", slot - begin, SDL_GameControllerName(*slot));
+            }
+        }
+
+        float ApplyDeadzone(float value) {
+            float magnitude = std::fabs(value);
+            if (magnitude <= s_Data.Deadzone)
+                return 0.0f;
+            // Réétalonné pour repartir de 0 à la sortie de la zone morte
+            return std::copysign(std::min((magnitude - s_Data.Deadzone) / (1.0f - s_Data.Deadzone), 1.0f), value);
+        }
+
+        float EvaluateBinding(const InputBinding& binding, const InputState& state) {
+            switch (binding.Source) {
+                case InputBinding::Device::Key:
+                    return state.IsKeyDown(binding.Code) ? binding.Scale : 0.0f;
+                case InputBinding::Device::MouseButton:
+                    return state.IsMouseButtonDown(binding.Code) ? binding.Scale : 0.0f;
+                case InputBinding::Device::GamepadButton:
+                    for (const InputState::Gamepad& gamepad : state.Gamepads) {
+                        if (gamepad.Connected && IsButtonDown(gamepad.Buttons, binding.Code))
+                            return binding.Scale;
+                    }
+                    return 0.0f;
+                case InputBinding::Device::GamepadAxis:
+                {
+                    if (binding.Code >= InputState::GamepadAxisCount)
+                        return 0.0f;
+                    // La manette la plus sollicitée l'emporte
+                    float value = 0.0f;
+                    for (const InputState::Gamepad& gamepad : state.Gamepads) {
+                        if (gamepad.Connected && std::fabs(gamepad.Axes[binding.Code]) > std::fabs(value))
+                            value = gamepad.Axes[binding.Code];
+                    }
+                    return value * binding.Scale;
+                }
+            }
+            return 0.0f;
+        }
+
+        void EvaluateActions(Snapshot& snapshot) {
+            snapshot.ActionsDown = 0;
+            for (size_t i = 0; i < s_Data.Actions.size(); ++i) {
+                float value = 0.0f;
+                for (const InputBinding& binding : s_Data.Actions[i].Bindings)
+                    value += EvaluateBinding(binding, snapshot.Current);
+                value = std::clamp(value, -1.0f, 1.0f);
+                snapshot.ActionValues[i] = value;
+                if (std::fabs(value) >= Input::ActionPressThreshold)
+                    snapshot.ActionsDown |= 1ull << i;
+            }
         }
+
+        inline bool IsActionBitSet(uint64_t bits, Input::ActionID action) {
+            return action < Input::MaxActions && (bits >> action) & 1;
+        }
+
+    } // namespace
+
+    void Input::Init(EventBus& bus) {
+        // Avant les couches : ImGui ne doit pas masquer la molette à l'instantané
+        bus.Subscribe<&Input::OnMouseScrolled>(EventBus::ApplicationPriority);
+    }
+
+    void Input::Shutdown() {
+        for (SDL_GameController*& controller : s_Data.Controllers) {
+            if (controller)
+                SDL_GameControllerClose(controller);
+            controller = nullptr;
+        }
+        s_Data.KnownJoystickCount = -1;
+    }
+
+    bool Input::OnMouseScrolled(MouseScrolledEvent& event) {
+        s_Data.PendingScrollX += event.GetXOffset();
+        s_Data.PendingScrollY += event.GetYOffset();
         return false;
     }
 
+    InputState Input::CaptureState() {
+        InputState state;
+
+        // Clavier : un octet par scancode chez SDL, un bit ici
+        int keyCount = 0;
+        const Uint8* keys = SDL_GetKeyboardState(&keyCount);
+        keyCount = std::min(keyCount, (int)InputState::KeyCount);
+        for (int scancode = 0; scancode < keyCount; ++scancode) {
+            if (keys[scancode])
+                state.SetKey(scancode);
+        }
+
+        // Souris : le masque SDL_BUTTON(b) est déjà le bit (b - 1)
+        int x = 0, y = 0;
+        state.MouseButtons = SDL_GetMouseState(&x, &y);
+        state.MouseX = x;
+        state.MouseY = y;
+        state.ScrollX = s_Data.PendingScrollX;
+        state.ScrollY = s_Data.PendingScrollY;
+        s_Data.PendingScrollX = 0.0f;
+        s_Data.PendingScrollY = 0.0f;
+
+        // Manettes
+        RefreshGamepads();
+        for (uint32_t i = 0; i < InputState::MaxGamepads; ++i) {
+            SDL_GameController* controller = s_Data.Controllers[i];
+            if (!controller)
+                continue;
+            InputState::Gamepad& gamepad = state.Gamepads[i];
+            gamepad.Connected = true;
+            for (int button = 0; button < SDL_CONTROLLER_BUTTON_MAX; ++button) {
+                if (SDL_GameControllerGetButton(controller, (SDL_GameControllerButton)button))
+                    gamepad.Buttons |= 1u << button;
+            }
+            for (int axis = 0; axis < SDL_CONTROLLER_AXIS_MAX; ++axis) {
+                float value = (float)SDL_GameControllerGetAxis(controller, (SDL_GameControllerAxis)axis) / 32767.0f;
+                gamepad.Axes[axis] = ApplyDeadzone(std::max(value, -1.0f));
+            }
+        }
+        return state;
+    }
+
+    void Input::Update() {
+        TS_PROFILE_FUNCTION();
+        Update(CaptureState());
+    }
+
+    void Input::Update(const InputState& state) {
+        // Rejeu : la molette est déjà comprise dans l'état fourni
+        s_Data.PendingScrollX = 0.0f;
+        s_Data.PendingScrollY = 0.0f;
+
+        uint32_t published = s_Data.Published.load(std::memory_order_relaxed);
+        const Snapshot& last = s_Data.Slots[published];
+        uint32_t next = (published + 1) % 3;
+        Snapshot& snapshot = s_Data.Slots[next];
+
+        snapshot.Previous = last.Current;
+        snapshot.Current = state;
+        snapshot.PreviousActionsDown = last.ActionsDown;
+        EvaluateActions(snapshot);
+        snapshot.Frame = last.Frame + 1;
+
+        s_Data.Published.store(next, std::memory_order_release);
+    }
+
+    const InputState& Input::GetState() {
+        return Read().Current;
+    }
+
+    uint64_t Input::GetFrameIndex() {
+        return Read().Frame;
+    }
+
+    bool Input::IsKeyPressed(int keycode) {
+        return Read().Current.IsKeyDown(keycode);
+    }
+
+    bool Input::WasKeyPressed(int keycode) {
+        const Snapshot& snapshot = Read();
+        return snapshot.Current.IsKeyDown(keycode) && !snapshot.Previous.IsKeyDown(keycode);
+    }
+
+    bool Input::WasKeyReleased(int keycode) {
+        const Snapshot& snapshot = Read();
+        return !snapshot.Current.IsKeyDown(keycode) && snapshot.Previous.IsKeyDown(keycode);
+    }
+
     bool Input::IsMouseButtonPressed(int button) {
-        // Récupère l'état actuel de la souris
-        Uint32 mouseState = SDL_GetMouseState(NULL, NULL);
-        // Vérifie si le bouton spécifique est pressé en utilisant les masques SDL
-        return (mouseState & SDL_BUTTON(button));
+        return Read().Current.IsMouseButtonDown(button);
+    }
+
+    bool Input::WasMouseButtonPressed(int button) {
+        const Snapshot& snapshot = Read();
+        return snapshot.Current.IsMouseButtonDown(button) && !snapshot.Previous.IsMouseButtonDown(button);
+    }
+
+    bool Input::WasMouseButtonReleased(int button) {
+        const Snapshot& snapshot = Read();
+        return !snapshot.Current.IsMouseButtonDown(button) && snapshot.Previous.IsMouseButtonDown(button);
     }
 
     std::pair<int, int> Input::GetMousePosition() {
-        int x, y;
-        SDL_GetMouseState(&x, &y);
-        return {x, y};
+        const InputState& state = Read().Current;
+        return { state.MouseX, state.MouseY };
     }
 
     int Input::GetMouseX() {
-        return GetMousePosition().first;
+        return Read().Current.MouseX;
     }
 
     int Input::GetMouseY() {
-        return GetMousePosition().second;
+        return Read().Current.MouseY;
+    }
+
+    std::pair<int, int> Input::GetMouseDelta() {
+        const Snapshot& snapshot = Read();
+        return { snapshot.Current.MouseX - snapshot.Previous.MouseX, snapshot.Current.MouseY - snapshot.Previous.MouseY };
+    }
+
+    std::pair<float, float> Input::GetMouseScroll() {
+        const InputState& state = Read().Current;
+        return { state.ScrollX, state.ScrollY };
+    }
+
+    bool Input::IsGamepadConnected(uint32_t gamepad) {
+        return gamepad < InputState::MaxGamepads && Read().Current.Gamepads[gamepad].Connected;
+    }
+
+    bool Input::IsGamepadButtonPressed(uint32_t gamepad, int button) {
+        return gamepad < InputState::MaxGamepads && IsButtonDown(Read().Current.Gamepads[gamepad].Buttons, button);
+    }
+
+    bool Input::WasGamepadButtonPressed(uint32_t gamepad, int button) {
+        if (gamepad >= InputState::MaxGamepads)
+            return false;
+        const Snapshot& snapshot = Read();
+        return IsButtonDown(snapshot.Current.Gamepads[gamepad].Buttons, button)
+            && !IsButtonDown(snapshot.Previous.Gamepads[gamepad].Buttons, button);
+    }
+
+    bool Input::WasGamepadButtonReleased(uint32_t gamepad, int button) {
+        if (gamepad >= InputState::MaxGamepads)
+            return false;
+        const Snapshot& snapshot = Read();
+        return !IsButtonDown(snapshot.Current.Gamepads[gamepad].Buttons, button)
+            && IsButtonDown(snapshot.Previous.Gamepads[gamepad].Buttons, button);
+    }
+
+    float Input::GetGamepadAxis(uint32_t gamepad, int axis) {
+        if (gamepad >= InputState::MaxGamepads || (uint32_t)axis >= InputState::GamepadAxisCount)
+            return 0.0f;
+        return Read().Current.Gamepads[gamepad].Axes[axis];
+    }
+
+    void Input::SetGamepadDeadzone(float deadzone) {
+        s_Data.Deadzone = std::clamp(deadzone, 0.0f, 0.95f);
+    }
+
+    Input::ActionID Input::RegisterAction(const std::string& name) {
+        auto it = s_Data.ActionIds.find(name);
+        if (it != s_Data.ActionIds.end())
+            return it->second;
+        if (s_Data.Actions.size() >= MaxActions) {
+            Logger::Error("Input: cannot register action '{}', limit of {} actions reached", name, MaxActions);
+            return InvalidAction;
+        }
+        ActionID id = (ActionID)s_Data.Actions.size();
+        s_Data.Actions.push_back({ name, {} });
+        s_Data.ActionIds.emplace(name, id);
+        return id;
+    }
+
+    Input::ActionID Input::FindAction(const std::string& name) {
+        auto it = s_Data.ActionIds.find(name);
+        return it != s_Data.ActionIds.end() ? it->second : InvalidAction;
+    }
+
+    void Input::BindAction(ActionID action, const InputBinding& binding) {
+        if (action >= s_Data.Actions.size()) {
+            Logger::Error("Input: BindAction on unknown action {}", action);
+            return;
+        }
+        s_Data.Actions[action].Bindings.push_back(binding);
+    }
+
+    void Input::ClearBindings(ActionID action) {
+        if (action < s_Data.Actions.size())
+            s_Data.Actions[action].Bindings.clear();
+    }
+
+    bool Input::IsActionPressed(ActionID action) {
+        return IsActionBitSet(Read().ActionsDown, action);
+    }
+
+    bool Input::WasActionPressed(ActionID action) {
+        const Snapshot& snapshot = Read();
+        return IsActionBitSet(snapshot.ActionsDown, action) && !IsActionBitSet(snapshot.PreviousActionsDown, action);
+    }
+
+    bool Input::WasActionReleased(ActionID action) {
+        const Snapshot& snapshot = Read();
+        return !IsActionBitSet(snapshot.ActionsDown, action) && IsActionBitSet(snapshot.PreviousActionsDown, action);
+    }
+
+    float Input::GetActionValue(ActionID action) {
+        return action < MaxActions ? Read().ActionValues[action] : 0.0f;
     }
 
 } // namespace Tesseract
@@ -0,0 +1,372 @@
+#include "core/InputRecorder.hpp"
+#include "core/EventBus.hpp"
+#include "core/Events/ApplicationEvent.hpp"
+#include "core/Events/KeyEvent.hpp"
+#include "core/Events/MouseEvent.hpp"
+#include "core/Logger.hpp"
+#include "core/Metrics.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Tesseract {
+
+    namespace {
+
+        // En-tête : magic, version, FixedTickRate, MaxFixedStepsPerFrame, taille d'un InputState
+        // Frame   : u8 drapeaux, f64 durée, u16 nombre d'événements, événements, [InputState]
+        constexpr uint32_t FileMagic = 0x52495354; // "TSIR"
+        constexpr uint32_t FileVersion = 2; // 2 : position des clics (RecordedEvent::C)
+        constexpr uint8_t FrameHasState = 1 << 0;
+
+        constexpr size_t EventSize = 1 + 3 * sizeof(int32_t);
+        constexpr size_t GamepadSize = sizeof(uint32_t) + InputState::GamepadAxisCount * sizeof(float) + 1;
+        constexpr size_t StateSize = InputState::KeyCount / 8 + 5 * sizeof(uint32_t) + InputState::MaxGamepads * GamepadSize;
+
+        struct RecorderData {
+            InputRecordSettings Settings;
+            InputRecordSettings CommandLine;
+
+            // Enregistrement
+            std::ofstream File;
+            std::vector<uint8_t> FrameBuffer;
+            uint8_t LastState[StateSize] = {};
+            bool HasLastState = false;
+            double FrameTime = 0.0;
+
+            // Rejeu : fichier entier en mémoire, aucune lecture disque pendant la session
+            std::vector<uint8_t> Replay;
+            size_t Cursor = 0;
+            InputState ReplayedState;
+            std::chrono::steady_clock::time_point ReplayStart;
+
+            std::vector<RecordedEvent> FrameEvents;
+            uint64_t FrameCount = 0;
+        };
+
+        RecorderData s_Data;
+
+        template<typename T>
+        void Put(uint8_t*& cursor, const T& value) {
+            std::memcpy(cursor, &value, sizeof(T));
+            cursor += sizeof(T);
+        }
+
+        template<typename T>
+        void Get(const uint8_t*& cursor, T& value) {
+            std::memcpy(&value, cursor, sizeof(T));
+            cursor += sizeof(T);
+        }
+
+        template<typename T>
+        void Append(std::vector<uint8_t>& buffer, const T& value) {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T>
+        bool ReadValue(T& value) {
+            if (s_Data.Replay.size() - s_Data.Cursor < sizeof(T))
+                return false;
+            std::memcpy(&value, s_Data.Replay.data() + s_Data.Cursor, sizeof(T));
+            s_Data.Cursor += sizeof(T);
+            return true;
+        }
+
+        // Champ par champ : ni remplissage ni octets indéterminés dans le fichier
+        void SerializeState(const InputState& state, uint8_t* out) {
+            for (uint64_t word : state.Keys)
+                Put(out, word);
+            Put(out, state.MouseButtons);
+            Put(out, state.MouseX);
+            Put(out, state.MouseY);
+            Put(out, state.ScrollX);
+            Put(out, state.ScrollY);
+            for (const InputState::Gamepad& gamepad : state.Gamepads) {
+                Put(out, gamepad.Buttons);
+                for (float axis : gamepad.Axes)
+                    Put(out, axis);
+                Put(out, (uint8_t)gamepad.Connected);
+            }
+        }
+
+        void DeserializeState(const uint8_t* in, InputState& state) {
+            for (uint64_t& word : state.Keys)
+                Get(in, word);
+            Get(in, state.MouseButtons);
+            Get(in, state.MouseX);
+            Get(in, state.MouseY);
+            Get(in, state.ScrollX);
+            Get(in, state.ScrollY);
+            for (InputState::Gamepad& gamepad : state.Gamepads) {
+                Get(in, gamepad.Buttons);
+                for (float& axis : gamepad.Axes)
+                    Get(in, axis);
+                uint8_t connected = 0;
+                Get(in, connected);
+                gamepad.Connected = connected != 0;
+            }
+        }
+
+        bool StartRecording(uint32_t fixedTickRate, uint32_t maxFixedSteps) {
+            s_Data.File.open(s_Data.Settings.FilePath, std::ios::binary | std::ios::trunc);
+            if (!s_Data.File) {
+                Logger::Error("InputRecorder: could not create '{}'", s_Data.Settings.FilePath);
+                return false;
+            }
+            std::vector<uint8_t> header;
+            Append(header, FileMagic);
+            Append(header, FileVersion);
+            Append(header, fixedTickRate);
+            Append(header, maxFixedSteps);
+            Append(header, (uint32_t)StateSize);
+            s_Data.File.write(reinterpret_cast<const char*>(header.data()), (std::streamsize)header.size());
+            s_Data.HasLastState = false;
+            Logger::Info("InputRecorder: recording to '{}'", s_Data.Settings.FilePath);
+            return true;
+        }
+
+        bool StartReplay(uint32_t fixedTickRate, uint32_t maxFixedSteps) {
+            std::ifstream file(s_Data.Settings.FilePath, std::ios::binary);
+            if (!file) {
+                Logger::Error("InputRecorder: could not open '{}'", s_Data.Settings.FilePath);
+                return false;
+            }
+            s_Data.Replay.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            s_Data.Cursor = 0;
+
+            uint32_t magic = 0, version = 0, tickRate = 0, maxSteps = 0, stateSize = 0;
+            if (!ReadValue(magic) || !ReadValue(version) || !ReadValue(tickRate) || !ReadValue(maxSteps) ||
+                !ReadValue(stateSize) || magic != FileMagic || version != FileVersion || stateSize != StateSize) {
+                Logger::Error("InputRecorder: '{}' is not a compatible input recording", s_Data.Settings.FilePath);
+                s_Data.Replay.clear();
+                return false;
+            }
+            // Même suite de durées, mais autre découpage en ticks : la simulation divergerait
+            if (tickRate != fixedTickRate || maxSteps != maxFixedSteps)
+                Logger::Warn("InputRecorder: recorded with {} Hz / {} steps, replaying with {} Hz / {} steps; results will differ",
+                             tickRate, maxSteps, fixedTickRate, maxFixedSteps);
+
+            s_Data.ReplayedState = InputState();
+            s_Data.ReplayStart = std::chrono::steady_clock::now();
+            Logger::Info("InputRecorder: replaying '{}' ({} bytes)", s_Data.Settings.FilePath, s_Data.Replay.size());
+            return true;
+        }
+
+        // Prochaine frame de l'enregistrement ; false à la fin ou si le fichier est tronqué
+        bool ReadReplayFrame(double& frameTime) {
+            if (s_Data.Cursor == s_Data.Replay.size())
+                return false;
+
+            uint8_t flags = 0;
+            double recordedTime = 0.0;
+            uint16_t eventCount = 0;
+            if (!ReadValue(flags) || !ReadValue(recordedTime) || !ReadValue(eventCount) ||
+                s_Data.Replay.size() - s_Data.Cursor < eventCount * EventSize + ((flags & FrameHasState) ? StateSize : 0)) {
+                Logger::Error("InputRecorder: '{}' truncated at frame {}", s_Data.Settings.FilePath, s_Data.FrameCount);
+                return false;
+            }
+            frameTime = recordedTime;
+
+            s_Data.FrameEvents.resize(eventCount);
+            for (RecordedEvent& event : s_Data.FrameEvents) {
+                uint8_t type = 0;
+                ReadValue(type);
+                ReadValue(event.A);
+                ReadValue(event.B);
+                ReadValue(event.C);
+                event.Type = (EventType)type;
+            }
+            if (flags & FrameHasState) {
+                DeserializeState(s_Data.Replay.data() + s_Data.Cursor, s_Data.ReplayedState);
+                s_Data.Cursor += StateSize;
+            }
+            return true;
+        }
+
+    } // namespace
+
+    RecordedEvent RecordedEvent::WindowClose() {
+        return { EventType::WindowClose, 0, 0 };
+    }
+
+    RecordedEvent RecordedEvent::WindowResize(uint32_t width, uint32_t height) {
+        return { EventType::WindowResize, (int32_t)width, (int32_t)height };
+    }
+
+    RecordedEvent RecordedEvent::KeyPressed(int keycode, int repeatCount) {
+        return { EventType::KeyPressed, keycode, repeatCount };
+    }
+
+    RecordedEvent RecordedEvent::KeyReleased(int keycode) {
+        return { EventType::KeyReleased, keycode, 0 };
+    }
+
+    RecordedEvent RecordedEvent::MouseMoved(int x, int y) {
+        return { EventType::MouseMoved, x, y };
+    }
+
+    RecordedEvent RecordedEvent::MouseScrolled(float xOffset, float yOffset) {
+        RecordedEvent event = { EventType::MouseScrolled, 0, 0 };
+        std::memcpy(&event.A, &xOffset, sizeof(float));
+        std::memcpy(&event.B, &yOffset, sizeof(float));
+        return event;
+    }
+
+    RecordedEvent RecordedEvent::MouseButtonPressed(int button, int x, int y) {
+        return { EventType::MouseButtonPressed, button, x, y };
+    }
+
+    RecordedEvent RecordedEvent::MouseButtonReleased(int button, int x, int y) {
+        return { EventType::MouseButtonReleased, button, x, y };
+    }
+
+    void RecordedEvent::Post(EventBus& bus) const {
+        switch (Type) {
+            case EventType::WindowClose:         bus.Post(WindowCloseEvent()); break;
+            case EventType::WindowResize:        bus.Post(WindowResizeEvent((unsigned int)A, (unsigned int)B)); break;
+            case EventType::KeyPressed:          bus.Post(KeyPressedEvent(A, B)); break;
+            case EventType::KeyReleased:         bus.Post(KeyReleasedEvent(A)); break;
+            case EventType::MouseMoved:          bus.Post(MouseMovedEvent(A, B)); break;
+            case EventType::MouseButtonPressed:  bus.Post(MouseButtonPressedEvent(A, B, C)); break;
+            case EventType::MouseButtonReleased: bus.Post(MouseButtonReleasedEvent(A, B, C)); break;
+            case EventType::MouseScrolled:
+            {
+                float xOffset, yOffset;
+                std::memcpy(&xOffset, &A, sizeof(float));
+                std::memcpy(&yOffset, &B, sizeof(float));
+                bus.Post(MouseScrolledEvent(xOffset, yOffset));
+                break;
+            }
+            default:
+                Logger::Warn("InputRecorder: unsupported recorded event type {}", (int)Type);
+                break;
+        }
+    }
+
+    bool InputRecorder::Start(const InputRecordSettings& settings, uint32_t fixedTickRate, uint32_t maxFixedSteps) {
+        Stop();
+        s_Data.Settings = settings;
+        s_Data.FrameCount = 0;
+        s_Data.FrameEvents.clear();
+
+        bool started = false;
+        if (settings.Mode == InputRecordMode::Record)
+            started = StartRecording(fixedTickRate, maxFixedSteps);
+        else if (settings.Mode == InputRecordMode::Replay)
+            started = StartReplay(fixedTickRate, maxFixedSteps);
+        if (!started)
+            s_Data.Settings.Mode = InputRecordMode::Off;
+        return started;
+    }
+
+    void InputRecorder::Stop() {
+        if (s_Data.Settings.Mode == InputRecordMode::Record) {
+            s_Data.File.close();
+            Logger::Info("InputRecorder: {} frames written to '{}'", s_Data.FrameCount, s_Data.Settings.FilePath);
+        } else if (s_Data.Settings.Mode == InputRecordMode::Replay) {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - s_Data.ReplayStart).count();
+            double msPerFrame = s_Data.FrameCount ? seconds * 1000.0 / (double)s_Data.FrameCount : 0.0;
+            Logger::Info("InputRecorder: replayed {} frames in {:.3f} s ({:.3f} ms/frame)", s_Data.FrameCount, seconds, msPerFrame);
+            if (!s_Data.Settings.MetricsPath.empty())
+                Metrics::WriteJSON(s_Data.Settings.MetricsPath);
+            s_Data.Replay.clear();
+            s_Data.Replay.shrink_to_fit();
+        }
+        s_Data.Settings.Mode = InputRecordMode::Off;
+    }
+
+    InputRecordMode InputRecorder::GetMode() {
+        return s_Data.Settings.Mode;
+    }
+
+    const InputRecordSettings& InputRecorder::GetSettings() {
+        return s_Data.Settings;
+    }
+
+    void InputRecorder::ParseCommandLine(int argc, char** argv) {
+        InputRecordSettings& settings = s_Data.CommandLine;
+        for (int i = 1; i + 1 < argc; ++i) {
+            if (std::strcmp(argv[i], "--record") == 0) {
+                settings.Mode = InputRecordMode::Record;
+                settings.FilePath = argv[++i];
+            } else if (std::strcmp(argv[i], "--replay") == 0) {
+                settings.Mode = InputRecordMode::Replay;
+                settings.FilePath = argv[++i];
+            } else if (std::strcmp(argv[i], "--replay-metrics") == 0) {
+                settings.MetricsPath = argv[++i];
+            }
+        }
+    }
+
+    const InputRecordSettings& InputRecorder::GetCommandLineSettings() {
+        return s_Data.CommandLine;
+    }
+
+    bool InputRecorder::BeginFrame(double& frameTime) {
+        if (s_Data.Settings.Mode == InputRecordMode::Record) {
+            s_Data.FrameTime = frameTime;
+            s_Data.FrameEvents.clear();
+            return true;
+        }
+        if (s_Data.Settings.Mode == InputRecordMode::Replay) {
+            if (!ReadReplayFrame(frameTime))
+                return false;
+            s_Data.FrameCount++;
+        }
+        return true;
+    }
+
+    void InputRecorder::RecordEvent(const RecordedEvent& event) {
+        if (s_Data.Settings.Mode == InputRecordMode::Record)
+            s_Data.FrameEvents.push_back(event);
+    }
+
+    const std::vector<RecordedEvent>& InputRecorder::GetReplayedEvents() {
+        return s_Data.FrameEvents;
+    }
+
+    const InputState& InputRecorder::GetReplayedState() {
+        return s_Data.ReplayedState;
+    }
+
+    void InputRecorder::EndFrame(const InputState& state) {
+        if (s_Data.Settings.Mode != InputRecordMode::Record)
+            return;
+
+        uint8_t serialized[StateSize];
+        SerializeState(state, serialized);
+        bool stateChanged = !s_Data.HasLastState || std::memcmp(serialized, s_Data.LastState, StateSize) != 0;
+
+        // Au-delà de 65535 événements dans une frame, le surplus est perdu
+        uint16_t eventCount = (uint16_t)std::min<size_t>(s_Data.FrameEvents.size(), 0xFFFF);
+
+        std::vector<uint8_t>& buffer = s_Data.FrameBuffer;
+        buffer.clear();
+        Append(buffer, (uint8_t)(stateChanged ? FrameHasState : 0));
+        Append(buffer, s_Data.FrameTime);
+        Append(buffer, eventCount);
+        for (uint16_t i = 0; i < eventCount; ++i) {
+            const RecordedEvent& event = s_Data.FrameEvents[i];
+            Append(buffer, (uint8_t)event.Type);
+            Append(buffer, event.A);
+            Append(buffer, event.B);
+            Append(buffer, event.C);
+        }
+        if (stateChanged) {
+            buffer.insert(buffer.end(), serialized, serialized + StateSize);
+            std::memcpy(s_Data.LastState, serialized, StateSize);
+            s_Data.HasLastState = true;
+        }
+        s_Data.File.write(reinterpret_cast<const char*>(buffer.data()), (std::streamsize)buffer.size());
+        s_Data.FrameCount++;
+    }
+
+    uint64_t InputRecorder::GetFrameCount() {
+        return s_Data.FrameCount;
+    }
+
+} // namespace Tesseract
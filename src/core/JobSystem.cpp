@@ -0,0 +1,156 @@
+#include "core/JobSystem.hpp"
+#include "core/Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Tesseract {
+
+    struct JobSystemData {
+        std::vector<std::thread> Workers;
+        std::deque<std::function<void()>> Queue;
+        std::mutex QueueMutex;
+        std::condition_variable QueueCondition;
+        // Écrit par Init/Shutdown, lu sans verrou par ParallelFor et IsInitialized
+        std::atomic<bool> Running{false};
+    };
+
+    static JobSystemData s_Data;
+
+    // État partagé d'un ParallelFor (survit aux workers qui démarrent en retard)
+    struct ParallelForState {
+        std::atomic<uint32_t> NextChunk{0};
+        std::atomic<uint32_t> CompletedChunks{0};
+        uint32_t ChunkCount = 0;
+        uint32_t Count = 0;
+        uint32_t GrainSize = 1;
+        const std::function<void(uint32_t, uint32_t)>* Func = nullptr;
+    };
+
+    static void RunChunks(ParallelForState& state) {
+        while (true) {
+            uint32_t chunk = state.NextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= state.ChunkCount)
+                return;
+
+            uint32_t begin = chunk * state.GrainSize;
+            uint32_t end = std::min(begin + state.GrainSize, state.Count);
+            TS_PROFILE_SCOPE("JobSystem::ParallelFor chunk");
+            (*state.Func)(begin, end);
+            state.CompletedChunks.fetch_add(1, std::memory_order_acq_rel);
+        }
+    }
+
+    static void WorkerLoop([[maybe_unused]] uint32_t index) {
+        TS_PROFILE_THREAD("Worker " + std::to_string(index));
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(s_Data.QueueMutex);
+                // Sous QueueMutex : l'écriture de Shutdown est déjà ordonnée par le verrou
+                s_Data.QueueCondition.wait(lock, [] { return !s_Data.Running.load(std::memory_order_relaxed) || !s_Data.Queue.empty(); });
+                if (!s_Data.Running.load(std::memory_order_relaxed) && s_Data.Queue.empty())
+                    return;
+
+                job = std::move(s_Data.Queue.front());
+                s_Data.Queue.pop_front();
+            }
+            TS_PROFILE_SCOPE("JobSystem::Job");
+            job();
+        }
+    }
+
+    void JobSystem::Init(uint32_t workerCount) {
+        if (s_Data.Running.load(std::memory_order_acquire))
+            return;
+
+        if (workerCount == 0) {
+            uint32_t cores = std::thread::hardware_concurrency();
+            workerCount = cores > 1 ? cores - 1 : 1;
+        }
+
+        s_Data.Running.store(true, std::memory_order_release);
+        s_Data.Workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i)
+            s_Data.Workers.emplace_back(WorkerLoop, i);
+    }
+
+    void JobSystem::Shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(s_Data.QueueMutex);
+            if (!s_Data.Running.load(std::memory_order_relaxed))
+                return;
+            s_Data.Running.store(false, std::memory_order_release);
+        }
+        s_Data.QueueCondition.notify_all();
+
+        // Les tâches déjà en file sont terminées avant l'arrêt
+        for (auto& worker : s_Data.Workers)
+            worker.join();
+        s_Data.Workers.clear();
+    }
+
+    bool JobSystem::IsInitialized() {
+        return s_Data.Running.load(std::memory_order_acquire);
+    }
+
+    uint32_t JobSystem::GetWorkerCount() {
+        return (uint32_t)s_Data.Workers.size();
+    }
+
+    void JobSystem::Submit(std::function<void()> job) {
+        {
+            std::lock_guard<std::mutex> lock(s_Data.QueueMutex);
+            if (s_Data.Running.load(std::memory_order_relaxed)) {
+                s_Data.Queue.push_back(std::move(job));
+                s_Data.QueueCondition.notify_one();
+                return;
+            }
+        }
+        // Pas de workers : exécution synchrone
+        job();
+    }
+
+    void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t, uint32_t)>& func) {
+        if (count == 0)
+            return;
+        if (grainSize == 0)
+            grainSize = 1;
+
+        uint32_t chunkCount = GetChunkCount(count, grainSize);
+        if (chunkCount == 1 || !s_Data.Running.load(std::memory_order_acquire)) {
+            for (uint32_t begin = 0; begin < count; begin += grainSize)
+                func(begin, std::min(begin + grainSize, count));
+            return;
+        }
+
+        auto state = std::make_shared<ParallelForState>();
+        state->ChunkCount = chunkCount;
+        state->Count = count;
+        state->GrainSize = grainSize;
+        state->Func = &func;
+
+        // Un assistant par worker disponible ; le thread appelant travaille aussi
+        uint32_t helpers = std::min(chunkCount - 1, GetWorkerCount());
+        {
+            std::lock_guard<std::mutex> lock(s_Data.QueueMutex);
+            for (uint32_t i = 0; i < helpers; ++i)
+                s_Data.Queue.push_back([state] { RunChunks(*state); });
+        }
+        s_Data.QueueCondition.notify_all();
+
+        RunChunks(*state);
+
+        // 'func' reste valide tant que tous les lots ne sont pas terminés
+        while (state->CompletedChunks.load(std::memory_order_acquire) < chunkCount)
+            std::this_thread::yield();
+    }
+
+} // namespace Tesseract
@@ -1,4 +1,5 @@
 #include "core/Logger.hpp"
+#include "core/AsyncLogSink.hpp"
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/basic_file_sink.h>
 
@@ -6,22 +7,51 @@ namespace Tesseract {
     std::shared_ptr<spdlog::logger> Logger::s_CoreLogger;
     std::shared_ptr<spdlog::logger> Logger::s_ClientLogger;
 
-    void Logger::Init() {
+    // Sink asynchrone partagé par les deux loggers (nul en mode synchrone)
+    static std::shared_ptr<AsyncLogSink> s_AsyncSink;
+
+    void Logger::Init(const LoggerSettings& settings) {
         std::vector<spdlog::sink_ptr> logSinks;
         logSinks.emplace_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
-        logSinks.emplace_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>("Tesseract.log", true));
-
         logSinks[0]->set_pattern("%^[%T] %n: %v%$");
-        logSinks[1]->set_pattern("[%T] [%l] %n: %v");
+        if (!settings.FilePath.empty()) {
+            logSinks.emplace_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>(settings.FilePath, true));
+            logSinks[1]->set_pattern("[%T] [%l] %n: %v");
+        }
+
+        // Mode asynchrone : les loggers formatent puis déposent dans la file, le
+        // thread d'écriture se charge de la console et du fichier
+        spdlog::level::level_enum flushLevel = spdlog::level::trace;
+        if (settings.Async) {
+            s_AsyncSink = std::make_shared<AsyncLogSink>(std::move(logSinks), settings);
+            logSinks = { s_AsyncSink };
+            flushLevel = spdlog::level::err;
+        }
 
         s_CoreLogger = std::make_shared<spdlog::logger>("TESSERACT", begin(logSinks), end(logSinks));
         spdlog::register_logger(s_CoreLogger);
         s_CoreLogger->set_level(spdlog::level::trace);
-        s_CoreLogger->flush_on(spdlog::level::trace);
+        s_CoreLogger->flush_on(flushLevel);
 
         s_ClientLogger = std::make_shared<spdlog::logger>("APP", begin(logSinks), end(logSinks));
         spdlog::register_logger(s_ClientLogger);
         s_ClientLogger->set_level(spdlog::level::trace);
-        s_ClientLogger->flush_on(spdlog::level::trace);
+        s_ClientLogger->flush_on(flushLevel);
+    }
+
+    void Logger::Shutdown() {
+        if (s_AsyncSink)
+            s_AsyncSink->Stop();
+    }
+
+    void Logger::Flush() {
+        if (s_AsyncSink)
+            s_AsyncSink->Drain();
+        else if (s_CoreLogger)
+            s_CoreLogger->flush();
+    }
+
+    uint64_t Logger::GetDroppedCount() {
+        return s_AsyncSink ? s_AsyncSink->GetDroppedCount() : 0;
     }
 }
@@ -0,0 +1,253 @@
+#include "core/Metrics.hpp"
+#include "core/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#ifndef TS_TRACK_ALLOCATIONS
+    #define TS_TRACK_ALLOCATIONS 0
+#endif
+
+namespace Tesseract {
+
+    namespace {
+
+        struct MetricsData {
+            std::mutex Mutex;
+            std::vector<std::unique_ptr<Metric>> Metrics;
+            std::unordered_map<std::string, Metric*> ByName;
+        };
+
+        MetricsData& GetData() {
+            // Construit à la première utilisation : des mesures peuvent être demandées
+            // pendant l'initialisation statique
+            static MetricsData data;
+            return data;
+        }
+
+        Metric& GetOrCreate(const std::string& name, Metric::Type type, const std::string& unit) {
+            MetricsData& data = GetData();
+            std::lock_guard<std::mutex> lock(data.Mutex);
+            auto it = data.ByName.find(name);
+            if (it != data.ByName.end()) {
+                if (it->second->GetType() != type)
+                    Logger::Warn("Metrics: '{}' existe déjà avec un autre type", name);
+                return *it->second;
+            }
+
+            data.Metrics.push_back(std::make_unique<Metric>(name, type, unit));
+            Metric* metric = data.Metrics.back().get();
+            data.ByName.emplace(name, metric);
+            return *metric;
+        }
+
+        // Rang le plus proche sur un tableau trié
+        float Percentile(const std::vector<float>& sorted, float fraction) {
+            size_t rank = (size_t)std::ceil(fraction * (float)sorted.size());
+            return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+        }
+
+        const char* TypeName(Metric::Type type) {
+            switch (type) {
+                case Metric::Type::Counter: return "counter";
+                case Metric::Type::Gauge:   return "gauge";
+                case Metric::Type::Timer:   return "timer";
+            }
+            return "unknown";
+        }
+
+        bool OpenOutput(const std::string& filepath, std::ofstream& out) {
+            std::filesystem::path parent = std::filesystem::path(filepath).parent_path();
+            if (!parent.empty()) {
+                std::error_code error;
+                std::filesystem::create_directories(parent, error);
+            }
+            out.open(filepath, std::ios::out | std::ios::trunc);
+            if (!out)
+                Logger::Error("Metrics: impossible d'écrire '{}'", filepath);
+            return (bool)out;
+        }
+
+#if TS_TRACK_ALLOCATIONS
+        // Alimentés par les opérateurs new globaux : pas de registre ici (réentrance)
+        std::atomic<int64_t> s_AllocationCount{ 0 };
+        std::atomic<int64_t> s_AllocatedBytes{ 0 };
+#endif
+
+    } // namespace
+
+    Metric::Metric(const std::string& name, Type type, const std::string& unit)
+        : m_Name(name), m_Unit(type == Type::Timer ? "ms" : unit), m_Type(type), m_History(Metrics::HistorySize, 0.0f) {}
+
+    void Metric::Sample() {
+        if (!m_Touched.load(std::memory_order_relaxed))
+            return;
+
+        float value = 0.0f;
+        switch (m_Type) {
+            case Type::Counter: value = (float)m_Accumulator.exchange(0, std::memory_order_relaxed); break;
+            case Type::Gauge:   value = m_Gauge.load(std::memory_order_relaxed); break;
+            case Type::Timer:   value = (float)((double)m_Accumulator.exchange(0, std::memory_order_relaxed) / 1.0e6); break;
+        }
+
+        m_History[m_Head] = value;
+        m_Head = (m_Head + 1) % Metrics::HistorySize;
+        m_Count = std::min(m_Count + 1, Metrics::HistorySize);
+    }
+
+    std::vector<float> Metric::GetHistory() const {
+        std::vector<float> history;
+        history.reserve(m_Count);
+        uint32_t first = (m_Head + Metrics::HistorySize - m_Count) % Metrics::HistorySize;
+        for (uint32_t i = 0; i < m_Count; ++i)
+            history.push_back(m_History[(first + i) % Metrics::HistorySize]);
+        return history;
+    }
+
+    Metric::Summary Metric::GetSummary() const {
+        Summary summary;
+        if (m_Count == 0)
+            return summary;
+
+        std::vector<float> sorted = GetHistory();
+        summary.Count = m_Count;
+        summary.Last = sorted.back();
+        double sum = 0.0;
+        for (float value : sorted)
+            sum += value;
+        summary.Mean = (float)(sum / (double)sorted.size());
+
+        std::sort(sorted.begin(), sorted.end());
+        summary.Min = sorted.front();
+        summary.Max = sorted.back();
+        summary.P50 = Percentile(sorted, 0.50f);
+        summary.P95 = Percentile(sorted, 0.95f);
+        summary.P99 = Percentile(sorted, 0.99f);
+        return summary;
+    }
+
+    Metric& Metrics::GetCounter(const std::string& name, const std::string& unit) {
+        return GetOrCreate(name, Metric::Type::Counter, unit);
+    }
+
+    Metric& Metrics::GetGauge(const std::string& name, const std::string& unit) {
+        return GetOrCreate(name, Metric::Type::Gauge, unit);
+    }
+
+    Metric& Metrics::GetTimer(const std::string& name) {
+        return GetOrCreate(name, Metric::Type::Timer, "ms");
+    }
+
+    void Metrics::EndFrame() {
+#if TS_TRACK_ALLOCATIONS
+        static Metric& allocations = GetCounter("Memory.Allocations");
+        static Metric& allocatedBytes = GetCounter("Memory.AllocatedBytes", "B");
+        allocations.Increment(s_AllocationCount.exchange(0, std::memory_order_relaxed));
+        allocatedBytes.Increment(s_AllocatedBytes.exchange(0, std::memory_order_relaxed));
+#endif
+
+        MetricsData& data = GetData();
+        std::lock_guard<std::mutex> lock(data.Mutex);
+        for (auto& metric : data.Metrics)
+            metric->Sample();
+    }
+
+    std::vector<Metric*> Metrics::GetAll() {
+        MetricsData& data = GetData();
+        std::lock_guard<std::mutex> lock(data.Mutex);
+        std::vector<Metric*> metrics;
+        metrics.reserve(data.Metrics.size());
+        for (auto& metric : data.Metrics)
+            metrics.push_back(metric.get());
+        return metrics;
+    }
+
+    bool Metrics::WriteCSV(const std::string& filepath) {
+        std::ofstream out;
+        if (!OpenOutput(filepath, out))
+            return false;
+
+        out << "name,type,unit,samples,last,min,mean,p50,p95,p99,max\n";
+        for (const Metric* metric : GetAll()) {
+            Metric::Summary summary = metric->GetSummary();
+            out << metric->GetName() << ',' << TypeName(metric->GetType()) << ',' << metric->GetUnit() << ','
+                << summary.Count << ',' << summary.Last << ',' << summary.Min << ',' << summary.Mean << ','
+                << summary.P50 << ',' << summary.P95 << ',' << summary.P99 << ',' << summary.Max << '\n';
+        }
+
+        Logger::Info("Metrics: résumé écrit dans '{}'", filepath);
+        return (bool)out;
+    }
+
+    bool Metrics::WriteJSON(const std::string& filepath) {
+        std::ofstream out;
+        if (!OpenOutput(filepath, out))
+            return false;
+
+        out << "{\"historySize\":" << HistorySize << ",\"metrics\":[";
+        bool first = true;
+        for (const Metric* metric : GetAll()) {
+            Metric::Summary summary = metric->GetSummary();
+            // Les noms de mesures sont des identifiants (pas de caractère à échapper)
+            out << (first ? "" : ",") << "\n{\"name\":\"" << metric->GetName() << "\",\"type\":\""
+                << TypeName(metric->GetType()) << "\",\"unit\":\"" << metric->GetUnit() << "\""
+                << ",\"samples\":" << summary.Count << ",\"last\":" << summary.Last
+                << ",\"min\":" << summary.Min << ",\"mean\":" << summary.Mean
+                << ",\"p50\":" << summary.P50 << ",\"p95\":" << summary.P95
+                << ",\"p99\":" << summary.P99 << ",\"max\":" << summary.Max << ",\"history\":[";
+            std::vector<float> history = metric->GetHistory();
+            for (size_t i = 0; i < history.size(); ++i)
+                out << (i ? "," : "") << history[i];
+            out << "]}";
+            first = false;
+        }
+        out << "\n]}\n";
+
+        Logger::Info("Metrics: historique écrit dans '{}'", filepath);
+        return (bool)out;
+    }
+
+} // namespace Tesseract
+
+#if TS_TRACK_ALLOCATIONS
+// Comptage des allocations (option TESSERACT_TRACK_ALLOCATIONS) : remplace les
+// opérateurs globaux de base, les variantes alignées restent celles de la bibliothèque
+void* operator new(std::size_t size) {
+    Tesseract::s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    Tesseract::s_AllocatedBytes.fetch_add((int64_t)size, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return ::operator new(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return ::operator new(size, std::nothrow);
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+#endif
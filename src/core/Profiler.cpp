@@ -0,0 +1,243 @@
+#include "core/Profiler.hpp"
+#include "core/Logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Tesseract {
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        // Anneau d'un thread ; conservé après la fin du thread pour les exports
+        struct ThreadBuffer {
+            std::atomic_flag Lock = ATOMIC_FLAG_INIT;
+            std::unique_ptr<Profiler::Event[]> Events{ new Profiler::Event[Profiler::EventsPerThread] };
+            uint64_t Written = 0; // Total écrit (l'anneau contient les EventsPerThread derniers)
+            uint32_t Depth = 0;
+            uint32_t ThreadId = 0;
+            std::string Name;
+
+            void Acquire() {
+                while (Lock.test_and_set(std::memory_order_acquire)) {}
+            }
+            void Release() { Lock.clear(std::memory_order_release); }
+        };
+
+        struct ProfilerData {
+            const Clock::time_point Start = Clock::now();
+            std::atomic<bool> Enabled{ true };
+
+            std::mutex RegistryMutex;
+            std::vector<std::unique_ptr<ThreadBuffer>> Threads;
+            uint32_t NextThreadId = 1;
+
+            // Détection des pics (thread principal uniquement)
+            uint64_t LastFrameNs = 0;
+            uint64_t LastSpikeCaptureNs = 0;
+            uint64_t FrameCount = 0;
+            float SpikeThresholdMs = 0.0f;
+            std::string SpikeDirectory = "profiles";
+        };
+
+        ProfilerData s_Data;
+        thread_local ThreadBuffer* t_Buffer = nullptr;
+
+        // Délai minimal entre deux captures automatiques (l'export lui-même crée un pic)
+        constexpr uint64_t SpikeCaptureCooldownNs = 5ull * 1000 * 1000 * 1000;
+
+        ThreadBuffer& GetThreadBuffer() {
+            if (!t_Buffer) {
+                auto buffer = std::make_unique<ThreadBuffer>();
+                std::lock_guard<std::mutex> lock(s_Data.RegistryMutex);
+                buffer->ThreadId = s_Data.NextThreadId++;
+                t_Buffer = buffer.get();
+                s_Data.Threads.push_back(std::move(buffer));
+            }
+            return *t_Buffer;
+        }
+
+        void WriteEscaped(std::ofstream& out, const char* text) {
+            for (const char* c = text; *c; ++c) {
+                if (*c == '"' || *c == '\\')
+                    out << '\\';
+                out << *c;
+            }
+        }
+
+    } // namespace
+
+    void Profiler::SetEnabled(bool enabled) {
+        s_Data.Enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool Profiler::IsEnabled() {
+        return s_Data.Enabled.load(std::memory_order_relaxed);
+    }
+
+    void Profiler::SetThreadName(const std::string& name) {
+        ThreadBuffer& buffer = GetThreadBuffer();
+        buffer.Acquire();
+        buffer.Name = name;
+        buffer.Release();
+    }
+
+    uint64_t Profiler::Now() {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - s_Data.Start).count();
+    }
+
+    uint32_t Profiler::BeginZone() {
+        return GetThreadBuffer().Depth++;
+    }
+
+    void Profiler::EndZone(const char* name, uint64_t startNs, uint32_t depth) {
+        uint64_t endNs = Now();
+        ThreadBuffer& buffer = *t_Buffer; // Créé par BeginZone
+        buffer.Depth = depth;
+        if (!s_Data.Enabled.load(std::memory_order_relaxed))
+            return;
+
+        buffer.Acquire();
+        Event& event = buffer.Events[buffer.Written % EventsPerThread];
+        event.Name = name;
+        event.StartNs = startNs;
+        event.EndNs = endNs;
+        event.Depth = depth;
+        buffer.Written++;
+        buffer.Release();
+    }
+
+    uint32_t Profiler::CreateTrack(const std::string& name) {
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->Name = name;
+        std::lock_guard<std::mutex> lock(s_Data.RegistryMutex);
+        buffer->ThreadId = s_Data.NextThreadId++;
+        s_Data.Threads.push_back(std::move(buffer));
+        return (uint32_t)(s_Data.Threads.size() - 1);
+    }
+
+    void Profiler::RecordEvent(uint32_t track, const Event& event) {
+        if (!s_Data.Enabled.load(std::memory_order_relaxed))
+            return;
+
+        std::lock_guard<std::mutex> lock(s_Data.RegistryMutex);
+        if (track >= s_Data.Threads.size())
+            return;
+        ThreadBuffer& buffer = *s_Data.Threads[track];
+        buffer.Acquire();
+        buffer.Events[buffer.Written % EventsPerThread] = event;
+        buffer.Written++;
+        buffer.Release();
+    }
+
+    void Profiler::SetSpikeCapture(float thresholdMs, const std::string& directory) {
+        s_Data.SpikeThresholdMs = thresholdMs;
+        s_Data.SpikeDirectory = directory;
+    }
+
+    void Profiler::MarkFrame() {
+        uint64_t now = Now();
+        uint64_t frameNs = s_Data.LastFrameNs ? now - s_Data.LastFrameNs : 0;
+        s_Data.LastFrameNs = now;
+        s_Data.FrameCount++;
+
+        if (s_Data.SpikeThresholdMs <= 0.0f || !IsEnabled())
+            return;
+        float frameMs = (float)frameNs / 1.0e6f;
+        if (frameMs < s_Data.SpikeThresholdMs)
+            return;
+        if (s_Data.LastSpikeCaptureNs && now - s_Data.LastSpikeCaptureNs < SpikeCaptureCooldownNs)
+            return;
+
+        char filename[64];
+        std::snprintf(filename, sizeof(filename), "spike_%llu_%.1fms.json",
+                      (unsigned long long)s_Data.FrameCount, frameMs);
+        std::string path = (std::filesystem::path(s_Data.SpikeDirectory) / filename).string();
+        if (WriteChromeTrace(path))
+            Logger::Warn("Profiler: frame {} a pris {:.2f} ms, trace écrite dans '{}'", s_Data.FrameCount, frameMs, path);
+        // L'export fausse la frame suivante : on repart de maintenant
+        s_Data.LastFrameNs = Now();
+        s_Data.LastSpikeCaptureNs = s_Data.LastFrameNs;
+    }
+
+    bool Profiler::WriteChromeTrace(const std::string& filepath) {
+        struct ThreadSnapshot {
+            uint32_t ThreadId;
+            std::string Name;
+            std::vector<Event> Events;
+        };
+
+        // Copie des anneaux : chaque thread n'est bloqué que le temps de sa copie
+        std::vector<ThreadSnapshot> snapshots;
+        {
+            std::lock_guard<std::mutex> lock(s_Data.RegistryMutex);
+            snapshots.reserve(s_Data.Threads.size());
+            for (const auto& buffer : s_Data.Threads) {
+                ThreadSnapshot snapshot;
+                buffer->Acquire();
+                snapshot.ThreadId = buffer->ThreadId;
+                snapshot.Name = buffer->Name;
+                uint64_t count = std::min<uint64_t>(buffer->Written, EventsPerThread);
+                snapshot.Events.reserve((size_t)count);
+                for (uint64_t i = buffer->Written - count; i < buffer->Written; ++i)
+                    snapshot.Events.push_back(buffer->Events[i % EventsPerThread]);
+                buffer->Release();
+                snapshots.push_back(std::move(snapshot));
+            }
+        }
+
+        std::filesystem::path parent = std::filesystem::path(filepath).parent_path();
+        if (!parent.empty()) {
+            std::error_code error;
+            std::filesystem::create_directories(parent, error);
+        }
+
+        std::ofstream out(filepath, std::ios::out | std::ios::trunc);
+        if (!out) {
+            Logger::Error("Profiler: impossible d'écrire la trace '{}'", filepath);
+            return false;
+        }
+
+        // Format « Trace Event » : événements complets (ph "X"), temps en microsecondes
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        char timing[96];
+        size_t eventCount = 0;
+        for (const ThreadSnapshot& snapshot : snapshots) {
+            if (!snapshot.Name.empty()) {
+                out << (first ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":"
+                    << snapshot.ThreadId << ",\"args\":{\"name\":\"";
+                WriteEscaped(out, snapshot.Name.c_str());
+                out << "\"}}";
+                first = false;
+            }
+            for (const Event& event : snapshot.Events) {
+                std::snprintf(timing, sizeof(timing), "\"ts\":%.3f,\"dur\":%.3f",
+                              (double)event.StartNs / 1000.0, (double)(event.EndNs - event.StartNs) / 1000.0);
+                out << (first ? "" : ",") << "\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << snapshot.ThreadId
+                    << "," << timing << ",\"name\":\"";
+                WriteEscaped(out, event.Name ? event.Name : "?");
+                out << "\",\"args\":{\"depth\":" << event.Depth << "}}";
+                first = false;
+                eventCount++;
+            }
+        }
+        out << "\n]}\n";
+
+        if (!out) {
+            Logger::Error("Profiler: erreur d'écriture de la trace '{}'", filepath);
+            return false;
+        }
+        Logger::Info("Profiler: {} zones de {} threads écrites dans '{}'", eventCount, snapshots.size(), filepath);
+        return true;
+    }
+
+} // namespace Tesseract
@@ -1,5 +1,7 @@
 #include "core/Renderer/Buffer.hpp"
 #include "core/Renderer/OpenGLBuffer.hpp"
+#include "core/Renderer/NullBuffer.hpp"
+#include "core/Renderer/RendererAPI.hpp"
 #include "core/Core.hpp"
 #include "core/Logger.hpp"
 
@@ -7,17 +9,45 @@ namespace Tesseract {
 
     // --- VertexBuffer Factory ---
     Ref<VertexBuffer> VertexBuffer::Create(uint32_t size) {
-        // Pour l'instant, on crée toujours un OpenGLVertexBuffer
-        return CreateRef<OpenGLVertexBuffer>(size);
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    TS_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(size);
+            case RendererAPI::API::Null:    return CreateRef<NullVertexBuffer>();
+        }
+        TS_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
     }
 
     Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size) {
-        return CreateRef<OpenGLVertexBuffer>(vertices, size);
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    TS_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(vertices, size);
+            case RendererAPI::API::Null:    return CreateRef<NullVertexBuffer>();
+        }
+        TS_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
     }
 
     // --- IndexBuffer Factory ---
     Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count) {
-        return CreateRef<OpenGLIndexBuffer>(indices, count);
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    TS_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLIndexBuffer>(indices, count);
+            case RendererAPI::API::Null:    return CreateRef<NullIndexBuffer>(count);
+        }
+        TS_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    // --- UniformBuffer Factory ---
+    Ref<UniformBuffer> UniformBuffer::Create(uint32_t size, uint32_t binding) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    TS_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLUniformBuffer>(size, binding);
+            case RendererAPI::API::Null:    return CreateRef<NullUniformBuffer>(binding);
+        }
+        TS_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
     }
 
 } // namespace Tesseract
@@ -0,0 +1,88 @@
+#include "core/Renderer/GpuProfiler.hpp"
+#include "core/Renderer/OpenGLGpuTimer.hpp"
+#include "core/Renderer/RendererAPI.hpp"
+#include "core/Renderer/RenderThread.hpp"
+
+#include <atomic>
+
+namespace Tesseract {
+
+    namespace {
+
+        struct GpuProfilerData {
+            std::atomic<bool> Supported{ false };
+            std::atomic<bool> Enabled{ true };
+
+            // Thread principal : état de la frame en cours d'enregistrement
+            bool FrameActive = false;
+            uint64_t FrameIndex = 0;
+        };
+
+        GpuProfilerData s_Data;
+
+    } // namespace
+
+    void GpuProfiler::Init() {
+        if (RendererAPI::GetAPI() != RendererAPI::API::OpenGL)
+            return;
+        RenderThread::Submit([]() { s_Data.Supported = OpenGLGpuTimer::Init(); });
+    }
+
+    void GpuProfiler::Shutdown() {
+        s_Data.FrameActive = false;
+        RenderThread::Submit([]() {
+            OpenGLGpuTimer::Shutdown();
+            s_Data.Supported = false;
+        });
+    }
+
+    bool GpuProfiler::IsSupported() {
+        return s_Data.Supported.load(std::memory_order_relaxed);
+    }
+
+    void GpuProfiler::SetEnabled(bool enabled) {
+        s_Data.Enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool GpuProfiler::IsEnabled() {
+        return s_Data.Enabled.load(std::memory_order_relaxed);
+    }
+
+    void GpuProfiler::BeginFrame() {
+        // L'activation n'est lue qu'ici : une frame n'est jamais à moitié chronométrée
+        s_Data.FrameActive = IsSupported() && IsEnabled();
+        if (!s_Data.FrameActive)
+            return;
+
+        uint64_t frameIndex = s_Data.FrameIndex++;
+        RenderThread::Submit([frameIndex]() { OpenGLGpuTimer::BeginFrame(frameIndex); });
+    }
+
+    void GpuProfiler::EndFrame() {
+        if (!s_Data.FrameActive)
+            return;
+        s_Data.FrameActive = false;
+        RenderThread::Submit([]() { OpenGLGpuTimer::EndFrame(); });
+    }
+
+    void GpuProfiler::BeginZone(const char* name) {
+        if (!s_Data.FrameActive)
+            return;
+        RenderThread::Submit([name]() { OpenGLGpuTimer::BeginZone(name); });
+    }
+
+    void GpuProfiler::EndZone() {
+        if (!s_Data.FrameActive)
+            return;
+        RenderThread::Submit([]() { OpenGLGpuTimer::EndZone(); });
+    }
+
+    GpuProfiler::FrameTimings GpuProfiler::GetLastFrame() {
+        return OpenGLGpuTimer::GetLastFrame();
+    }
+
+    GpuProfiler::Statistics GpuProfiler::GetStats() {
+        return OpenGLGpuTimer::GetStats();
+    }
+
+} // namespace Tesseract
@@ -0,0 +1,13 @@
+#include "core/Renderer/NullBuffer.hpp"
+#include "core/Core.hpp"
+#include "core/Logger.hpp"
+
+namespace Tesseract {
+
+    void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) {
+        // Même vérification que l'implémentation OpenGL : l'erreur reste visible sans GPU
+        TS_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+        m_VertexBuffers.push_back(vertexBuffer);
+    }
+
+} // namespace Tesseract
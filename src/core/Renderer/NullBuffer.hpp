@@ -0,0 +1,66 @@
+#pragma once
+
+#include "core/Renderer/Buffer.hpp"
+#include "core/Renderer/VertexArray.hpp"
+
+namespace Tesseract {
+
+    // --- Implémentations sans GPU (RendererAPI::API::Null) ---
+    // Seules les métadonnées sont conservées : le contenu envoyé est ignoré
+
+    class NullVertexBuffer : public VertexBuffer {
+    public:
+        virtual void Bind() const override {}
+        virtual void Unbind() const override {}
+
+        virtual void SetData([[maybe_unused]] const void* data, [[maybe_unused]] uint32_t size) override {}
+
+        virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+        virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+    private:
+        BufferLayout m_Layout;
+    };
+
+    class NullIndexBuffer : public IndexBuffer {
+    public:
+        explicit NullIndexBuffer(uint32_t count) : m_Count(count) {}
+
+        virtual void Bind() const override {}
+        virtual void Unbind() const override {}
+
+        virtual uint32_t GetCount() const override { return m_Count; }
+
+    private:
+        uint32_t m_Count;
+    };
+
+    class NullUniformBuffer : public UniformBuffer {
+    public:
+        explicit NullUniformBuffer(uint32_t binding) : m_Binding(binding) {}
+
+        virtual void SetData([[maybe_unused]] const void* data, [[maybe_unused]] uint32_t size, [[maybe_unused]] uint32_t offset = 0) override {}
+
+        virtual uint32_t GetBinding() const override { return m_Binding; }
+
+    private:
+        uint32_t m_Binding;
+    };
+
+    class NullVertexArray : public VertexArray {
+    public:
+        virtual void Bind() const override {}
+        virtual void Unbind() const override {}
+
+        virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+        virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override { m_IndexBuffer = indexBuffer; }
+
+        virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+        virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+
+    private:
+        std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+        Ref<IndexBuffer> m_IndexBuffer;
+    };
+
+} // namespace Tesseract
@@ -0,0 +1,32 @@
+#include "core/Renderer/NullRendererAPI.hpp"
+#include "core/Logger.hpp"
+
+namespace Tesseract {
+
+    void NullRendererAPI::Init() {
+        Logger::Info("Renderer: null API (headless, no GPU commands issued)");
+    }
+
+    void NullRendererAPI::Shutdown() {
+        Logger::Info("Renderer: null API shut down after {} draw calls", m_DrawCalls.load(std::memory_order_relaxed));
+    }
+
+    void NullRendererAPI::SetClearColor([[maybe_unused]] const glm::vec4& color) {}
+
+    void NullRendererAPI::Clear() {}
+
+    void NullRendererAPI::SetViewport([[maybe_unused]] uint32_t x, [[maybe_unused]] uint32_t y,
+                                      [[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height) {}
+
+    void NullRendererAPI::DrawIndexed([[maybe_unused]] const Ref<VertexArray>& vertexArray, [[maybe_unused]] uint32_t indexCount) {
+        m_DrawCalls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void NullRendererAPI::InvalidateState() {}
+
+    RendererAPI::StateStatistics NullRendererAPI::GetStateStatistics() const {
+        // Aucun état de driver à mettre en cache
+        return {};
+    }
+
+} // namespace Tesseract
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "core/Renderer/RendererAPI.hpp"
+
+#include <atomic>
+
+namespace Tesseract {
+
+    // API sans GPU (RendererAPI::API::Null) : les commandes sont comptées puis ignorées
+    class NullRendererAPI : public RendererAPI {
+    public:
+        virtual void Init() override;
+        virtual void Shutdown() override;
+
+        virtual void SetClearColor(const glm::vec4& color) override;
+        virtual void Clear() override;
+
+        virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+        virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+
+        virtual void InvalidateState() override;
+        virtual StateStatistics GetStateStatistics() const override;
+
+    private:
+        std::atomic<uint64_t> m_DrawCalls{ 0 };
+    };
+
+} // namespace Tesseract
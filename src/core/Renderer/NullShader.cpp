@@ -0,0 +1,20 @@
+#include "core/Renderer/NullShader.hpp"
+
+namespace Tesseract {
+
+    NullShader::NullShader(const std::string& filepath, const std::vector<std::string>& defines) {
+        // Même nom que l'implémentation OpenGL : Texture[TEXTURED,ALPHA_TEST]
+        auto lastSlash = filepath.find_last_of("/\\");
+        lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+        auto lastDot = filepath.rfind('.');
+        auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+        m_Name = filepath.substr(lastSlash, count);
+        if (!defines.empty()) {
+            m_Name += '[';
+            for (size_t i = 0; i < defines.size(); ++i)
+                m_Name += (i ? "," : "") + defines[i];
+            m_Name += ']';
+        }
+    }
+
+} // namespace Tesseract
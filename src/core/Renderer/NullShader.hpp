@@ -0,0 +1,30 @@
+#pragma once
+
+#include "core/Renderer/Shader.hpp"
+
+namespace Tesseract {
+
+    // Shader sans GPU (RendererAPI::API::Null) : ni lecture ni compilation, uniforms ignorés
+    class NullShader : public Shader {
+    public:
+        NullShader(const std::string& filepath, const std::vector<std::string>& defines = {});
+
+        virtual void Bind() const override {}
+        virtual void Unbind() const override {}
+
+        virtual void SetInt([[maybe_unused]] const std::string& name, [[maybe_unused]] int value) override {}
+        virtual void SetIntArray([[maybe_unused]] const std::string& name, [[maybe_unused]] const int* values, [[maybe_unused]] uint32_t count) override {}
+        virtual void SetFloat([[maybe_unused]] const std::string& name, [[maybe_unused]] float value) override {}
+        virtual void SetFloat2([[maybe_unused]] const std::string& name, [[maybe_unused]] const glm::vec2& value) override {}
+        virtual void SetFloat3([[maybe_unused]] const std::string& name, [[maybe_unused]] const glm::vec3& value) override {}
+        virtual void SetFloat4([[maybe_unused]] const std::string& name, [[maybe_unused]] const glm::vec4& value) override {}
+        virtual void SetMat3([[maybe_unused]] const std::string& name, [[maybe_unused]] const glm::mat3& matrix) override {}
+        virtual void SetMat4([[maybe_unused]] const std::string& name, [[maybe_unused]] const glm::mat4& matrix) override {}
+
+        virtual const std::string& GetName() const override { return m_Name; }
+
+    private:
+        std::string m_Name;
+    };
+
+} // namespace Tesseract
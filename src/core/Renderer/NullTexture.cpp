@@ -0,0 +1,40 @@
+#include "core/Renderer/NullTexture.hpp"
+#include "core/Logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+namespace Tesseract {
+
+    namespace {
+        std::atomic<uint32_t> s_NextRendererID{ 1 };
+    } // namespace
+
+    NullTexture2D::NullTexture2D(uint32_t width, uint32_t height)
+        : m_Width(width), m_Height(height), m_MemorySize((size_t)width * height * 4), m_Loaded(true),
+          m_RendererID(s_NextRendererID.fetch_add(1, std::memory_order_relaxed)) {}
+
+    NullTexture2D::NullTexture2D(const std::string& path, bool deferLoad)
+        : m_Path(path), m_RendererID(s_NextRendererID.fetch_add(1, std::memory_order_relaxed)) {
+
+        if (deferLoad)
+            return;
+
+        Image image = Image::Load(path);
+        if (!image.IsValid()) {
+            TS_ERROR("Failed to load image! Path: {}", path);
+            return;
+        }
+        SetImage(std::move(image));
+    }
+
+    void NullTexture2D::SetImage(Image&& image) {
+        m_Width = image.Width;
+        m_Height = image.Height;
+        // Budget mémoire de l'AssetManager : taille des données reçues, mips compris
+        m_MipLevels = image.IsCompressed() ? (uint32_t)std::max<size_t>(image.Levels.size(), 1) : 1;
+        m_MemorySize = image.GetSize();
+        m_Loaded = true;
+    }
+
+} // namespace Tesseract
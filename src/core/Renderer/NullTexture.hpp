@@ -0,0 +1,41 @@
+#pragma once
+
+#include "core/Renderer/Texture.hpp"
+#include <string>
+
+namespace Tesseract {
+
+    // Texture sans GPU (RendererAPI::API::Null) : dimensions et taille conservées, pixels ignorés
+    class NullTexture2D : public Texture2D {
+    public:
+        NullTexture2D(uint32_t width, uint32_t height);
+        // Le fichier est tout de même décodé : dimensions et coût CPU identiques au rendu réel
+        NullTexture2D(const std::string& path, bool deferLoad = false);
+
+        virtual uint32_t GetWidth() const override { return m_Width; }
+        virtual uint32_t GetHeight() const override { return m_Height; }
+        // Identifiant unique, sans objet GPU derrière (comparaisons, batching)
+        virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+        virtual void SetData([[maybe_unused]] void* data, [[maybe_unused]] uint32_t size) override {}
+        virtual void SetImage(Image&& image) override;
+        virtual uint32_t GetMipLevelCount() const override { return m_MipLevels; }
+        virtual size_t GetMemorySize() const override { return m_MemorySize; }
+        virtual bool IsLoaded() const override { return m_Loaded; }
+
+        virtual void Bind([[maybe_unused]] uint32_t slot = 0) const override {}
+
+        virtual bool operator==(const Texture& other) const override {
+            return m_RendererID == other.GetRendererID();
+        }
+
+    private:
+        std::string m_Path;
+        uint32_t m_Width = 0, m_Height = 0;
+        uint32_t m_MipLevels = 1;
+        size_t m_MemorySize = 0;
+        bool m_Loaded = false;
+        uint32_t m_RendererID;
+    };
+
+} // namespace Tesseract
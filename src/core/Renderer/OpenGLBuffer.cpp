@@ -1,73 +1,131 @@
 #include "core/Renderer/OpenGLBuffer.hpp"
+#include "core/Renderer/RenderThread.hpp"
+#include "core/Renderer/OpenGLStateCache.hpp"
 #include "core/Core.hpp"
-#include "core/Logger.hpp"
+#include "core/BinaryLog.hpp"
 #include <GL/glew.h>
 
 namespace Tesseract {
 
+    // Les appels GL passent par le RenderThread : les commandes capturent le nom GL
+    // partagé (m_RendererID) et des copies des données, jamais `this`.
+
     // --- VertexBuffer OpenGL ---
 
     // Constructeur pour buffer dynamique
-    OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size) {
-        glCreateBuffers(1, &m_RendererID);
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-        // Allouer la mémoire sans données initiales, usage dynamique
-        glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
-        Logger::Trace("Created dynamic OpenGL VertexBuffer (ID: {})", m_RendererID);
+    OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size)
+        : m_RendererID(CreateRef<uint32_t>(0)) {
+        RenderThread::Submit([rendererID = m_RendererID, size]() {
+            glCreateBuffers(1, rendererID.get());
+            // Allouer la mémoire sans données initiales, usage dynamique (DSA : sans liaison)
+            glNamedBufferData(*rendererID, size, nullptr, GL_DYNAMIC_DRAW);
+            TS_BLOG_TRACE("Created dynamic OpenGL VertexBuffer (ID: {})", *rendererID);
+        });
     }
 
     // Constructeur pour données statiques initiales
-    OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size) {
-        glCreateBuffers(1, &m_RendererID); // Crée le buffer
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID); // Le lie
-        // Envoie les données, usage statique
-        glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
-        Logger::Trace("Created static OpenGL VertexBuffer (ID: {}) with size {}", m_RendererID, size);
+    OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size)
+        : m_RendererID(CreateRef<uint32_t>(0)) {
+        const void* data = RenderThread::SubmitData(vertices, size);
+        RenderThread::Submit([rendererID = m_RendererID, data, size]() {
+            glCreateBuffers(1, rendererID.get()); // Crée le buffer
+            // Envoie les données, usage statique
+            glNamedBufferData(*rendererID, size, data, GL_STATIC_DRAW);
+            TS_BLOG_TRACE("Created static OpenGL VertexBuffer (ID: {}) with size {}", *rendererID, size);
+        });
     }
 
     OpenGLVertexBuffer::~OpenGLVertexBuffer() {
-        glDeleteBuffers(1, &m_RendererID);
-        Logger::Trace("Deleted OpenGL VertexBuffer (ID: {})", m_RendererID);
+        RenderThread::Submit([rendererID = m_RendererID]() {
+            OpenGLStateCache::ForgetBuffer(*rendererID);
+            glDeleteBuffers(1, rendererID.get());
+            TS_BLOG_TRACE("Deleted OpenGL VertexBuffer (ID: {})", *rendererID);
+        });
     }
 
     void OpenGLVertexBuffer::Bind() const {
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        RenderThread::Submit([rendererID = m_RendererID]() {
+            OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, *rendererID);
+        });
     }
 
     void OpenGLVertexBuffer::Unbind() const {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        RenderThread::Submit([]() {
+            OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, 0);
+        });
     }
 
     void OpenGLVertexBuffer::SetData(const void* data, uint32_t size) {
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-        // Met à jour (une partie ou tout) le contenu du buffer
-        // Le 0 indique qu'on commence au début du buffer
-        glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+        // Copie dans la file : l'appelant peut réutiliser son tampon immédiatement
+        const void* copy = RenderThread::SubmitData(data, size);
+        RenderThread::Submit([rendererID = m_RendererID, copy, size]() {
+            // Met à jour (une partie ou tout) le contenu du buffer, sans le lier
+            // Le 0 indique qu'on commence au début du buffer
+            glNamedBufferSubData(*rendererID, 0, size, copy);
+        });
     }
 
     // --- IndexBuffer OpenGL ---
 
     OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* indices, uint32_t count)
-        : m_Count(count)
+        : m_RendererID(CreateRef<uint32_t>(0)), m_Count(count)
     {
-        glCreateBuffers(1, &m_RendererID);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
-        // Envoie les données, usage statique pour les indices généralement
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
-        Logger::Trace("Created OpenGL IndexBuffer (ID: {}) with count {}", m_RendererID, count);
+        const void* data = RenderThread::SubmitData(indices, count * sizeof(uint32_t));
+        RenderThread::Submit([rendererID = m_RendererID, data, count]() {
+            glCreateBuffers(1, rendererID.get());
+            // Envoie les données, usage statique pour les indices généralement
+            glNamedBufferData(*rendererID, count * sizeof(uint32_t), data, GL_STATIC_DRAW);
+            TS_BLOG_TRACE("Created OpenGL IndexBuffer (ID: {}) with count {}", *rendererID, count);
+        });
     }
 
     OpenGLIndexBuffer::~OpenGLIndexBuffer() {
-        glDeleteBuffers(1, &m_RendererID);
-        Logger::Trace("Deleted OpenGL IndexBuffer (ID: {})", m_RendererID);
+        RenderThread::Submit([rendererID = m_RendererID]() {
+            OpenGLStateCache::ForgetBuffer(*rendererID);
+            glDeleteBuffers(1, rendererID.get());
+            TS_BLOG_TRACE("Deleted OpenGL IndexBuffer (ID: {})", *rendererID);
+        });
     }
 
     void OpenGLIndexBuffer::Bind() const {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+        RenderThread::Submit([rendererID = m_RendererID]() {
+            OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, *rendererID);
+        });
     }
 
     void OpenGLIndexBuffer::Unbind() const {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        RenderThread::Submit([]() {
+            OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        });
+    }
+
+    // --- UniformBuffer OpenGL ---
+
+    OpenGLUniformBuffer::OpenGLUniformBuffer(uint32_t size, uint32_t binding)
+        : m_RendererID(CreateRef<uint32_t>(0)), m_Size(size), m_Binding(binding)
+    {
+        RenderThread::Submit([rendererID = m_RendererID, size, binding]() {
+            glCreateBuffers(1, rendererID.get());
+            glNamedBufferData(*rendererID, size, nullptr, GL_DYNAMIC_DRAW);
+            // Lié une fois pour toutes : les programmes y associent leurs blocs au link
+            glBindBufferBase(GL_UNIFORM_BUFFER, binding, *rendererID);
+            TS_BLOG_TRACE("Created OpenGL UniformBuffer (ID: {}) at binding {}", *rendererID, binding);
+        });
+    }
+
+    OpenGLUniformBuffer::~OpenGLUniformBuffer() {
+        RenderThread::Submit([rendererID = m_RendererID]() {
+            OpenGLStateCache::ForgetBuffer(*rendererID);
+            glDeleteBuffers(1, rendererID.get());
+        });
+    }
+
+    void OpenGLUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+        TS_ASSERT(offset + size <= m_Size, "UniformBuffer::SetData out of range");
+        const void* copy = RenderThread::SubmitData(data, size);
+        RenderThread::Submit([rendererID = m_RendererID, copy, size, offset]() {
+            glNamedBufferSubData(*rendererID, offset, size, copy);
+        });
     }
 
 } // namespace Tesseract
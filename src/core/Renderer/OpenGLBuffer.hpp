@@ -20,7 +20,8 @@ namespace Tesseract {
         virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
 
     private:
-        uint32_t m_RendererID;
+        // Nom GL partagé avec les commandes en attente (rempli par le thread de rendu)
+        Ref<uint32_t> m_RendererID;
         BufferLayout m_Layout;
     };
 
@@ -36,8 +37,24 @@ namespace Tesseract {
         virtual uint32_t GetCount() const override { return m_Count; }
 
     private:
-        uint32_t m_RendererID;
+        Ref<uint32_t> m_RendererID;
         uint32_t m_Count;
     };
 
+    // --- Implémentation OpenGL UniformBuffer ---
+    class OpenGLUniformBuffer : public UniformBuffer {
+    public:
+        OpenGLUniformBuffer(uint32_t size, uint32_t binding);
+        virtual ~OpenGLUniformBuffer();
+
+        virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+        virtual uint32_t GetBinding() const override { return m_Binding; }
+
+    private:
+        Ref<uint32_t> m_RendererID;
+        uint32_t m_Size;
+        uint32_t m_Binding;
+    };
+
 } // namespace Tesseract
@@ -0,0 +1,238 @@
+#include "core/Renderer/OpenGLGpuTimer.hpp"
+#include "core/Logger.hpp"
+#include "core/Metrics.hpp"
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <mutex>
+
+namespace Tesseract {
+
+    namespace {
+
+        constexpr uint32_t InvalidZone = 0xFFFFFFFFu;
+
+        struct PendingZone {
+            const char* Name;
+            uint32_t BeginQuery;
+            uint32_t EndQuery;
+            uint32_t Depth;
+        };
+
+        // Requêtes d'une frame ; réutilisées FramesInFlight frames plus tard
+        struct FrameSlot {
+            std::vector<GLuint> Queries;
+            uint32_t UsedQueries = 0;
+            std::vector<PendingZone> Zones;
+            uint64_t FrameIndex = 0;
+            int64_t ClockOffsetNs = 0; // Horloge du profileur - horloge GPU
+            bool Pending = false;
+        };
+
+        struct TimerData {
+            bool Initialized = false;
+            FrameSlot Slots[GpuProfiler::FramesInFlight];
+            uint32_t Current = 0;
+            bool FrameOpen = false;
+            std::vector<uint32_t> OpenZones; // Indices dans Zones (InvalidZone si ignorée)
+            uint32_t Track = 0;
+
+            std::mutex ResultMutex;
+            GpuProfiler::FrameTimings LastFrame;
+            GpuProfiler::Statistics Stats;
+        };
+
+        TimerData s_Timer;
+
+        uint32_t IssueQuery(FrameSlot& slot) {
+            if (slot.UsedQueries == slot.Queries.size()) {
+                GLuint query = 0;
+                glGenQueries(1, &query);
+                slot.Queries.push_back(query);
+            }
+            glQueryCounter(slot.Queries[slot.UsedQueries], GL_TIMESTAMP);
+            return slot.UsedQueries++;
+        }
+
+        // Lit les résultats d'une frame s'ils sont prêts, sans jamais attendre le GPU
+        bool Resolve(FrameSlot& slot) {
+            if (slot.Zones.empty())
+                return true;
+
+            // Les timestamps sont écrits dans l'ordre : la dernière requête suffit
+            GLint available = 0;
+            glGetQueryObjectiv(slot.Queries[slot.UsedQueries - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+                return false;
+
+            std::vector<GLuint64> timestamps(slot.UsedQueries);
+            for (uint32_t i = 0; i < slot.UsedQueries; ++i)
+                glGetQueryObjectui64v(slot.Queries[i], GL_QUERY_RESULT, &timestamps[i]);
+
+            GpuProfiler::FrameTimings frame;
+            frame.FrameIndex = slot.FrameIndex;
+            frame.Zones.reserve(slot.Zones.size());
+            const GLuint64 frameStart = timestamps[slot.Zones.front().BeginQuery];
+            for (const PendingZone& pending : slot.Zones) {
+                GLuint64 begin = timestamps[pending.BeginQuery];
+                GLuint64 end = std::max(timestamps[pending.EndQuery], begin);
+
+                GpuProfiler::Zone zone;
+                zone.Name = pending.Name;
+                zone.StartMs = (float)((double)(begin - std::min(begin, frameStart)) / 1.0e6);
+                zone.DurationMs = (float)((double)(end - begin) / 1.0e6);
+                zone.Depth = pending.Depth;
+                frame.Zones.push_back(zone);
+
+                if (Profiler::IsCompiled()) {
+                    Profiler::Event event;
+                    event.Name = pending.Name;
+                    event.StartNs = (uint64_t)std::max<int64_t>((int64_t)begin + slot.ClockOffsetNs, 0);
+                    event.EndNs = (uint64_t)std::max<int64_t>((int64_t)end + slot.ClockOffsetNs, 0);
+                    event.Depth = pending.Depth;
+                    Profiler::RecordEvent(s_Timer.Track, event);
+                }
+            }
+            frame.GpuMs = frame.Zones.front().DurationMs;
+
+            static Metric& gpuFrameMs = Metrics::GetGauge("GPU.FrameMs", "ms");
+            gpuFrameMs.Set(frame.GpuMs);
+
+            std::lock_guard<std::mutex> lock(s_Timer.ResultMutex);
+            s_Timer.LastFrame = std::move(frame);
+            s_Timer.Stats.ResolvedFrames++;
+            return true;
+        }
+
+    } // namespace
+
+    bool OpenGLGpuTimer::Init() {
+        if (s_Timer.Initialized)
+            return true;
+
+        // Disponible sur llvmpipe comme sur les pilotes matériels
+        if (!GLEW_VERSION_3_3 && !GLEW_ARB_timer_query) {
+            Logger::Warn("OpenGLGpuTimer: ARB_timer_query indisponible, chronométrage GPU désactivé");
+            return false;
+        }
+
+        GLint bits = 0;
+        glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &bits);
+        if (bits == 0) {
+            Logger::Warn("OpenGLGpuTimer: timestamps GPU non implémentés par le pilote");
+            return false;
+        }
+
+        if (Profiler::IsCompiled())
+            s_Timer.Track = Profiler::CreateTrack("GPU");
+        s_Timer.Initialized = true;
+        Logger::Info("OpenGLGpuTimer: requêtes de timestamp {} bits, {} frames en vol", bits, GpuProfiler::FramesInFlight);
+        return true;
+    }
+
+    void OpenGLGpuTimer::Shutdown() {
+        if (!s_Timer.Initialized)
+            return;
+
+        for (FrameSlot& slot : s_Timer.Slots) {
+            if (!slot.Queries.empty())
+                glDeleteQueries((GLsizei)slot.Queries.size(), slot.Queries.data());
+            slot = FrameSlot();
+        }
+        s_Timer.OpenZones.clear();
+        s_Timer.FrameOpen = false;
+        s_Timer.Initialized = false;
+    }
+
+    void OpenGLGpuTimer::BeginFrame(uint64_t frameIndex) {
+        if (!s_Timer.Initialized || s_Timer.FrameOpen)
+            return;
+
+        FrameSlot& slot = s_Timer.Slots[s_Timer.Current];
+        if (slot.Pending && !Resolve(slot)) {
+            // Le GPU a plus de FramesInFlight frames de retard : abandonner plutôt qu'attendre
+            std::lock_guard<std::mutex> lock(s_Timer.ResultMutex);
+            s_Timer.Stats.DroppedFrames++;
+        }
+        slot.Pending = false;
+        slot.UsedQueries = 0;
+        slot.Zones.clear();
+        slot.FrameIndex = frameIndex;
+
+        s_Timer.FrameOpen = true;
+        BeginZone("GPU Frame");
+    }
+
+    void OpenGLGpuTimer::EndFrame() {
+        if (!s_Timer.FrameOpen)
+            return;
+
+        while (!s_Timer.OpenZones.empty())
+            EndZone();
+
+        // Recalage GPU -> profileur : GL_TIMESTAMP donne l'heure GPU courante sans synchronisation
+        FrameSlot& slot = s_Timer.Slots[s_Timer.Current];
+        GLint64 gpuNow = 0;
+        glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+        slot.ClockOffsetNs = (int64_t)Profiler::Now() - (int64_t)gpuNow;
+        slot.Pending = true;
+
+        s_Timer.FrameOpen = false;
+        s_Timer.Current = (s_Timer.Current + 1) % GpuProfiler::FramesInFlight;
+
+        // Résolution des frames terminées, de la plus ancienne à la plus récente
+        for (uint32_t i = 0; i < GpuProfiler::FramesInFlight; ++i) {
+            FrameSlot& pending = s_Timer.Slots[(s_Timer.Current + i) % GpuProfiler::FramesInFlight];
+            if (!pending.Pending)
+                continue;
+            if (!Resolve(pending))
+                break; // Les frames suivantes ne peuvent pas être terminées
+            pending.Pending = false;
+        }
+    }
+
+    void OpenGLGpuTimer::BeginZone(const char* name) {
+        if (!s_Timer.FrameOpen)
+            return;
+
+        FrameSlot& slot = s_Timer.Slots[s_Timer.Current];
+        if (slot.Zones.size() >= GpuProfiler::MaxZonesPerFrame) {
+            s_Timer.OpenZones.push_back(InvalidZone);
+            std::lock_guard<std::mutex> lock(s_Timer.ResultMutex);
+            s_Timer.Stats.OverflowZones++;
+            return;
+        }
+
+        PendingZone zone;
+        zone.Name = name;
+        zone.BeginQuery = IssueQuery(slot);
+        zone.EndQuery = zone.BeginQuery;
+        zone.Depth = (uint32_t)s_Timer.OpenZones.size();
+        s_Timer.OpenZones.push_back((uint32_t)slot.Zones.size());
+        slot.Zones.push_back(zone);
+    }
+
+    void OpenGLGpuTimer::EndZone() {
+        if (!s_Timer.FrameOpen || s_Timer.OpenZones.empty())
+            return;
+
+        uint32_t index = s_Timer.OpenZones.back();
+        s_Timer.OpenZones.pop_back();
+        if (index == InvalidZone)
+            return;
+
+        FrameSlot& slot = s_Timer.Slots[s_Timer.Current];
+        slot.Zones[index].EndQuery = IssueQuery(slot);
+    }
+
+    GpuProfiler::FrameTimings OpenGLGpuTimer::GetLastFrame() {
+        std::lock_guard<std::mutex> lock(s_Timer.ResultMutex);
+        return s_Timer.LastFrame;
+    }
+
+    GpuProfiler::Statistics OpenGLGpuTimer::GetStats() {
+        std::lock_guard<std::mutex> lock(s_Timer.ResultMutex);
+        return s_Timer.Stats;
+    }
+
+} // namespace Tesseract
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "core/Renderer/GpuProfiler.hpp"
+
+namespace Tesseract {
+
+    /**
+     * @class OpenGLGpuTimer
+     * @brief Anneau de requêtes glQueryCounter(GL_TIMESTAMP) utilisé par GpuProfiler
+     *
+     * Les timestamps (plutôt que GL_TIME_ELAPSED) permettent d'imbriquer les
+     * zones. Toutes les fonctions, sauf GetLastFrame/GetStats, s'exécutent sur
+     * le thread propriétaire du contexte GL.
+     */
+    class OpenGLGpuTimer {
+    public:
+        // ARB_timer_query (GL 3.3) requis ; faux sinon
+        static bool Init();
+        static void Shutdown();
+
+        static void BeginFrame(uint64_t frameIndex);
+        static void EndFrame();
+        static void BeginZone(const char* name);
+        static void EndZone();
+
+        static GpuProfiler::FrameTimings GetLastFrame();
+        static GpuProfiler::Statistics GetStats();
+    };
+
+} // namespace Tesseract
@@ -0,0 +1,168 @@
+#include "core/Renderer/OpenGLPixelUnpackRing.hpp"
+#include "core/Renderer/OpenGLStateCache.hpp"
+#include "core/Logger.hpp"
+
+#include <GL/glew.h>
+#include <atomic>
+#include <cstring>
+#include <deque>
+
+namespace Tesseract {
+
+    namespace {
+
+        // Décalage des envois dans le PBO (multiple de toute taille de texel)
+        constexpr size_t UploadAlignment = 16;
+
+        struct FencedRange {
+            GLsync Fence;
+            size_t Begin;
+            size_t End;
+        };
+
+        struct RingData {
+            GLuint Buffer = 0;
+            uint8_t* Mapped = nullptr;
+            size_t Size = 0;
+            size_t Head = 0;
+
+            // Zones en cours de lecture par le GPU, dans l'ordre d'écriture
+            std::deque<FencedRange> Pending;
+            bool UploadActive = false;
+            size_t CurrentBegin = 0;
+            size_t CurrentEnd = 0;
+
+            std::atomic<uint64_t> UploadedBytes{ 0 };
+            std::atomic<uint32_t> Uploads{ 0 };
+            std::atomic<uint32_t> DirectUploads{ 0 };
+            std::atomic<uint32_t> FenceWaits{ 0 };
+        };
+
+        RingData s_Ring;
+
+        void WaitForFence(GLsync fence) {
+            GLenum status = glClientWaitSync(fence, 0, 0);
+            if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+                return;
+
+            s_Ring.FenceWaits.fetch_add(1, std::memory_order_relaxed);
+            while (true) {
+                status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000); // 1 s
+                if (status != GL_TIMEOUT_EXPIRED)
+                    break;
+                Logger::Warn("OpenGLPixelUnpackRing: attente d'une fence depuis plus d'une seconde");
+            }
+        }
+
+        void ReleaseFront() {
+            glDeleteSync(s_Ring.Pending.front().Fence);
+            s_Ring.Pending.pop_front();
+        }
+
+    } // namespace
+
+    void OpenGLPixelUnpackRing::Init(size_t size) {
+        if (s_Ring.Buffer)
+            return;
+
+        if (!GLEW_VERSION_4_4 && !GLEW_ARB_buffer_storage) {
+            Logger::Warn("OpenGLPixelUnpackRing: ARB_buffer_storage indisponible, envois de textures directs");
+            return;
+        }
+
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &s_Ring.Buffer);
+        glNamedBufferStorage(s_Ring.Buffer, (GLsizeiptr)size, nullptr, flags);
+        s_Ring.Mapped = static_cast<uint8_t*>(glMapNamedBufferRange(s_Ring.Buffer, 0, (GLsizeiptr)size, flags));
+        if (!s_Ring.Mapped) {
+            Logger::Warn("OpenGLPixelUnpackRing: mapping persistant impossible, envois de textures directs");
+            glDeleteBuffers(1, &s_Ring.Buffer);
+            s_Ring.Buffer = 0;
+            return;
+        }
+
+        s_Ring.Size = size;
+        s_Ring.Head = 0;
+        Logger::Info("OpenGLPixelUnpackRing: {} Mo de PBO persistant", size / (1024 * 1024));
+    }
+
+    void OpenGLPixelUnpackRing::Shutdown() {
+        if (!s_Ring.Buffer)
+            return;
+
+        while (!s_Ring.Pending.empty())
+            ReleaseFront();
+        glUnmapNamedBuffer(s_Ring.Buffer);
+        OpenGLStateCache::ForgetBuffer(s_Ring.Buffer);
+        glDeleteBuffers(1, &s_Ring.Buffer);
+        s_Ring.Buffer = 0;
+        s_Ring.Mapped = nullptr;
+        s_Ring.Size = 0;
+    }
+
+    const void* OpenGLPixelUnpackRing::BeginUpload(const void* data, size_t size) {
+        if (!s_Ring.Mapped || size == 0 || size > s_Ring.Size) {
+            s_Ring.DirectUploads.fetch_add(1, std::memory_order_relaxed);
+            return data;
+        }
+
+        size_t begin = (s_Ring.Head + UploadAlignment - 1) & ~(UploadAlignment - 1);
+        bool wrapped = begin + size > s_Ring.Size;
+        if (wrapped)
+            begin = 0;
+        size_t end = begin + size;
+
+        // Les zones encore lues par le GPU sont rangées dans l'ordre du ring à partir
+        // de Head : celles à libérer forment toujours un préfixe de la file
+        while (!s_Ring.Pending.empty()) {
+            const FencedRange& range = s_Ring.Pending.front();
+            bool skippedTail = wrapped && range.Begin >= s_Ring.Head; // Fin du ring abandonnée
+            bool overlaps = range.Begin < end && begin < range.End;
+            if (!skippedTail && !overlaps) {
+                // Rien à attendre : libérer au passage les fences déjà signalées
+                GLenum status = glClientWaitSync(range.Fence, 0, 0);
+                if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                    break;
+            } else {
+                WaitForFence(range.Fence);
+            }
+            ReleaseFront();
+        }
+
+        std::memcpy(s_Ring.Mapped + begin, data, size);
+        s_Ring.Head = end;
+        s_Ring.CurrentBegin = begin;
+        s_Ring.CurrentEnd = end;
+        s_Ring.UploadActive = true;
+
+        s_Ring.UploadedBytes.fetch_add(size, std::memory_order_relaxed);
+        s_Ring.Uploads.fetch_add(1, std::memory_order_relaxed);
+
+        OpenGLStateCache::BindBuffer(GL_PIXEL_UNPACK_BUFFER, s_Ring.Buffer);
+        return reinterpret_cast<const void*>(begin);
+    }
+
+    void OpenGLPixelUnpackRing::EndUpload() {
+        if (!s_Ring.UploadActive)
+            return;
+
+        OpenGLStateCache::BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        s_Ring.Pending.push_back({ fence, s_Ring.CurrentBegin, s_Ring.CurrentEnd });
+        s_Ring.UploadActive = false;
+    }
+
+    bool OpenGLPixelUnpackRing::IsAvailable() {
+        return s_Ring.Mapped != nullptr;
+    }
+
+    OpenGLPixelUnpackRing::Statistics OpenGLPixelUnpackRing::GetStats() {
+        Statistics stats;
+        stats.UploadedBytes = s_Ring.UploadedBytes.load(std::memory_order_relaxed);
+        stats.Uploads = s_Ring.Uploads.load(std::memory_order_relaxed);
+        stats.DirectUploads = s_Ring.DirectUploads.load(std::memory_order_relaxed);
+        stats.FenceWaits = s_Ring.FenceWaits.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace Tesseract
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Tesseract {
+
+    /**
+     * @class OpenGLPixelUnpackRing
+     * @brief Tampon circulaire de PBO (GL_PIXEL_UNPACK_BUFFER) persistant pour les envois de textures
+     *
+     * Un seul buffer est alloué avec glNamedBufferStorage puis mappé une fois pour
+     * toutes (GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT). Chaque envoi copie les
+     * pixels dans la zone suivante du ring et la commande glTexture*SubImage lit
+     * depuis le PBO : le driver n'a plus à recopier la mémoire client avant de
+     * rendre la main, le transfert se fait en parallèle du rendu. Chaque zone est
+     * protégée par une fence, attendue seulement si le ring revient dessus avant
+     * que le GPU ne l'ait consommée.
+     *
+     * Toutes les fonctions s'exécutent sur le thread propriétaire du contexte GL.
+     * Sans GL 4.4 / ARB_buffer_storage, ou pour un envoi plus gros que le ring,
+     * les données sont envoyées directement depuis la mémoire client.
+     */
+    class OpenGLPixelUnpackRing {
+    public:
+        static constexpr size_t DefaultSize = 32 * 1024 * 1024;
+
+        struct Statistics {
+            uint64_t UploadedBytes = 0; // Octets passés par le ring
+            uint32_t Uploads = 0;
+            uint32_t DirectUploads = 0; // Envois sans PBO (ring indisponible ou trop petit)
+            uint32_t FenceWaits = 0;    // Attentes du GPU avant de réutiliser une zone
+        };
+
+        static void Init(size_t size = DefaultSize);
+        static void Shutdown();
+
+        /**
+         * @brief Copie des pixels dans le ring et lie le PBO
+         * @return Valeur à passer comme pointeur de pixels à glTexture*SubImage*
+         *         (décalage dans le PBO, ou data si le ring n'est pas utilisé).
+         *         Doit être suivi de EndUpload() après la commande d'envoi.
+         */
+        static const void* BeginUpload(const void* data, size_t size);
+        // Délie le PBO et pose la fence protégeant la zone utilisée
+        static void EndUpload();
+
+        static bool IsAvailable();
+        // Lisible depuis n'importe quel thread
+        static Statistics GetStats();
+    };
+
+} // namespace Tesseract
@@ -1,5 +1,7 @@
 #include "core/Renderer/OpenGLRendererAPI.hpp"
 #include "core/Logger.hpp"
+#include "core/Renderer/OpenGLPixelUnpackRing.hpp"
+#include "core/Renderer/OpenGLStateCache.hpp"
 
 #include <GL/glew.h>
 
@@ -8,11 +10,18 @@ namespace Tesseract {
     void OpenGLRendererAPI::Init() {
         Logger::Info("Initializing OpenGL RendererAPI...");
         // Activer le blending pour la transparence
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        OpenGLStateCache::SetEnabled(GL_BLEND, true);
+        OpenGLStateCache::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
         // Activer le test de profondeur
-        glEnable(GL_DEPTH_TEST);
+        OpenGLStateCache::SetEnabled(GL_DEPTH_TEST, true);
+
+        // Staging persistant des envois de textures
+        OpenGLPixelUnpackRing::Init();
+    }
+
+    void OpenGLRendererAPI::Shutdown() {
+        OpenGLPixelUnpackRing::Shutdown();
     }
 
     void OpenGLRendererAPI::SetClearColor(const glm::vec4& color) {
@@ -38,4 +47,13 @@ namespace Tesseract {
         // vertexArray->Unbind();
     }
 
+    void OpenGLRendererAPI::InvalidateState() {
+        OpenGLStateCache::Invalidate();
+    }
+
+    RendererAPI::StateStatistics OpenGLRendererAPI::GetStateStatistics() const {
+        OpenGLStateCache::Statistics stats = OpenGLStateCache::GetStats();
+        return { stats.IssuedCalls, stats.SkippedCalls };
+    }
+
 } // namespace Tesseract
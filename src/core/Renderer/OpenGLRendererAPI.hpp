@@ -7,6 +7,7 @@ namespace Tesseract {
     class OpenGLRendererAPI : public RendererAPI {
     public:
         virtual void Init() override;
+        virtual void Shutdown() override;
 
         virtual void SetClearColor(const glm::vec4& color) override;
         virtual void Clear() override;
@@ -14,6 +15,9 @@ namespace Tesseract {
         virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
 
         virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+
+        virtual void InvalidateState() override;
+        virtual StateStatistics GetStateStatistics() const override;
     };
 
 } // namespace Tesseract
@@ -1,8 +1,15 @@
 #include "core/Renderer/OpenGLShader.hpp"
 #include "core/Logger.hpp"
+#include "core/BinaryLog.hpp"
 #include "core/Core.hpp" // Pour TS_ASSERT
-
-#include <fstream>
+#include "core/Renderer/RenderThread.hpp"
+#include "core/Renderer/OpenGLShaderCache.hpp"
+#include "core/Renderer/OpenGLStateCache.hpp"
+#include "core/Renderer/RendererUniforms.hpp"
+#include "core/Asset/AssetManager.hpp"
+
+#include <chrono>
+#include <algorithm>
 #include <sstream>
 #include <vector>
 #include <GL/glew.h> // Utiliser GLEW au lieu de Glad
@@ -26,8 +33,8 @@ namespace Tesseract {
     } // namespace Utils
     // ---------------------------------------------------
 
-    OpenGLShader::OpenGLShader(const std::string& filepath)
-        : m_FilePath(filepath), m_RendererID(0)
+    OpenGLShader::OpenGLShader(const std::string& filepath, const std::vector<std::string>& defines)
+        : m_FilePath(filepath), m_Program(CreateRef<ProgramState>())
     {
         std::string source = ReadFile(filepath);
         TS_ASSERT(!source.empty(), "Failed to read shader file: {}", filepath);
@@ -35,49 +42,114 @@ namespace Tesseract {
         auto shaderSources = PreProcess(source);
         TS_ASSERT(shaderSources.count(GL_VERTEX_SHADER) && shaderSources.count(GL_FRAGMENT_SHADER),
                   "Shader file must contain both vertex and fragment shaders! File: {}", filepath);
+        for (auto& [type, stageSource] : shaderSources) {
+            // Chaque étage est compilé séparément : ses inclusions aussi
+            std::vector<std::string> included = { filepath };
+            stageSource = ResolveIncludes(stageSource, filepath, included);
+            InjectDefines(stageSource, defines);
+        }
 
-        Compile(shaderSources);
-
-        // Extraire le nom du fichier (après compilation réussie)
+        // Extraire le nom du fichier
         auto lastSlash = filepath.find_last_of("/\\");
         lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
         auto lastDot = filepath.rfind('.');
         auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
         m_Name = filepath.substr(lastSlash, count);
+        // Nom de variante : Texture[TEXTURED,ALPHA_TEST]
+        if (!defines.empty()) {
+            m_Name += '[';
+            for (size_t i = 0; i < defines.size(); ++i)
+                m_Name += (i ? "," : "") + defines[i];
+            m_Name += ']';
+        }
+        m_Program->Name = m_Name;
+        m_Program->Filepath = filepath;
+
+        // Lecture et découpage ici, compilation sur le thread qui possède le contexte
+        RenderThread::Submit([program = m_Program, shaderSources = std::move(shaderSources)]() {
+            BeginCompile(*program, shaderSources);
+        });
     }
 
     OpenGLShader::~OpenGLShader() {
-        if (m_RendererID) {
-            glDeleteProgram(m_RendererID);
-        }
+        RenderThread::Submit([program = m_Program]() {
+            for (auto [type, shader] : program->Stages)
+                glDeleteShader(shader);
+            if (program->RendererID) {
+                OpenGLStateCache::ForgetProgram(program->RendererID);
+                glDeleteProgram(program->RendererID);
+            }
+        });
     }
 
     std::string OpenGLShader::ReadFile(const std::string& filepath) {
+        // Archive montée en priorité, sinon fichier sur le disque
+        AssetData file = AssetManager::Get().ReadAsset(filepath);
+        if (!file.IsValid()) {
+            Logger::Error("Could not open file '{0}'", filepath);
+            return {};
+        }
+        if (file.Size == 0)
+            Logger::Warn("Shader file is empty: {0}", filepath);
+        return file.ToString();
+    }
+
+    std::string OpenGLShader::ResolveIncludes(const std::string& source, const std::string& filepath,
+                                              std::vector<std::string>& included, uint32_t depth) {
+        const uint32_t maxDepth = 16;
+        const char* includeToken = "#include";
+        size_t directoryEnd = filepath.find_last_of("/\\");
+        std::string directory = directoryEnd == std::string::npos ? "" : filepath.substr(0, directoryEnd + 1);
+
         std::string result;
-        std::ifstream in(filepath, std::ios::in | std::ios::binary);
-        if (in) {
-            in.seekg(0, std::ios::end);
-            // Utiliser std::streamoff pour la taille et vérifier si > 0
-            std::streamoff size = in.tellg();
-            if (size > 0) {
-                result.resize(static_cast<size_t>(size)); // Caster en size_t pour resize
-                in.seekg(0, std::ios::beg);
-                in.read(&result[0], size);
-                // Pas besoin de in.close() explicitement avec RAII (ifstream)
+        result.reserve(source.size());
+        size_t lineStart = 0;
+        while (lineStart < source.size()) {
+            size_t lineEnd = source.find('\n', lineStart);
+            if (lineEnd == std::string::npos)
+                lineEnd = source.size();
+
+            size_t first = source.find_first_not_of(" \t", lineStart);
+            if (first < lineEnd && source.compare(first, strlen(includeToken), includeToken) == 0) {
+                size_t open = source.find('"', first);
+                size_t close = open < lineEnd ? source.find('"', open + 1) : std::string::npos;
+                if (close == std::string::npos || close > lineEnd) {
+                    Logger::Error("Malformed #include in shader '{}'", filepath);
+                } else {
+                    std::string path = directory + source.substr(open + 1, close - open - 1);
+                    // Chaque fichier n'est inclus qu'une fois (équivalent de #pragma once)
+                    if (std::find(included.begin(), included.end(), path) == included.end()) {
+                        included.push_back(path);
+                        if (depth >= maxDepth)
+                            Logger::Error("Shader #include depth exceeded in '{}'", filepath);
+                        else
+                            result += ResolveIncludes(ReadFile(path), path, included, depth + 1) + "\n";
+                    }
+                }
             } else {
-                 // Gérer le cas d'un fichier vide ou erreur de tellg autre que -1
-                 if (size == 0) {
-                     Logger::Warn("Shader file is empty: {0}", filepath);
-                 } else {
-                     Logger::Error("Could not determine size of file '{0}'", filepath);
-                 }
+                result.append(source, lineStart, lineEnd - lineStart);
+                result += '\n';
             }
-        } else {
-            Logger::Error("Could not open file '{0}'", filepath);
+            lineStart = lineEnd + 1;
         }
         return result;
     }
 
+    void OpenGLShader::InjectDefines(std::string& source, const std::vector<std::string>& defines) {
+        if (defines.empty())
+            return;
+
+        std::string block;
+        for (const std::string& define : defines)
+            block += "#define " + define + " 1\n";
+
+        // #version doit rester la première directive de l'étage
+        size_t version = source.find("#version");
+        size_t insert = version == std::string::npos ? 0 : source.find('\n', version);
+        insert = insert == std::string::npos ? source.size() : insert + 1;
+        source.insert(insert, block);
+    }
+
     std::unordered_map<GLenum, std::string> OpenGLShader::PreProcess(const std::string& source) {
         std::unordered_map<GLenum, std::string> shaderSources;
 
@@ -112,195 +184,292 @@ namespace Tesseract {
         return shaderSources;
     }
 
-    void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shaderSources) {
-        GLuint program = glCreateProgram();
-        std::vector<GLuint> shaderIDs;
-        shaderIDs.reserve(shaderSources.size());
+    void OpenGLShader::BeginCompile(ProgramState& program, const std::unordered_map<GLenum, std::string>& shaderSources) {
+        program.CompileStart = std::chrono::steady_clock::now();
+
+        // Binaire déjà lié par ce driver pour ces sources exactes
+        OpenGLShaderCache::StageSources stages;
+        for (auto const& [type, source] : shaderSources)
+            stages.emplace_back(type, &source);
+        program.CacheKey = OpenGLShaderCache::ComputeKey(std::move(stages));
+        if (GLuint cached = OpenGLShaderCache::Load(program.CacheKey)) {
+            program.RendererID = cached;
+            Reflect(program);
+            Logger::Info("Shader '{}' loaded from binary cache ({:.2f} ms)", program.Name,
+                         std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - program.CompileStart).count());
+            return;
+        }
+
+        // Le driver répartit alors les compilations sur ses propres threads
+        static const bool parallelCompile = [] {
+            if (!GLEW_KHR_parallel_shader_compile)
+                return false;
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+            return true;
+        }();
 
-        Logger::Trace("Compiling shaders from file: {}", m_FilePath);
+        Logger::Trace("Compiling shaders from file: {}", program.Filepath);
 
+        GLuint id = glCreateProgram();
         for (auto const& [type, source] : shaderSources) {
             GLuint shader = glCreateShader(type);
 
             const GLchar* sourceCStr = source.c_str();
             glShaderSource(shader, 1, &sourceCStr, 0);
 
-            // --- DEBUG: Afficher la source exacte passée à glShaderSource ---
-            Logger::Trace("--- Compiling {} Shader Source ---", Utils::GLShaderTypeToString(type));
-            // Afficher ligne par ligne pour une meilleure lisibilité
-            std::stringstream ss(source);
-            std::string line;
-            int lineNum = 1;
-            while (std::getline(ss, line, '\n')) {
-                 // Remplacer les caractères non imprimables potentiels pour l'affichage
-                 std::string clean_line = line;
-                 std::replace_if(clean_line.begin(), clean_line.end(), [](char c){ return !isprint(c) && c != '\t'; }, '?');
-                 Logger::Trace("{:3d}: {}", lineNum++, clean_line);
+            // Source exacte passée à glShaderSource (opt-in : une ligne de log par ligne de code)
+            if (Shader::IsSourceTracingEnabled()) {
+                Logger::Trace("--- Compiling {} Shader Source ---", Utils::GLShaderTypeToString(type));
+                std::stringstream ss(source);
+                std::string line;
+                int lineNum = 1;
+                while (std::getline(ss, line, '\n')) {
+                     // Remplacer les caractères non imprimables potentiels pour l'affichage
+                     std::string clean_line = line;
+                     std::replace_if(clean_line.begin(), clean_line.end(), [](char c){ return !isprint(c) && c != '\t'; }, '?');
+                     Logger::Trace("{:3d}: {}", lineNum++, clean_line);
+                }
+                Logger::Trace("--- End {} Shader Source ---", Utils::GLShaderTypeToString(type));
             }
-            Logger::Trace("--- End {} Shader Source ---", Utils::GLShaderTypeToString(type));
-            // --- FIN DEBUG ---
 
             glCompileShader(shader);
+            glAttachShader(id, shader);
+            program.Stages.emplace_back(type, shader);
+        }
+
+        // Lier le programme (en gardant le binaire récupérable pour le cache)
+        if (OpenGLShaderCache::IsAvailable())
+            glProgramParameteri(id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glLinkProgram(id);
+
+        program.RendererID = id;
+        program.Pending = true;
+        if (!parallelCompile)
+            FinishCompile(program);
+    }
 
+    void OpenGLShader::FinishCompile(ProgramState& program) {
+        program.Pending = false;
+        GLuint id = program.RendererID;
+
+        auto cleanup = [&program]() {
+            for (auto [type, shader] : program.Stages) {
+                glDetachShader(program.RendererID, shader);
+                glDeleteShader(shader);
+            }
+            program.Stages.clear();
+        };
+
+        for (auto [type, shader] : program.Stages) {
             GLint isCompiled = 0;
             glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
             if (isCompiled == GL_FALSE) {
                 GLint maxLength = 0;
                 glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
 
-                std::vector<GLchar> infoLog(maxLength);
+                std::vector<GLchar> infoLog(maxLength + 1);
                 glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
 
-                glDeleteShader(shader);
-
-                Logger::Error("{} shader compilation failure!", Utils::GLShaderTypeToString(type));
+                Logger::Error("{} shader compilation failure in '{}'!", Utils::GLShaderTypeToString(type), program.Name);
                 Logger::Error("{}", infoLog.data());
                 TS_ASSERT(false, "Shader compilation failed!");
-                // Nettoyer les shaders déjà compilés en cas d'erreur
-                for(GLuint id : shaderIDs) glDeleteShader(id);
-                glDeleteProgram(program); // Supprimer le programme aussi
+                // Nettoyer les shaders et le programme
+                cleanup();
+                glDeleteProgram(id);
+                program.RendererID = 0;
                 return;
             }
-            Logger::Trace("  {} shader compiled successfully.", Utils::GLShaderTypeToString(type));
-            glAttachShader(program, shader);
-            shaderIDs.push_back(shader);
         }
 
-        m_RendererID = program;
-
-        // Lier le programme
-        glLinkProgram(program);
-
         GLint isLinked = 0;
-        glGetProgramiv(program, GL_LINK_STATUS, (int*)&isLinked);
+        glGetProgramiv(id, GL_LINK_STATUS, (int*)&isLinked);
         if (isLinked == GL_FALSE) {
             GLint maxLength = 0;
-            glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+            glGetProgramiv(id, GL_INFO_LOG_LENGTH, &maxLength);
 
-            std::vector<GLchar> infoLog(maxLength);
-            glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
+            std::vector<GLchar> infoLog(maxLength + 1);
+            glGetProgramInfoLog(id, maxLength, &maxLength, &infoLog[0]);
 
-            glDeleteProgram(program);
+            cleanup();
+            glDeleteProgram(id);
+            program.RendererID = 0; // S'assurer que l'ID est nul en cas d'erreur
 
-            for (GLuint id : shaderIDs)
-                glDeleteShader(id);
-
-            Logger::Error("Shader link failure!");
+            Logger::Error("Shader link failure in '{}'!", program.Name);
             Logger::Error("{}", infoLog.data());
             TS_ASSERT(false, "Shader link failed!");
-            m_RendererID = 0; // S'assurer que l'ID est nul en cas d'erreur
             return;
         }
-        Logger::Trace("Shader program linked successfully.");
 
         // Détacher les shaders après le linkage réussi
-        for (GLuint id : shaderIDs) {
-            glDetachShader(program, id);
-            glDeleteShader(id); // On peut supprimer les shaders individuels maintenant
+        cleanup();
+
+        Reflect(program);
+        OpenGLShaderCache::Store(program.CacheKey, id);
+        Logger::Info("Shader '{}' compiled ({:.2f} ms)", program.Name,
+                     std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - program.CompileStart).count());
+    }
+
+    void OpenGLShader::Reflect(ProgramState& program) {
+        GLuint id = program.RendererID;
+        program.UniformLocationCache.clear();
+
+        // Uniforms hors blocs : emplacements résolus une fois pour toutes
+        GLint uniformCount = 0, maxNameLength = 0;
+        glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+        glGetProgramiv(id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+        std::vector<GLchar> name(std::max(maxNameLength, 1));
+        for (GLint i = 0; i < uniformCount; ++i) {
+            GLint size = 0;
+            GLenum type = 0;
+            GLsizei length = 0;
+            glGetActiveUniform(id, (GLuint)i, (GLsizei)name.size(), &length, &size, &type, name.data());
+            std::string uniformName(name.data(), (size_t)length);
+            GLint location = glGetUniformLocation(id, uniformName.c_str());
+            if (location == -1)
+                continue; // Membre d'un bloc d'uniforms
+
+            program.UniformLocationCache[uniformName] = location;
+            // Tableau "u_Textures[0]" : aussi accessible par "u_Textures"
+            size_t bracket = uniformName.find('[');
+            if (bracket != std::string::npos)
+                program.UniformLocationCache[uniformName.substr(0, bracket)] = location;
         }
+
+        // Blocs partagés : rattachés à leur point de liaison fixe
+        GLint blockCount = 0;
+        glGetProgramiv(id, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+        for (GLint i = 0; i < blockCount; ++i) {
+            GLchar blockName[64];
+            glGetActiveUniformBlockName(id, (GLuint)i, sizeof(blockName), nullptr, blockName);
+            int32_t binding = RendererUniforms::GetBlockBinding(blockName);
+            if (binding < 0) {
+                Logger::Warn("Uniform block '{}' in shader '{}' has no fixed binding", blockName, program.Name);
+                continue;
+            }
+            glUniformBlockBinding(id, (GLuint)i, (GLuint)binding);
+        }
+
+        Logger::Trace("Shader '{}': {} uniforms, {} uniform blocks", program.Name,
+                      program.UniformLocationCache.size(), blockCount);
+    }
+
+    GLuint OpenGLShader::Resolve(ProgramState& program) {
+        if (program.Pending)
+            FinishCompile(program);
+        return program.RendererID;
     }
 
     void OpenGLShader::Bind() const {
-        glUseProgram(m_RendererID);
+        RenderThread::Submit([program = m_Program]() {
+            OpenGLStateCache::UseProgram(Resolve(*program));
+        });
     }
 
     void OpenGLShader::Unbind() const {
-        glUseProgram(0);
+        RenderThread::Submit([]() {
+            OpenGLStateCache::UseProgram(0);
+        });
     }
 
-    GLint OpenGLShader::GetUniformLocation(const std::string& name) {
-        // Vérifier d'abord dans le cache
-        if (m_UniformLocationCache.find(name) != m_UniformLocationCache.end()) {
-            return m_UniformLocationCache[name];
-        }
-
-        // S'assurer que le shader est bien lié avant de chercher l'uniform
-        GLint currentProgram;
-        glGetIntegerv(GL_CURRENT_PROGRAM, &currentProgram);
-        if (currentProgram != m_RendererID) {
-            Logger::Warn("Shader not bound when getting uniform location for '{}'!", name);
-            Bind();
-        }
+    GLint OpenGLShader::GetUniformLocation(ProgramState& program, const std::string& name) {
+        if (Resolve(program) == 0)
+            return -1;
 
-        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-        if (location == -1) {
-            Logger::Warn("Uniform '{}' not found in shader '{}' (ID: {})!", name, m_Name, m_RendererID);
-            // Vérifier si le shader est bien compilé et lié
-            GLint status;
-            glGetProgramiv(m_RendererID, GL_LINK_STATUS, &status);
-            if (status == GL_FALSE) {
-                Logger::Error("Shader program not properly linked!");
-            }
-        } else {
-            Logger::Trace("Found uniform '{}' at location {} in shader '{}'", name, location, m_Name);
-        }
+        // Table remplie par Reflect() au link : pas d'aller-retour avec le driver
+        auto it = program.UniformLocationCache.find(name);
+        if (it != program.UniformLocationCache.end())
+            return it->second;
 
-        // Mettre en cache même les locations invalides pour éviter des recherches répétées
-        m_UniformLocationCache[name] = location;
-        return location;
+        // Uniform absent ou éliminé par le compilateur : prévenir une seule fois
+        Logger::Warn("Uniform '{}' not found in shader '{}' (ID: {})!", name, program.Name, program.RendererID);
+        program.UniformLocationCache[name] = -1;
+        return -1;
     }
 
+    // Les Set* capturent le nom et la valeur : la commande est exécutée plus tard
+    // par le thread de rendu. glProgramUniform* n'exige pas que le programme soit lié.
+
     void OpenGLShader::SetInt(const std::string& name, int value) {
-        GLint location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniform1i(location, value);
-        }
+        RenderThread::Submit([program = m_Program, name, value]() {
+            GLint location = GetUniformLocation(*program, name);
+            if (location != -1) {
+                glProgramUniform1i(program->RendererID, location, value);
+            }
+        });
+    }
+
+    void OpenGLShader::SetIntArray(const std::string& name, const int* values, uint32_t count) {
+        RenderThread::Submit([program = m_Program, name, array = std::vector<int>(values, values + count)]() {
+            GLint location = GetUniformLocation(*program, name);
+            if (location != -1) {
+                glProgramUniform1iv(program->RendererID, location, (GLsizei)array.size(), array.data());
+            }
+        });
     }
 
     void OpenGLShader::SetFloat(const std::string& name, float value) {
-        GLint location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniform1f(location, value);
-        }
+        RenderThread::Submit([program = m_Program, name, value]() {
+            GLint location = GetUniformLocation(*program, name);
+            if (location != -1) {
+                glProgramUniform1f(program->RendererID, location, value);
+            }
+        });
     }
 
     void OpenGLShader::SetFloat2(const std::string& name, const glm::vec2& value) {
-        GLint location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniform2f(location, value.x, value.y);
-        }
+        RenderThread::Submit([program = m_Program, name, value]() {
+            GLint location = GetUniformLocation(*program, name);
+            if (location != -1) {
+                glProgramUniform2f(program->RendererID, location, value.x, value.y);
+            }
+        });
     }
 
     void OpenGLShader::SetFloat3(const std::string& name, const glm::vec3& value) {
-        GLint location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniform3f(location, value.x, value.y, value.z);
-        }
+        RenderThread::Submit([program = m_Program, name, value]() {
+            GLint location = GetUniformLocation(*program, name);
+            if (location != -1) {
+                glProgramUniform3f(program->RendererID, location, value.x, value.y, value.z);
+            }
+        });
     }
 
     void OpenGLShader::SetFloat4(const std::string& name, const glm::vec4& value) {
-        GLint location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniform4f(location, value.x, value.y, value.z, value.w);
-        }
+        RenderThread::Submit([program = m_Program, name, value]() {
+            GLint location = GetUniformLocation(*program, name);
+            if (location != -1) {
+                glProgramUniform4f(program->RendererID, location, value.x, value.y, value.z, value.w);
+            }
+        });
     }
 
     void OpenGLShader::SetMat3(const std::string& name, const glm::mat3& matrix) {
-        GLint location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
-        }
+        RenderThread::Submit([program = m_Program, name, matrix]() {
+            GLint location = GetUniformLocation(*program, name);
+            if (location != -1) {
+                glProgramUniformMatrix3fv(program->RendererID, location, 1, GL_FALSE, glm::value_ptr(matrix));
+            }
+        });
     }
 
     void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& matrix) {
-        GLint location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
-        }
+        RenderThread::Submit([program = m_Program, name, matrix]() {
+            GLint location = GetUniformLocation(*program, name);
+            if (location != -1) {
+                glProgramUniformMatrix4fv(program->RendererID, location, 1, GL_FALSE, glm::value_ptr(matrix));
+            }
+        });
     }
 
     void OpenGLShader::SetViewProjection(const glm::mat4& matrix) {
         Bind(); // S'assurer que le shader est lié
         SetMat4("u_ViewProjection", matrix);
 
-        // Log pour le debug
-        if (Logger::GetLevel() <= Logger::Level::Trace) {
-            Logger::Trace("Setting ViewProjection matrix for shader '{}' (ID: {})", m_Name, m_RendererID);
-            Logger::Trace("Matrix values:");
-            for (int i = 0; i < 4; i++) {
-                Logger::Trace("[{:.3f} {:.3f} {:.3f} {:.3f}]",
-                    matrix[i][0], matrix[i][1], matrix[i][2], matrix[i][3]);
-            }
+        // Log pour le debug (journal binaire : appelé à chaque frame)
+        TS_BLOG_TRACE("Setting ViewProjection matrix for shader '{}'", m_Name);
+        for (int i = 0; i < 4; i++) {
+            TS_BLOG_TRACE("[{:.3f} {:.3f} {:.3f} {:.3f}]",
+                matrix[i][0], matrix[i][1], matrix[i][2], matrix[i][3]);
         }
     }
 } // namespace Tesseract
@@ -0,0 +1,194 @@
+#include "core/Renderer/OpenGLShaderCache.hpp"
+#include "core/Renderer/Shader.hpp"
+#include "core/Logger.hpp"
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+
+namespace Tesseract {
+
+    namespace {
+
+        constexpr uint32_t CacheMagic = 0x42505354; // "TSPB"
+        constexpr uint32_t CacheVersion = 1;
+
+        struct CacheHeader {
+            uint32_t Magic;
+            uint32_t Version;
+            uint64_t Key;
+            uint32_t Format; // GLenum renvoyé par glGetProgramBinary
+            uint32_t Size;
+        };
+
+        struct CacheData {
+            bool Initialized = false;
+            bool Available = false;
+            uint64_t DriverHash = 0;
+            OpenGLShaderCache::Statistics Stats;
+            std::mutex StatsMutex; // Statistiques lues par le thread principal
+        };
+
+        CacheData s_Data;
+
+        uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+            // FNV-1a 64 bits
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; ++i) {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        uint64_t HashString(uint64_t hash, const char* string) {
+            // Séparateur pour que ("ab", "c") et ("a", "bc") diffèrent
+            return HashBytes(hash, string, std::strlen(string) + 1);
+        }
+
+        void InitCache() {
+            if (s_Data.Initialized)
+                return;
+            s_Data.Initialized = true;
+
+            GLint formats = 0;
+            if (GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary)
+                glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+            s_Data.Available = formats > 0;
+
+            uint64_t hash = 14695981039346656037ull;
+            hash = HashBytes(hash, &CacheVersion, sizeof(CacheVersion));
+            for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+                const GLubyte* value = glGetString(name);
+                hash = HashString(hash, value ? reinterpret_cast<const char*>(value) : "");
+            }
+            s_Data.DriverHash = hash;
+
+            if (!s_Data.Available)
+                Logger::Info("OpenGLShaderCache: binaires de programmes non supportés, cache désactivé");
+        }
+
+        std::filesystem::path GetEntryPath(uint64_t key) {
+            char name[32];
+            std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+            return std::filesystem::path(Shader::GetBinaryCacheDirectory()) / name;
+        }
+
+        void CountStat(uint32_t OpenGLShaderCache::Statistics::*counter) {
+            std::lock_guard<std::mutex> lock(s_Data.StatsMutex);
+            s_Data.Stats.*counter += 1;
+        }
+
+    } // namespace
+
+    bool OpenGLShaderCache::IsAvailable() {
+        InitCache();
+        return s_Data.Available && !Shader::GetBinaryCacheDirectory().empty();
+    }
+
+    uint64_t OpenGLShaderCache::ComputeKey(StageSources stages) {
+        InitCache();
+        std::sort(stages.begin(), stages.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        uint64_t hash = s_Data.DriverHash;
+        for (const auto& [type, source] : stages) {
+            hash = HashBytes(hash, &type, sizeof(type));
+            hash = HashString(hash, source->c_str());
+        }
+        return hash;
+    }
+
+    uint32_t OpenGLShaderCache::Load(uint64_t key) {
+        if (!IsAvailable())
+            return 0;
+
+        std::filesystem::path path = GetEntryPath(key);
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream) {
+            CountStat(&Statistics::Misses);
+            return 0;
+        }
+        std::vector<char> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        stream.close();
+
+        CacheHeader header;
+        if (file.size() < sizeof(header)) {
+            CountStat(&Statistics::Misses);
+            return 0;
+        }
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (header.Magic != CacheMagic || header.Version != CacheVersion || header.Key != key
+            || file.size() - sizeof(header) != header.Size) {
+            CountStat(&Statistics::Misses);
+            return 0;
+        }
+
+        GLuint program = glCreateProgram();
+        glProgramBinary(program, header.Format, file.data() + sizeof(header), (GLsizei)header.Size);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (linked == GL_FALSE) {
+            // Driver différent malgré la clé (ou binaire corrompu) : recompiler
+            glDeleteProgram(program);
+            std::error_code error;
+            std::filesystem::remove(path, error);
+            CountStat(&Statistics::Rejected);
+            CountStat(&Statistics::Misses);
+            return 0;
+        }
+
+        CountStat(&Statistics::Hits);
+        return program;
+    }
+
+    void OpenGLShaderCache::Store(uint64_t key, uint32_t program) {
+        if (!IsAvailable() || !program)
+            return;
+
+        GLint size = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+        if (size <= 0)
+            return;
+
+        std::vector<char> file(sizeof(CacheHeader) + (size_t)size);
+        GLenum format = 0;
+        GLsizei written = 0;
+        glGetProgramBinary(program, size, &written, &format, file.data() + sizeof(CacheHeader));
+        if (written <= 0)
+            return;
+        file.resize(sizeof(CacheHeader) + (size_t)written);
+
+        CacheHeader header = { CacheMagic, CacheVersion, key, format, (uint32_t)written };
+        std::memcpy(file.data(), &header, sizeof(header));
+
+        // Écriture dans un fichier temporaire puis renommage : jamais d'entrée tronquée
+        std::error_code error;
+        std::filesystem::path path = GetEntryPath(key);
+        std::filesystem::create_directories(path.parent_path(), error);
+        std::filesystem::path temporary = path;
+        temporary += ".tmp";
+        {
+            std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+            if (!stream || !stream.write(file.data(), (std::streamsize)file.size())) {
+                Logger::Warn("OpenGLShaderCache: impossible d'écrire '{}'", temporary.string());
+                return;
+            }
+        }
+        std::filesystem::rename(temporary, path, error);
+        if (error)
+            Logger::Warn("OpenGLShaderCache: impossible d'écrire '{}': {}", path.string(), error.message());
+    }
+
+    OpenGLShaderCache::Statistics OpenGLShaderCache::GetStats() {
+        std::lock_guard<std::mutex> lock(s_Data.StatsMutex);
+        return s_Data.Stats;
+    }
+
+} // namespace Tesseract
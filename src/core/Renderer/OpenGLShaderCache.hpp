@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Tesseract {
+
+    /**
+     * @class OpenGLShaderCache
+     * @brief Cache disque des programmes liés (glGetProgramBinary / glProgramBinary)
+     *
+     * La clé est un hash des sources finales de chaque étage (#define injectés
+     * compris) et de l'identité du driver (GL_VENDOR, GL_RENDERER, GL_VERSION) :
+     * une mise à jour du driver ou une modification du shader invalide l'entrée.
+     * Un binaire refusé par le driver est supprimé et le programme recompilé.
+     *
+     * Toutes les fonctions s'exécutent sur le thread propriétaire du contexte GL.
+     * Sans GL 4.1 / ARB_get_program_binary (ou sans format binaire proposé par le
+     * driver), le cache est inactif et les shaders sont toujours compilés.
+     */
+    class OpenGLShaderCache {
+    public:
+        struct Statistics {
+            uint32_t Hits = 0;     // Programmes relus depuis le disque
+            uint32_t Misses = 0;   // Programmes compilés (absents ou refusés)
+            uint32_t Rejected = 0; // Binaires refusés par le driver
+        };
+
+        // Étage de shader (type GL, source finale), dans un ordre quelconque
+        using StageSources = std::vector<std::pair<uint32_t, const std::string*>>;
+
+        static bool IsAvailable();
+        static uint64_t ComputeKey(StageSources stages);
+
+        /**
+         * @brief Crée un programme depuis le binaire en cache
+         * @return 0 si l'entrée est absente, invalide ou refusée par le driver
+         */
+        static uint32_t Load(uint64_t key);
+
+        /**
+         * @brief Enregistre le binaire d'un programme lié avec
+         *        GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+         */
+        static void Store(uint64_t key, uint32_t program);
+
+        static Statistics GetStats();
+    };
+
+} // namespace Tesseract
@@ -0,0 +1,188 @@
+#include "core/Renderer/OpenGLStateCache.hpp"
+
+#include <GL/glew.h>
+#include <atomic>
+
+namespace Tesseract {
+
+    namespace {
+
+        // Valeur impossible pour un nom GL : état inconnu, le prochain appel passe toujours
+        constexpr uint32_t Unknown = 0xFFFFFFFF;
+
+        enum BufferTarget : uint32_t {
+            ArrayBuffer = 0,
+            ElementArrayBuffer,
+            PixelUnpackBuffer,
+            BufferTargetCount
+        };
+
+        enum Capability : uint32_t {
+            Blend = 0,
+            DepthTest,
+            CullFace,
+            ScissorTest,
+            CapabilityCount
+        };
+
+        struct StateCacheData {
+            uint32_t Program = Unknown;
+            uint32_t VertexArray = Unknown;
+            uint32_t Buffers[BufferTargetCount];
+            uint32_t Textures[OpenGLStateCache::MaxTextureUnits];
+            uint32_t Capabilities[CapabilityCount]; // 0, 1 ou Unknown
+            uint32_t BlendSource = Unknown;
+            uint32_t BlendDestination = Unknown;
+
+            std::atomic<uint64_t> IssuedCalls{ 0 };
+            std::atomic<uint64_t> SkippedCalls{ 0 };
+
+            StateCacheData() { Reset(); }
+
+            void Reset() {
+                Program = Unknown;
+                VertexArray = Unknown;
+                for (uint32_t& buffer : Buffers)
+                    buffer = Unknown;
+                for (uint32_t& texture : Textures)
+                    texture = Unknown;
+                for (uint32_t& capability : Capabilities)
+                    capability = Unknown;
+                BlendSource = Unknown;
+                BlendDestination = Unknown;
+            }
+        };
+
+        StateCacheData s_State;
+
+        // Vrai si l'appel doit atteindre le driver ; met à jour la copie et les compteurs
+        bool Change(uint32_t& current, uint32_t value) {
+            // Seul le thread de rendu écrit : relaxed suffit pour des compteurs
+            if (current == value) {
+                s_State.SkippedCalls.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            current = value;
+            s_State.IssuedCalls.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        uint32_t GetBufferSlot(uint32_t target) {
+            switch (target) {
+                case GL_ARRAY_BUFFER:         return ArrayBuffer;
+                case GL_ELEMENT_ARRAY_BUFFER: return ElementArrayBuffer;
+                case GL_PIXEL_UNPACK_BUFFER:  return PixelUnpackBuffer;
+            }
+            return BufferTargetCount;
+        }
+
+        uint32_t GetCapabilitySlot(uint32_t capability) {
+            switch (capability) {
+                case GL_BLEND:        return Blend;
+                case GL_DEPTH_TEST:   return DepthTest;
+                case GL_CULL_FACE:    return CullFace;
+                case GL_SCISSOR_TEST: return ScissorTest;
+            }
+            return CapabilityCount;
+        }
+
+    } // namespace
+
+    void OpenGLStateCache::UseProgram(uint32_t program) {
+        if (Change(s_State.Program, program))
+            glUseProgram(program);
+    }
+
+    void OpenGLStateCache::BindVertexArray(uint32_t vertexArray) {
+        if (Change(s_State.VertexArray, vertexArray)) {
+            glBindVertexArray(vertexArray);
+            // L'IBO lié fait partie de l'état du VAO
+            s_State.Buffers[ElementArrayBuffer] = Unknown;
+        }
+    }
+
+    void OpenGLStateCache::BindBuffer(uint32_t target, uint32_t buffer) {
+        uint32_t slot = GetBufferSlot(target);
+        if (slot == BufferTargetCount) {
+            // Cible non suivie : toujours transmise
+            s_State.IssuedCalls.fetch_add(1, std::memory_order_relaxed);
+            glBindBuffer(target, buffer);
+            return;
+        }
+        if (Change(s_State.Buffers[slot], buffer))
+            glBindBuffer(target, buffer);
+    }
+
+    void OpenGLStateCache::BindTextureUnit(uint32_t unit, uint32_t texture) {
+        if (unit >= MaxTextureUnits) {
+            s_State.IssuedCalls.fetch_add(1, std::memory_order_relaxed);
+            glBindTextureUnit(unit, texture);
+            return;
+        }
+        if (Change(s_State.Textures[unit], texture))
+            glBindTextureUnit(unit, texture);
+    }
+
+    void OpenGLStateCache::SetEnabled(uint32_t capability, bool enabled) {
+        uint32_t slot = GetCapabilitySlot(capability);
+        if (slot != CapabilityCount && !Change(s_State.Capabilities[slot], enabled ? 1u : 0u))
+            return;
+        if (slot == CapabilityCount)
+            s_State.IssuedCalls.fetch_add(1, std::memory_order_relaxed);
+
+        if (enabled)
+            glEnable(capability);
+        else
+            glDisable(capability);
+    }
+
+    void OpenGLStateCache::BlendFunc(uint32_t source, uint32_t destination) {
+        if (s_State.BlendSource == source && s_State.BlendDestination == destination) {
+            s_State.SkippedCalls.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        s_State.BlendSource = source;
+        s_State.BlendDestination = destination;
+        s_State.IssuedCalls.fetch_add(1, std::memory_order_relaxed);
+        glBlendFunc(source, destination);
+    }
+
+    void OpenGLStateCache::ForgetProgram(uint32_t program) {
+        // glDeleteProgram ne délie pas le programme courant : seul un nom réutilisé pose problème
+        if (s_State.Program == program)
+            s_State.Program = Unknown;
+    }
+
+    void OpenGLStateCache::ForgetVertexArray(uint32_t vertexArray) {
+        if (s_State.VertexArray == vertexArray) {
+            s_State.VertexArray = Unknown;
+            s_State.Buffers[ElementArrayBuffer] = Unknown;
+        }
+    }
+
+    void OpenGLStateCache::ForgetBuffer(uint32_t buffer) {
+        for (uint32_t& bound : s_State.Buffers) {
+            if (bound == buffer)
+                bound = Unknown;
+        }
+    }
+
+    void OpenGLStateCache::ForgetTexture(uint32_t texture) {
+        for (uint32_t& bound : s_State.Textures) {
+            if (bound == texture)
+                bound = Unknown;
+        }
+    }
+
+    void OpenGLStateCache::Invalidate() {
+        s_State.Reset();
+    }
+
+    OpenGLStateCache::Statistics OpenGLStateCache::GetStats() {
+        Statistics stats;
+        stats.IssuedCalls = s_State.IssuedCalls.load(std::memory_order_relaxed);
+        stats.SkippedCalls = s_State.SkippedCalls.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace Tesseract
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Tesseract {
+
+    /**
+     * @class OpenGLStateCache
+     * @brief Copie de l'état GL lié, pour ne pas répéter les changements d'état
+     *
+     * Les classes OpenGL* passent par ici au lieu d'appeler glUseProgram,
+     * glBindVertexArray, glBindBuffer, glBindTextureUnit, glEnable/glDisable et
+     * glBlendFunc directement : un appel qui ne change rien n'atteint pas le
+     * driver. Les appels évités sont comptés.
+     *
+     * Thread de rendu uniquement (comme tout appel GL), sauf GetStats().
+     * Un objet GL supprimé doit être oublié (Forget*) : son nom peut être
+     * réutilisé par le driver. Invalidate() est à appeler quand du code
+     * extérieur (ImGui) a pu modifier l'état.
+     */
+    class OpenGLStateCache {
+    public:
+        static constexpr uint32_t MaxTextureUnits = 32;
+
+        struct Statistics {
+            uint64_t IssuedCalls = 0;  // Changements d'état transmis au driver
+            uint64_t SkippedCalls = 0; // Changements redondants évités
+        };
+
+        static void UseProgram(uint32_t program);
+        static void BindVertexArray(uint32_t vertexArray);
+        // GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER (état du VAO lié), GL_PIXEL_UNPACK_BUFFER ;
+        // les autres cibles sont transmises sans filtrage (glBindBufferBase les modifie aussi)
+        static void BindBuffer(uint32_t target, uint32_t buffer);
+        static void BindTextureUnit(uint32_t unit, uint32_t texture);
+        static void SetEnabled(uint32_t capability, bool enabled);
+        static void BlendFunc(uint32_t source, uint32_t destination);
+
+        static void ForgetProgram(uint32_t program);
+        static void ForgetVertexArray(uint32_t vertexArray);
+        static void ForgetBuffer(uint32_t buffer);
+        static void ForgetTexture(uint32_t texture);
+
+        // Oublie tout l'état connu : le prochain appel de chaque type atteindra le driver
+        static void Invalidate();
+
+        // Cumul depuis le démarrage, lisible depuis n'importe quel thread
+        static Statistics GetStats();
+    };
+
+} // namespace Tesseract
@@ -1,11 +1,16 @@
 #include "core/Renderer/OpenGLTexture.hpp"
+#include "core/Renderer/NullTexture.hpp"
 #include "core/Logger.hpp"
 #include "core/Core.hpp"
 #include "core/Renderer/RendererAPI.hpp"
+#include "core/Renderer/RenderThread.hpp"
+#include "core/Renderer/OpenGLPixelUnpackRing.hpp"
+#include "core/Renderer/OpenGLStateCache.hpp"
 
-// #define STB_IMAGE_IMPLEMENTATION // Supprimé car défini via g++ -D
-#include <stb_image.h>
+#include "core/Asset/Image.hpp" // Décodage (stb_image)
 #include <GL/glew.h>
+#include <algorithm>
+#include <chrono>
 
 namespace Tesseract {
 
@@ -15,16 +20,28 @@ namespace Tesseract {
         switch (RendererAPI::GetAPI()) {
             case RendererAPI::API::None:    TS_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
             case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(width, height);
+            case RendererAPI::API::Null:    return CreateRef<NullTexture2D>(width, height);
             // Ajouter d'autres APIs ici (Vulkan, DirectX...)
         }
         TS_ASSERT(false, "Unknown RendererAPI!");
         return nullptr;
     }
 
+    Ref<Texture2D> Texture2D::CreatePending(const std::string& path) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    TS_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(path, true);
+            case RendererAPI::API::Null:    return CreateRef<NullTexture2D>(path, true);
+        }
+        TS_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
     Ref<Texture2D> Texture2D::Create(const std::string& path) {
         switch (RendererAPI::GetAPI()) {
             case RendererAPI::API::None:    TS_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
             case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(path);
+            case RendererAPI::API::Null:    return CreateRef<NullTexture2D>(path);
             // Ajouter d'autres APIs ici
         }
         TS_ASSERT(false, "Unknown RendererAPI!");
@@ -33,81 +50,184 @@ namespace Tesseract {
 
     // --- Implémentation OpenGLTexture2D ---
 
-    OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height)
-        : m_Width(width), m_Height(height) {
-
-        m_InternalFormat = GL_RGBA8;
-        m_DataFormat = GL_RGBA;
+    // Création et paramètres par défaut d'une texture (thread de rendu)
+    static uint32_t CreateTextureStorage(GLenum internalFormat, uint32_t width, uint32_t height, uint32_t levels = 1) {
+        uint32_t rendererID = 0;
+        glCreateTextures(GL_TEXTURE_2D, 1, &rendererID);
+        glTextureStorage2D(rendererID, (GLsizei)levels, internalFormat, width, height);
+
+        // Avec une chaîne de mips, la minification lit un niveau adapté (moins de bande passante)
+        glTextureParameteri(rendererID, GL_TEXTURE_MIN_FILTER, levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTextureParameteri(rendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(rendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(rendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTextureParameteri(rendererID, GL_TEXTURE_MAX_LEVEL, (GLint)levels - 1);
+        return rendererID;
+    }
 
-        glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-        glTextureStorage2D(m_RendererID, 1, m_InternalFormat, m_Width, m_Height);
+    // Libère le nom GL courant (thread de rendu, seul à écrire l'ID : lecture relaxed)
+    static void DeleteTexture(const std::atomic<uint32_t>& rendererID) {
+        uint32_t id = rendererID.load(std::memory_order_relaxed);
+        if (id) {
+            OpenGLStateCache::ForgetTexture(id);
+            glDeleteTextures(1, &id);
+        }
+    }
 
-        // Paramètres par défaut
-        glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    // Envoi de pixels via le ring de PBO (thread de rendu)
+    static void UploadPixels(uint32_t rendererID, GLenum dataFormat, uint32_t width, uint32_t height, const void* pixels, size_t size) {
+        const void* source = OpenGLPixelUnpackRing::BeginUpload(pixels, size);
+        glTextureSubImage2D(rendererID, 0, 0, 0, width, height, dataFormat, GL_UNSIGNED_BYTE, source);
+        OpenGLPixelUnpackRing::EndUpload();
     }
 
+    // Nombre de niveaux d'une chaîne de mips complète (jusqu'à 1x1)
+    static uint32_t ComputeMipLevelCount(uint32_t width, uint32_t height) {
+        uint32_t levels = 1;
+        for (uint32_t size = std::max(width, height); size > 1; size /= 2)
+            levels++;
+        return levels;
+    }
 
-    OpenGLTexture2D::OpenGLTexture2D(const std::string& path)
-        : m_Path(path) {
+    // Taille d'une chaîne de mips non compressée
+    static size_t ComputeMemorySize(uint32_t width, uint32_t height, uint32_t levels, uint32_t bytesPerPixel) {
+        size_t size = 0;
+        for (uint32_t level = 0; level < levels; ++level) {
+            size += (size_t)width * height * bytesPerPixel;
+            width = std::max(1u, width / 2);
+            height = std::max(1u, height / 2);
+        }
+        return size;
+    }
 
-        int width, height, channels;
-        stbi_set_flip_vertically_on_load(1);
-        stbi_uc* data = nullptr;
-        {
-            // TODO: Mesurer le temps de chargement ?
-            data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+    // Format GL d'une image compressée, 0 si le contexte ne le supporte pas
+    static GLenum GetCompressedInternalFormat(ImageFormat format) {
+        switch (format) {
+            case ImageFormat::BC1: return GLEW_EXT_texture_compression_s3tc ? GL_COMPRESSED_RGBA_S3TC_DXT1_EXT : 0;
+            case ImageFormat::BC3: return GLEW_EXT_texture_compression_s3tc ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : 0;
+            case ImageFormat::BC7: return GLEW_ARB_texture_compression_bptc ? GL_COMPRESSED_RGBA_BPTC_UNORM : 0;
+            case ImageFormat::Raw: break;
         }
+        return 0;
+    }
 
-        if (data) {
-            m_Width = width;
-            m_Height = height;
-
-            GLenum internalFormat = 0, dataFormat = 0;
-            if (channels == 4) {
-                internalFormat = GL_RGBA8;
-                dataFormat = GL_RGBA;
-            } else if (channels == 3) {
-                internalFormat = GL_RGB8;
-                dataFormat = GL_RGB;
-            }
-            // TODO: Gérer d'autres nombres de canaux si nécessaire (ex: grayscale)
+    OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height)
+        : m_Width(width), m_Height(height), m_RendererID(CreateRef<std::atomic<uint32_t>>(0u)) {
 
-            m_InternalFormat = internalFormat;
-            m_DataFormat = dataFormat;
+        m_InternalFormat = GL_RGBA8;
+        m_DataFormat = GL_RGBA;
+        m_MemorySize = ComputeMemorySize(width, height, 1, 4);
+        m_Loaded = true;
 
-            TS_ASSERT(internalFormat & dataFormat, "Image format not supported! Path: {}, Channels: {}", path, channels);
+        RenderThread::Submit([rendererID = m_RendererID, internalFormat = m_InternalFormat, width, height]() {
+            rendererID->store(CreateTextureStorage(internalFormat, width, height), std::memory_order_release);
+        });
+    }
 
-            if(internalFormat & dataFormat) {
-                 glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-                 glTextureStorage2D(m_RendererID, 1, internalFormat, m_Width, m_Height);
 
-                 glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-                 glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-                 glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-                 glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    OpenGLTexture2D::OpenGLTexture2D(const std::string& path, bool deferLoad)
+        : m_Path(path), m_RendererID(CreateRef<std::atomic<uint32_t>>(0u)) {
 
-                 glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, dataFormat, GL_UNSIGNED_BYTE, data);
-            } else {
-                 m_RendererID = 0; // Marquer comme invalide si format non supporté
-                 m_Width = 0;
-                 m_Height = 0;
-            }
+        if (deferLoad)
+            return;
+
+        // Le décodage reste sur le thread appelant, seul l'envoi au GPU est différé
+        // (voir AssetManager::LoadTextureAsync pour un décodage en arrière-plan)
+        auto start = std::chrono::steady_clock::now();
+        Image image = Image::Load(path);
+        float decodeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
 
-            stbi_image_free(data);
-        } else {
+        if (!image.IsValid()) {
             TS_ERROR("Failed to load image! Path: {}", path);
-            m_Width = 0; m_Height = 0; m_RendererID = 0;
+            return;
+        }
+        Logger::Debug("Texture '{}' decoded in {:.2f} ms ({}x{})", path, decodeMs, image.Width, image.Height);
+        SetImage(std::move(image));
+    }
+
+    void OpenGLTexture2D::SetImage(Image&& image) {
+        if (image.IsCompressed()) {
+            SetCompressedImage(std::move(image));
+            return;
+        }
+
+        GLenum internalFormat = 0, dataFormat = 0;
+        if (image.Channels == 4) {
+            internalFormat = GL_RGBA8;
+            dataFormat = GL_RGBA;
+        } else if (image.Channels == 3) {
+            internalFormat = GL_RGB8;
+            dataFormat = GL_RGB;
         }
+        // TODO: Gérer d'autres nombres de canaux si nécessaire (ex: grayscale)
+
+        TS_ASSERT(internalFormat & dataFormat, "Image format not supported! Path: {}, Channels: {}", m_Path, image.Channels);
+        if (!(internalFormat & dataFormat))
+            return;
+
+        m_Width = image.Width;
+        m_Height = image.Height;
+        m_InternalFormat = internalFormat;
+        m_DataFormat = dataFormat;
+        m_MipLevels = ComputeMipLevelCount(m_Width, m_Height);
+        m_MemorySize = ComputeMemorySize(m_Width, m_Height, m_MipLevels, image.Channels);
+        m_Loaded = true;
+
+        // Le stockage GL est immuable : un nouveau nom remplace l'ancien dans le handle
+        // partagé, que les commandes suivantes (Bind...) liront
+        RenderThread::Submit([rendererID = m_RendererID, internalFormat, dataFormat, width = m_Width, height = m_Height,
+                              levels = m_MipLevels, pixels = std::move(image.Pixels)]() {
+            DeleteTexture(*rendererID);
+            uint32_t id = CreateTextureStorage(internalFormat, width, height, levels);
+            UploadPixels(id, dataFormat, width, height, pixels.data(), pixels.size());
+            if (levels > 1)
+                glGenerateTextureMipmap(id);
+            rendererID->store(id, std::memory_order_release);
+        });
+    }
+
+    void OpenGLTexture2D::SetCompressedImage(Image&& image) {
+        GLenum internalFormat = GetCompressedInternalFormat(image.Format);
+        if (!internalFormat) {
+            Logger::Error("Compressed texture format not supported by this GPU: {}", m_Path);
+            return;
+        }
+
+        m_Width = image.Width;
+        m_Height = image.Height;
+        m_InternalFormat = internalFormat;
+        m_DataFormat = 0;
+        m_MipLevels = (uint32_t)image.Levels.size();
+        m_MemorySize = image.GetSize();
+        m_Loaded = true;
+
+        // Chaîne de mips pré-calculée : un seul passage par le ring pour tous les niveaux
+        RenderThread::Submit([rendererID = m_RendererID, internalFormat, width = m_Width, height = m_Height,
+                              levels = std::move(image.Levels), pixels = std::move(image.Pixels)]() {
+            DeleteTexture(*rendererID);
+            uint32_t id = CreateTextureStorage(internalFormat, width, height, (uint32_t)levels.size());
+
+            const uint8_t* source = static_cast<const uint8_t*>(OpenGLPixelUnpackRing::BeginUpload(pixels.data(), pixels.size()));
+            for (size_t level = 0; level < levels.size(); ++level) {
+                const ImageLevel& mip = levels[level];
+                glCompressedTextureSubImage2D(id, (GLint)level, 0, 0, mip.Width, mip.Height,
+                                              internalFormat, (GLsizei)mip.Size, source + mip.Offset);
+            }
+            OpenGLPixelUnpackRing::EndUpload();
+            rendererID->store(id, std::memory_order_release);
+        });
     }
 
     OpenGLTexture2D::~OpenGLTexture2D() {
-        glDeleteTextures(1, &m_RendererID);
+        RenderThread::Submit([rendererID = m_RendererID]() {
+            DeleteTexture(*rendererID);
+        });
     }
 
     void OpenGLTexture2D::SetData(void* data, uint32_t size) {
+        TS_ASSERT(m_DataFormat != 0, "SetData is not supported on compressed textures! Path: {}", m_Path);
+        if (m_DataFormat == 0) return;
+
         // Calcule la taille attendue en octets
         uint32_t bpp = (m_DataFormat == GL_RGBA || m_DataFormat == GL_RGBA8) ? 4 : 3;
         uint32_t expectedSize = m_Width * m_Height * bpp;
@@ -116,11 +236,16 @@ namespace Tesseract {
         TS_ASSERT(size == expectedSize, "Data size mismatch! Expected {} bytes, got {}. Texture: {}x{}", expectedSize, size, m_Width, m_Height);
         if(size != expectedSize) return;
 
-        glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+        const void* pixels = RenderThread::SubmitData(data, size);
+        RenderThread::Submit([rendererID = m_RendererID, dataFormat = m_DataFormat, width = m_Width, height = m_Height, pixels, size]() {
+            UploadPixels(rendererID->load(std::memory_order_relaxed), dataFormat, width, height, pixels, size);
+        });
     }
 
     void OpenGLTexture2D::Bind(uint32_t slot) const {
-        glBindTextureUnit(slot, m_RendererID);
+        RenderThread::Submit([rendererID = m_RendererID, slot]() {
+            OpenGLStateCache::BindTextureUnit(slot, rendererID->load(std::memory_order_relaxed));
+        });
     }
 
 } // namespace Tesseract
@@ -3,6 +3,7 @@
 #include "core/Renderer/Texture.hpp"
 #include <GL/glew.h> // Utiliser GLEW au lieu de Glad
 #include <string> // Pour std::string
+#include <atomic>
 
 namespace Tesseract {
 
@@ -10,29 +11,43 @@ namespace Tesseract {
     public:
         // Constructeur pour créer une texture vide
         OpenGLTexture2D(uint32_t width, uint32_t height);
-        // Constructeur pour charger depuis un fichier
-        OpenGLTexture2D(const std::string& path);
+        // Constructeur pour charger depuis un fichier (deferLoad : texture en attente,
+        // aucun stockage GPU avant SetImage)
+        OpenGLTexture2D(const std::string& path, bool deferLoad = false);
 
         virtual ~OpenGLTexture2D();
 
         virtual uint32_t GetWidth() const override { return m_Width; }
         virtual uint32_t GetHeight() const override { return m_Height; }
-        virtual uint32_t GetRendererID() const override { return m_RendererID; }
+        // 0 tant que la commande de création n'a pas été exécutée par le thread de rendu
+        virtual uint32_t GetRendererID() const override { return m_RendererID->load(std::memory_order_acquire); }
 
         virtual void SetData(void* data, uint32_t size) override;
+        virtual void SetImage(Image&& image) override;
+        virtual uint32_t GetMipLevelCount() const override { return m_MipLevels; }
+        virtual size_t GetMemorySize() const override { return m_MemorySize; }
+        virtual bool IsLoaded() const override { return m_Loaded; }
 
         virtual void Bind(uint32_t slot = 0) const override;
 
         virtual bool operator==(const Texture& other) const override {
-            // Compare simplement les IDs OpenGL
+            // Compare l'identité du nom GL partagé (valable avant même sa création)
             return m_RendererID == static_cast<const OpenGLTexture2D&>(other).m_RendererID;
         }
 
     private:
+        // Image BCn avec ses niveaux de mip pré-calculés
+        void SetCompressedImage(Image&& image);
+
         std::string m_Path; // Chemin du fichier (si chargé)
-        uint32_t m_Width, m_Height;
-        uint32_t m_RendererID; // ID OpenGL de la texture
-        GLenum m_InternalFormat, m_DataFormat; // Formats OpenGL (ex: GL_RGBA8, GL_RGBA)
+        uint32_t m_Width = 0, m_Height = 0;
+        uint32_t m_MipLevels = 1;
+        size_t m_MemorySize = 0;
+        bool m_Loaded = false;
+        // ID OpenGL de la texture, partagé avec les commandes en attente : écrit par le
+        // thread de rendu (release), lu par GetRendererID depuis n'importe quel thread (acquire)
+        Ref<std::atomic<uint32_t>> m_RendererID;
+        GLenum m_InternalFormat = 0, m_DataFormat = 0; // Formats OpenGL (ex: GL_RGBA8, GL_RGBA)
     };
 
 } // namespace Tesseract
@@ -1,6 +1,8 @@
 #include "core/Renderer/OpenGLVertexArray.hpp"
+#include "core/Renderer/RenderThread.hpp"
+#include "core/Renderer/OpenGLStateCache.hpp"
 #include "core/Core.hpp"
-#include "core/Logger.hpp"
+#include "core/BinaryLog.hpp"
 #include <GL/glew.h>
 
 namespace Tesseract {
@@ -20,51 +22,85 @@ namespace Tesseract {
             case ShaderDataType::Int3:      return GL_INT;
             case ShaderDataType::Int4:      return GL_INT;
             case ShaderDataType::Bool:      return GL_BOOL;
+            case ShaderDataType::UByte:     return GL_UNSIGNED_BYTE;
+            case ShaderDataType::UByte4:    return GL_UNSIGNED_BYTE;
+            case ShaderDataType::Short2:    return GL_SHORT;
+            case ShaderDataType::Short3:    return GL_SHORT;
+            case ShaderDataType::Short4:    return GL_SHORT;
+            case ShaderDataType::UShort2:   return GL_UNSIGNED_SHORT;
+            case ShaderDataType::UShort4:   return GL_UNSIGNED_SHORT;
         }
         // Ajout d'un default pour satisfaire -Wswitch et attraper les cas imprévus
         TS_ASSERT(false, "Unknown ShaderDataType!");
         return 0;
     }
 
-    OpenGLVertexArray::OpenGLVertexArray() {
-        glCreateVertexArrays(1, &m_RendererID);
-        Logger::Trace("Created OpenGL VertexArray (ID: {})", m_RendererID);
+    OpenGLVertexArray::OpenGLVertexArray()
+        : m_RendererID(CreateRef<uint32_t>(0)) {
+        RenderThread::Submit([rendererID = m_RendererID]() {
+            glCreateVertexArrays(1, rendererID.get());
+            TS_BLOG_TRACE("Created OpenGL VertexArray (ID: {})", *rendererID);
+        });
     }
 
     OpenGLVertexArray::~OpenGLVertexArray() {
-        glDeleteVertexArrays(1, &m_RendererID);
-        Logger::Trace("Deleted OpenGL VertexArray (ID: {})", m_RendererID);
+        RenderThread::Submit([rendererID = m_RendererID]() {
+            OpenGLStateCache::ForgetVertexArray(*rendererID);
+            glDeleteVertexArrays(1, rendererID.get());
+            TS_BLOG_TRACE("Deleted OpenGL VertexArray (ID: {})", *rendererID);
+        });
     }
 
     void OpenGLVertexArray::Bind() const {
-        glBindVertexArray(m_RendererID);
+        RenderThread::Submit([rendererID = m_RendererID]() {
+            OpenGLStateCache::BindVertexArray(*rendererID);
+        });
     }
 
     void OpenGLVertexArray::Unbind() const {
-        glBindVertexArray(0);
+        RenderThread::Submit([]() {
+            OpenGLStateCache::BindVertexArray(0);
+        });
     }
 
     void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) {
         TS_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
 
-        glBindVertexArray(m_RendererID); // Lie notre VAO
-        vertexBuffer->Bind(); // Lie le VBO à ajouter
-
-        const auto& layout = vertexBuffer->GetLayout();
-        for (const auto& element : layout) {
-            glEnableVertexAttribArray(m_VertexBufferIndex);
-            glVertexAttribPointer(
-                m_VertexBufferIndex, // index de l'attribut (0 pour pos, 1 pour couleur, etc.)
-                element.GetComponentCount(), // nombre de composants par vertex (ex: 3 pour vec3)
-                ShaderDataTypeToOpenGLBaseType(element.Type), // type de données OpenGL
-                element.Normalized ? GL_TRUE : GL_FALSE, // normaliser ?
-                layout.GetStride(), // taille d'un vertex complet (stride)
-                (const void*)element.Offset // décalage (offset) de cet attribut dans le vertex
-            );
-            Logger::Trace("  Added VBO attribute index {}, type {}, count {}, stride {}, offset {}",
-                          m_VertexBufferIndex, (int)element.Type, element.GetComponentCount(), layout.GetStride(), element.Offset);
-            m_VertexBufferIndex++; // Incrémente pour le prochain attribut
-        }
+        // L'index des attributs est réservé ici ; la commande reçoit une copie du layout
+        uint32_t firstIndex = m_VertexBufferIndex;
+        m_VertexBufferIndex += (uint32_t)vertexBuffer->GetLayout().GetElements().size();
+
+        RenderThread::Submit([rendererID = m_RendererID, vertexBuffer, layout = vertexBuffer->GetLayout(), firstIndex]() {
+            OpenGLStateCache::BindVertexArray(*rendererID); // Lie notre VAO
+            vertexBuffer->Bind(); // Lie le VBO à ajouter (exécuté immédiatement sur le thread de rendu)
+
+            uint32_t index = firstIndex;
+            for (const auto& element : layout) {
+                glEnableVertexAttribArray(index);
+                if (ShaderDataTypeIsInteger(element.Type) && !element.Normalized) {
+                    // Entier lu tel quel par le shader (in int / in uint)
+                    glVertexAttribIPointer(
+                        index,
+                        element.GetComponentCount(),
+                        ShaderDataTypeToOpenGLBaseType(element.Type),
+                        layout.GetStride(),
+                        (const void*)(uintptr_t)element.Offset
+                    );
+                } else {
+                    glVertexAttribPointer(
+                        index, // index de l'attribut (0 pour pos, 1 pour couleur, etc.)
+                        element.GetComponentCount(), // nombre de composants par vertex (ex: 3 pour vec3)
+                        ShaderDataTypeToOpenGLBaseType(element.Type), // type de données OpenGL
+                        element.Normalized ? GL_TRUE : GL_FALSE, // normaliser ? (snorm/unorm -> float)
+                        layout.GetStride(), // taille d'un vertex complet (stride)
+                        (const void*)(uintptr_t)element.Offset // décalage (offset) de cet attribut dans le vertex
+                    );
+                }
+                TS_BLOG_TRACE("  Added VBO attribute index {}, type {}, count {}, stride {}, offset {}",
+                              index, (int)element.Type, element.GetComponentCount(), layout.GetStride(), element.Offset);
+                index++; // Incrémente pour le prochain attribut
+            }
+        });
 
         m_VertexBuffers.push_back(vertexBuffer); // Stocke la référence au VBO
 
@@ -75,12 +111,13 @@ namespace Tesseract {
     }
 
     void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) {
-        glBindVertexArray(m_RendererID); // Lie notre VAO
-        indexBuffer->Bind(); // Lie l'IBO
+        RenderThread::Submit([rendererID = m_RendererID, indexBuffer]() {
+            OpenGLStateCache::BindVertexArray(*rendererID); // Lie notre VAO
+            indexBuffer->Bind(); // Lie l'IBO
+            TS_BLOG_TRACE("Set IndexBuffer for VAO (ID: {})", *rendererID);
+        });
 
         m_IndexBuffer = indexBuffer; // Stocke la référence à l'IBO
-        Logger::Trace("Set IndexBuffer (ID: {}) for VAO (ID: {})",
-                      "(TODO: Get IBO ID)", m_RendererID); // TODO: Ajouter GetRendererID() à IndexBuffer si besoin
 
         // Décommenter si nécessaire, mais pas obligatoire
         // indexBuffer->Unbind();
@@ -19,7 +19,8 @@ namespace Tesseract {
         virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
 
     private:
-        uint32_t m_RendererID;
+        // Nom GL partagé avec les commandes en attente (rempli par le thread de rendu)
+        Ref<uint32_t> m_RendererID;
         uint32_t m_VertexBufferIndex = 0; // Garde une trace de l'index d'attribut à utiliser
         std::vector<Ref<VertexBuffer>> m_VertexBuffers;
         Ref<IndexBuffer> m_IndexBuffer;
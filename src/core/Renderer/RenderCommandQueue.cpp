@@ -0,0 +1,66 @@
+#include "core/Renderer/RenderCommandQueue.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Tesseract {
+
+    RenderCommandQueue::RenderCommandQueue(size_t blockSize)
+        : m_BlockSize(blockSize) {
+        m_Commands.reserve(1024);
+    }
+
+    RenderCommandQueue::~RenderCommandQueue() {
+        // Les commandes non exécutées doivent quand même libérer leurs captures (Refs)
+        Execute();
+    }
+
+    void* RenderCommandQueue::Allocate(size_t size, size_t alignment) {
+        while (true) {
+            if (m_CurrentBlock == m_Blocks.size()) {
+                // Nouveau bloc, assez grand pour les gros envois (buffers de sommets)
+                Block block;
+                block.Size = std::max(m_BlockSize, size + alignment);
+                block.Data.reset(new uint8_t[block.Size]);
+                m_Blocks.push_back(std::move(block));
+            }
+
+            Block& block = m_Blocks[m_CurrentBlock];
+            uintptr_t base = (uintptr_t)block.Data.get();
+            uintptr_t aligned = (base + block.Used + alignment - 1) & ~(uintptr_t)(alignment - 1);
+            size_t end = (size_t)(aligned - base) + size;
+            if (end <= block.Size) {
+                block.Used = end;
+                return (void*)aligned;
+            }
+
+            // Bloc plein : passer au suivant (les pointeurs déjà rendus restent valides)
+            m_CurrentBlock++;
+        }
+    }
+
+    void* RenderCommandQueue::SubmitData(const void* data, size_t size) {
+        void* copy = Allocate(size, 16);
+        if (size)
+            std::memcpy(copy, data, size);
+        return copy;
+    }
+
+    void RenderCommandQueue::Execute() {
+        for (const CommandHeader& command : m_Commands)
+            command.Execute(command.Payload);
+
+        m_Commands.clear();
+        for (Block& block : m_Blocks)
+            block.Used = 0;
+        m_CurrentBlock = 0;
+    }
+
+    size_t RenderCommandQueue::GetUsedBytes() const {
+        size_t used = 0;
+        for (const Block& block : m_Blocks)
+            used += block.Used;
+        return used;
+    }
+
+} // namespace Tesseract
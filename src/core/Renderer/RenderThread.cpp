@@ -0,0 +1,179 @@
+#include "core/Renderer/RenderThread.hpp"
+#include "core/Window.hpp"
+#include "core/Logger.hpp"
+#include "core/Metrics.hpp"
+#include "core/Profiler.hpp"
+
+#include <SDL.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Tesseract {
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        struct RenderThreadData {
+            // Double tampon : le thread principal remplit Queues[SubmitIndex],
+            // le thread de rendu exécute l'autre
+            RenderCommandQueue Queues[2];
+            uint32_t SubmitIndex = 0;
+
+            std::thread Thread;
+            std::mutex Mutex;
+            std::condition_variable Condition;
+            bool FramePending = false;
+            bool StopRequested = false;
+            std::atomic<bool> Running{ false };
+
+            SDL_Window* Window = nullptr;
+            SDL_GLContext Context = nullptr;
+
+            RenderThread::Statistics Stats;
+        };
+
+        RenderThreadData s_Data;
+        thread_local bool t_IsRenderThread = false;
+
+        void RenderThreadMain() {
+            t_IsRenderThread = true;
+            TS_PROFILE_THREAD("Render");
+            if (SDL_GL_MakeCurrent(s_Data.Window, s_Data.Context) != 0)
+                Logger::Error("RenderThread: impossible de rendre le contexte GL courant: {}", SDL_GetError());
+
+            while (true) {
+                uint32_t index;
+                {
+                    std::unique_lock<std::mutex> lock(s_Data.Mutex);
+                    s_Data.Condition.wait(lock, [] { return s_Data.FramePending || s_Data.StopRequested; });
+                    if (!s_Data.FramePending)
+                        break;
+                    index = 1 - s_Data.SubmitIndex;
+                }
+
+                auto start = Clock::now();
+                {
+                    TS_PROFILE_SCOPE("RenderThread::Execute");
+                    s_Data.Queues[index].Execute();
+                }
+                float executeMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+
+                static Metric& executeMetric = Metrics::GetGauge("RenderThread.ExecuteMs", "ms");
+                executeMetric.Set(executeMs);
+                {
+                    std::lock_guard<std::mutex> lock(s_Data.Mutex);
+                    s_Data.Stats.ExecuteMs = executeMs;
+                    s_Data.FramePending = false;
+                }
+                s_Data.Condition.notify_all();
+            }
+
+            SDL_GL_MakeCurrent(s_Data.Window, nullptr);
+            t_IsRenderThread = false;
+        }
+
+        // Confie la file courante au thread de rendu (après la fin de la précédente)
+        void Kick() {
+            TS_PROFILE_FUNCTION();
+            auto start = Clock::now();
+            {
+                std::unique_lock<std::mutex> lock(s_Data.Mutex);
+                s_Data.Condition.wait(lock, [] { return !s_Data.FramePending; });
+
+                const RenderCommandQueue& queue = s_Data.Queues[s_Data.SubmitIndex];
+                s_Data.Stats.MainThreadWaitMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+                s_Data.Stats.CommandCount = queue.GetCommandCount();
+                s_Data.Stats.QueueBytes = queue.GetUsedBytes();
+
+                s_Data.SubmitIndex = 1 - s_Data.SubmitIndex;
+                s_Data.FramePending = true;
+            }
+
+            static Metric& waitMetric = Metrics::GetGauge("RenderThread.MainWaitMs", "ms");
+            static Metric& commandMetric = Metrics::GetGauge("RenderThread.Commands");
+            waitMetric.Set(s_Data.Stats.MainThreadWaitMs);
+            commandMetric.Set((float)s_Data.Stats.CommandCount);
+            s_Data.Condition.notify_all();
+        }
+
+    } // namespace
+
+    void RenderThread::Start(Window& window) {
+        if (IsRunning())
+            return;
+
+        s_Data.Window = static_cast<SDL_Window*>(window.GetNativeWindow());
+        s_Data.Context = static_cast<SDL_GLContext>(window.GetNativeContext());
+        s_Data.FramePending = false;
+        s_Data.StopRequested = false;
+
+        // Un contexte GL ne peut être courant que sur un seul thread
+        SDL_GL_MakeCurrent(s_Data.Window, nullptr);
+
+        s_Data.Running = true;
+        s_Data.Thread = std::thread(RenderThreadMain);
+        Logger::Info("RenderThread started");
+    }
+
+    void RenderThread::Stop() {
+        if (!IsRunning())
+            return;
+
+        WaitIdle();
+        {
+            std::lock_guard<std::mutex> lock(s_Data.Mutex);
+            s_Data.StopRequested = true;
+        }
+        s_Data.Condition.notify_all();
+        s_Data.Thread.join();
+        s_Data.Running = false;
+
+        // Le thread appelant reprend le contexte (destruction des ressources GL)
+        SDL_GL_MakeCurrent(s_Data.Window, s_Data.Context);
+        Logger::Info("RenderThread stopped");
+    }
+
+    bool RenderThread::IsRunning() {
+        return s_Data.Running.load(std::memory_order_acquire);
+    }
+
+    bool RenderThread::IsRenderThread() {
+        return !IsRunning() || t_IsRenderThread;
+    }
+
+    const void* RenderThread::SubmitData(const void* data, size_t size) {
+        if (!IsRunning() || IsRenderThread())
+            return data;
+        return GetSubmitQueue().SubmitData(data, size);
+    }
+
+    void RenderThread::EndFrame() {
+        if (!IsRunning())
+            return;
+        Kick();
+    }
+
+    void RenderThread::WaitIdle() {
+        if (!IsRunning() || IsRenderThread())
+            return;
+
+        Kick();
+        std::unique_lock<std::mutex> lock(s_Data.Mutex);
+        s_Data.Condition.wait(lock, [] { return !s_Data.FramePending; });
+    }
+
+    RenderThread::Statistics RenderThread::GetStats() {
+        std::lock_guard<std::mutex> lock(s_Data.Mutex);
+        return s_Data.Stats;
+    }
+
+    RenderCommandQueue& RenderThread::GetSubmitQueue() {
+        // SubmitIndex ne change que sur le thread principal (Kick), seul producteur
+        return s_Data.Queues[s_Data.SubmitIndex];
+    }
+
+} // namespace Tesseract
@@ -1,43 +1,69 @@
 #include "core/Renderer/Renderer2D.hpp"
 #include "core/Renderer/VertexArray.hpp"
 #include "core/Renderer/Shader.hpp"
+#include "core/Renderer/ShaderVariants.hpp"
+#include "core/Renderer/GpuProfiler.hpp"
 #include "core/Renderer/RenderCommand.hpp"
+#include "core/Renderer/RendererUniforms.hpp"
 #include "core/Logger.hpp"
+#include "core/Metrics.hpp"
+#include "core/Profiler.hpp"
 #include "core/Core.hpp"
 #include "core/Renderer/Texture.hpp"
+#include "core/JobSystem.hpp"
 
 #include <glm/gtc/matrix_transform.hpp>
-#include <array> // Pour std::array (si utilisé pour les textures slots)
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <array>
 
 namespace Tesseract {
 
-    // Structure pour stocker les données du quad pour le batch rendering
+    // Sommet compact du batch (16 octets au lieu de 28 en float)
+    // Les positions sont quantifiées en snorm16 relativement au repère du lot
+    // (origine + demi-étendue, passés en uniforms) au moment du Flush.
     struct QuadVertex {
-        glm::vec3 Position;
-        glm::vec4 Color;
-        // glm::vec2 TexCoord; // Pour les textures
-        // float TexIndex;
-        // float TilingFactor;
+        uint8_t Color[4];     // RGBA8 normalisé
+        uint16_t TexCoord[2]; // unorm16
+        int16_t Position[3];  // snorm16, relatif à l'origine du lot
+        uint8_t TexIndex;     // Slot de texture (0 = texture blanche)
+        uint8_t Padding;
     };
+    static_assert(sizeof(QuadVertex) == 16, "QuadVertex doit rester compact");
 
     // Données internes du Renderer2D
     struct Renderer2DData {
         static const uint32_t MaxQuads = 10000;
         static const uint32_t MaxVertices = MaxQuads * 4;
         static const uint32_t MaxIndices = MaxQuads * 6;
-        // static const uint32_t MaxTextureSlots = 32; // TODO: Pour le rendu multi-textures
+        // Quads générés par tâche lors d'un DrawQuads
+        static const uint32_t VertexGenerationGrainSize = 1024;
+        // 16 unités de texture par étage garanties par OpenGL 3.3
+        static const uint32_t MaxTextureSlots = 16;
 
         Ref<VertexArray> QuadVertexArray;
         Ref<VertexBuffer> QuadVertexBuffer;
+        // Texture.glsl : variante TEXTURED, et variante couleur seule pour les
+        // lots qui n'utilisent que la texture blanche
+        Scope<ShaderVariants> QuadShaders;
         Ref<Shader> TextureShader;
+        Ref<Shader> ColorShader;
+        Shader* BoundShader = nullptr;
         Ref<Texture2D> WhiteTexture;
 
         uint32_t QuadIndexCount = 0;
         QuadVertex* QuadVertexBufferBase = nullptr;
         QuadVertex* QuadVertexBufferPtr = nullptr;
+        // Positions en float du lot courant (même indice que les sommets), quantifiées au Flush
+        glm::vec3* QuadPositionBufferBase = nullptr;
 
-        // std::array<Ref<Texture2D>, MaxTextureSlots> TextureSlots;
-        // uint32_t TextureSlotIndex = 1; // 0 = White Texture
+        // Textures du lot courant (0 = texture blanche)
+        std::array<Texture2D*, MaxTextureSlots> TextureSlots = {};
+        uint32_t TextureSlotIndex = 1;
+        // Répétition des UV du lot (u_TilingFactor), fixée par son premier quad texturé
+        float TilingFactor = 1.0f;
+        bool HasTilingFactor = false;
 
         glm::vec4 QuadVertexPositions[4];
 
@@ -49,6 +75,81 @@ namespace Tesseract {
 
     static Renderer2DData s_Data;
 
+    static inline uint8_t PackUnorm8(float value) {
+        return (uint8_t)std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f);
+    }
+
+    static inline int16_t PackSnorm16(float value) {
+        return (int16_t)std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f);
+    }
+
+    static inline uint16_t PackUnorm16(float value) {
+        return (uint16_t)std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f);
+    }
+
+    // Slot d'une texture déjà enregistrée dans le lot courant (lecture seule)
+    static inline uint8_t FindTextureSlot(const Texture2D* texture) {
+        if (!texture)
+            return 0;
+        for (uint32_t i = 1; i < s_Data.TextureSlotIndex; ++i) {
+            if (s_Data.TextureSlots[i] == texture)
+                return (uint8_t)i;
+        }
+        return 0;
+    }
+
+    // Répétition effective d'un quad : les UV sont répétés sur toute la texture, ce qui
+    // déborderait d'une sous-région (sprite d'atlas) ; ignorée dans ce cas
+    static float GetTilingFactor(const Renderer2D::QuadInstance& quad) {
+        if (quad.TilingFactor == 1.0f)
+            return 1.0f;
+        if (quad.UVMin == glm::vec2(0.0f) && quad.UVMax == glm::vec2(1.0f))
+            return quad.TilingFactor;
+
+        static bool warned = false;
+        if (!warned) {
+            Logger::Warn("Renderer2D: TilingFactor {} ignored on a texture sub-region (atlas sprite)", quad.TilingFactor);
+            warned = true;
+        }
+        return 1.0f;
+    }
+
+    // Écrit les 4 sommets d'un quad centré (ordre de QuadVertexPositions).
+    // Sans état partagé : appelée en parallèle sur des plages disjointes.
+    static inline void WriteQuadVertices(QuadVertex* vertices, glm::vec3* positions, const Renderer2D::QuadInstance& quad, uint8_t texIndex) {
+        glm::vec2 half = quad.Size * 0.5f;
+        glm::vec2 axisX = { half.x, 0.0f };
+        glm::vec2 axisY = { 0.0f, half.y };
+        if (quad.Rotation != 0.0f) {
+            float c = std::cos(quad.Rotation);
+            float s = std::sin(quad.Rotation);
+            axisX = { c * half.x, s * half.x };
+            axisY = { -s * half.y, c * half.y };
+        }
+
+        glm::vec2 center = { quad.Position.x, quad.Position.y };
+        const glm::vec2 corners[4] = {
+            center - axisX - axisY,
+            center + axisX - axisY,
+            center + axisX + axisY,
+            center - axisX + axisY
+        };
+        const uint16_t u0 = PackUnorm16(quad.UVMin.x), v0 = PackUnorm16(quad.UVMin.y);
+        const uint16_t u1 = PackUnorm16(quad.UVMax.x), v1 = PackUnorm16(quad.UVMax.y);
+        const uint16_t texCoords[4][2] = { { u0, v0 }, { u1, v0 }, { u1, v1 }, { u0, v1 } };
+
+        const uint8_t color[4] = { PackUnorm8(quad.Color.r), PackUnorm8(quad.Color.g), PackUnorm8(quad.Color.b), PackUnorm8(quad.Color.a) };
+        for (int i = 0; i < 4; ++i) {
+            positions[i] = { corners[i].x, corners[i].y, quad.Position.z };
+            QuadVertex& vertex = vertices[i];
+            std::memcpy(vertex.Color, color, sizeof(color));
+            vertex.TexCoord[0] = texCoords[i][0];
+            vertex.TexCoord[1] = texCoords[i][1];
+            vertex.TexIndex = texIndex;
+            vertex.Padding = 0;
+        }
+    }
+
     void Renderer2D::Init() {
         Logger::Info("Initializing Renderer2D...");
 
@@ -56,13 +157,16 @@ namespace Tesseract {
 
         s_Data.QuadVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(QuadVertex));
         s_Data.QuadVertexBuffer->SetLayout({
-            { ShaderDataType::Float3, "a_Position" },
-            { ShaderDataType::Float4, "a_Color" }
-            // Ajouter ici les autres attributs (TexCoord, TexIndex, TilingFactor) quand ils seront utilisés
+            { ShaderDataType::UByte4,  "a_Color",    true },
+            { ShaderDataType::UShort2, "a_TexCoord", true },
+            { ShaderDataType::Short3,  "a_Position", true },
+            { ShaderDataType::UByte,   "a_TexIndex" }   // Entier (glVertexAttribIPointer)
         });
+        TS_ASSERT(s_Data.QuadVertexBuffer->GetLayout().GetStride() == sizeof(QuadVertex), "QuadVertex layout mismatch!");
         s_Data.QuadVertexArray->AddVertexBuffer(s_Data.QuadVertexBuffer);
 
         s_Data.QuadVertexBufferBase = new QuadVertex[s_Data.MaxVertices];
+        s_Data.QuadPositionBufferBase = new glm::vec3[s_Data.MaxVertices];
 
         uint32_t* quadIndices = new uint32_t[s_Data.MaxIndices];
         uint32_t offset = 0;
@@ -84,20 +188,23 @@ namespace Tesseract {
         uint32_t whiteTextureData = 0xffffffff;
         s_Data.WhiteTexture->SetData(&whiteTextureData, sizeof(uint32_t));
 
-        // Création du Shader
-        // Utiliser un chemin absolu pour éviter les problèmes de chemin relatif
-        s_Data.TextureShader = Shader::Create("assets/shaders/Texture.glsl");
-        TS_ASSERT(s_Data.TextureShader, "Failed to load Texture shader!");
+        // Création des variantes du shader (compilées ensemble si le driver le permet)
+        s_Data.QuadShaders = CreateScope<ShaderVariants>("assets/shaders/Texture.glsl", std::vector<std::string>{ "TEXTURED" });
+        ShaderVariants::Key texturedKey = s_Data.QuadShaders->GetKey({ "TEXTURED" });
+        s_Data.QuadShaders->Prewarm({ texturedKey, 0 });
+        s_Data.TextureShader = s_Data.QuadShaders->Get(texturedKey);
+        s_Data.ColorShader = s_Data.QuadShaders->Get(0);
+        TS_ASSERT(s_Data.TextureShader && s_Data.ColorShader, "Failed to load Texture shader!");
 
-        // Configuration initiale du shader (si nécessaire, ex: définir les slots de texture)
-        // s_Data.TextureShader->Bind();
-        // int samplers[s_Data.MaxTextureSlots];
-        // for(uint32_t i = 0; i < s_Data.MaxTextureSlots; ++i) samplers[i] = i;
-        // s_Data.TextureShader->SetIntArray("u_Textures", samplers, s_Data.MaxTextureSlots);
+        // Chaque sampler u_Textures[i] lit l'unité de texture i
+        s_Data.TextureShader->Bind();
+        int samplers[Renderer2DData::MaxTextureSlots];
+        for (uint32_t i = 0; i < Renderer2DData::MaxTextureSlots; ++i)
+            samplers[i] = (int)i;
+        s_Data.TextureShader->SetIntArray("u_Textures", samplers, Renderer2DData::MaxTextureSlots);
 
-        // Initialiser les slots de texture (optionnel pour le moment)
-        // s_Data.TextureSlots[0] = s_Data.WhiteTexture;
-        // s_Data.TextureSlotIndex = 1; // Commencer à remplir à partir du slot 1
+        s_Data.TextureSlots[0] = s_Data.WhiteTexture.get();
+        s_Data.TextureSlotIndex = 1;
 
         // Positions de base des sommets
         s_Data.QuadVertexPositions[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
@@ -109,13 +216,16 @@ namespace Tesseract {
     void Renderer2D::Shutdown() {
         Logger::Info("Shutting down Renderer2D...");
         delete[] s_Data.QuadVertexBufferBase;
+        delete[] s_Data.QuadPositionBufferBase;
         // Les Refs (VAO, VBO, Shader, Texture) seront nettoyés automatiquement
     }
 
     void Renderer2D::BeginScene(const OrthographicCamera& camera) {
         TS_ASSERT(s_Data.TextureShader, "Texture shader is not initialized!");
+        // Bloc Camera partagé : un seul envoi pour toutes les variantes
+        RendererUniforms::SetCamera(camera);
         s_Data.TextureShader->Bind();
-        s_Data.TextureShader->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
+        s_Data.BoundShader = s_Data.TextureShader.get();
 
         StartBatch(); // Commence un nouveau batch
     }
@@ -127,34 +237,82 @@ namespace Tesseract {
     void Renderer2D::StartBatch() {
         s_Data.QuadIndexCount = 0;
         s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;
-        // s_Data.TextureSlotIndex = 1; // Réinitialiser l'index du slot de texture
+        s_Data.TextureSlotIndex = 1;
+        s_Data.TilingFactor = 1.0f;
+        s_Data.HasTilingFactor = false;
     }
 
     void Renderer2D::Flush() {
+        TS_PROFILE_FUNCTION();
         if (s_Data.QuadIndexCount == 0)
             return; // Rien à dessiner
+        TS_PROFILE_GPU("Renderer2D::Flush");
+
+        uint32_t vertexCount = (uint32_t)(s_Data.QuadVertexBufferPtr - s_Data.QuadVertexBufferBase);
+        QuadVertex* vertices = s_Data.QuadVertexBufferBase;
+        const glm::vec3* positions = s_Data.QuadPositionBufferBase;
+
+        // Repère de quantification du lot : boîte englobante des positions
+        glm::vec3 boundsMin = positions[0];
+        glm::vec3 boundsMax = positions[0];
+        for (uint32_t i = 1; i < vertexCount; ++i) {
+            boundsMin = { std::min(boundsMin.x, positions[i].x), std::min(boundsMin.y, positions[i].y), std::min(boundsMin.z, positions[i].z) };
+            boundsMax = { std::max(boundsMax.x, positions[i].x), std::max(boundsMax.y, positions[i].y), std::max(boundsMax.z, positions[i].z) };
+        }
+        glm::vec3 origin = (boundsMin + boundsMax) * 0.5f;
+        glm::vec3 extent = (boundsMax - boundsMin) * 0.5f;
+        extent = { std::max(extent.x, 1e-6f), std::max(extent.y, 1e-6f), std::max(extent.z, 1e-6f) };
+        glm::vec3 inverseExtent = { 1.0f / extent.x, 1.0f / extent.y, 1.0f / extent.z };
+
+        auto quantize = [vertices, positions, origin, inverseExtent](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i) {
+                glm::vec3 local = (positions[i] - origin) * inverseExtent;
+                vertices[i].Position[0] = PackSnorm16(local.x);
+                vertices[i].Position[1] = PackSnorm16(local.y);
+                vertices[i].Position[2] = PackSnorm16(local.z);
+            }
+        };
+        const uint32_t grainSize = Renderer2DData::VertexGenerationGrainSize * 4;
+        if (vertexCount < grainSize)
+            quantize(0, vertexCount);
+        else
+            JobSystem::ParallelFor(vertexCount, grainSize, quantize);
+
+        // Lot sans autre texture que la blanche : variante couleur seule
+        Shader* shader = s_Data.TextureSlotIndex == 1 ? s_Data.ColorShader.get() : s_Data.TextureShader.get();
+        if (shader != s_Data.BoundShader) {
+            shader->Bind();
+            s_Data.BoundShader = shader;
+        }
+        shader->SetFloat3("u_BatchOrigin", origin);
+        shader->SetFloat3("u_BatchExtent", extent);
 
-        uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.QuadVertexBufferPtr - (uint8_t*)s_Data.QuadVertexBufferBase);
+        uint32_t dataSize = vertexCount * (uint32_t)sizeof(QuadVertex);
         s_Data.QuadVertexBuffer->SetData(s_Data.QuadVertexBufferBase, dataSize);
+        s_Data.Stats.VertexBytes += dataSize;
 
-        // Lier les textures (pour plus tard)
-        // for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++)
-        //     s_Data.TextureSlots[i]->Bind(i);
-
-        // Utiliser la texture blanche par défaut pour le moment
-        s_Data.WhiteTexture->Bind(0);
+        if (shader == s_Data.TextureShader.get()) {
+            shader->SetFloat("u_TilingFactor", s_Data.TilingFactor);
+            for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++)
+                s_Data.TextureSlots[i]->Bind(i);
+            s_Data.Stats.TextureBinds += s_Data.TextureSlotIndex;
+        }
 
         RenderCommand::DrawIndexed(s_Data.QuadVertexArray, s_Data.QuadIndexCount);
         s_Data.Stats.DrawCalls++;
+
+        // Contrairement à Stats (remis à zéro par l'application), historisé par Metrics
+        static Metric& batches = Metrics::GetCounter("Renderer2D.Batches");
+        static Metric& quads = Metrics::GetCounter("Renderer2D.Quads");
+        static Metric& vertexBytes = Metrics::GetCounter("Renderer2D.VertexBytes", "B");
+        batches.Increment();
+        quads.Increment(s_Data.QuadIndexCount / 6);
+        vertexBytes.Increment(dataSize);
     }
 
     void Renderer2D::NextBatch() {
-        EndScene();
         Flush();
-        s_Data.QuadIndexCount = 0;
-        s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;
-        // Suppression de l'affectation de TextureSlotIndex car commenté/inutilisé
-        // s_Data.TextureSlotIndex = 1;
+        StartBatch();
     }
 
     void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color) {
@@ -162,67 +320,119 @@ namespace Tesseract {
     }
 
     void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color) {
-        if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices) {
-            NextBatch(); // Remplacé FlushAndReset par NextBatch
-        }
+        // DrawQuad part du coin inférieur gauche
+        QuadInstance quad;
+        quad.Position = { position.x + size.x * 0.5f, position.y + size.y * 0.5f, position.z };
+        quad.Size = size;
+        quad.Color = color;
+        DrawQuads(&quad, 1);
+    }
 
-        const float quadVertices[4 * 5] = {
-            position.x,             position.y,             0.0f, 0.0f, 0.0f,
-            position.x + size.x,    position.y,             0.0f, 1.0f, 0.0f,
-            position.x + size.x,    position.y + size.y,    0.0f, 1.0f, 1.0f,
-            position.x,             position.y + size.y,    0.0f, 0.0f, 1.0f
-        };
 
-        [[maybe_unused]] const float texIndex = 0.0f; // Texture blanche par défaut
-        [[maybe_unused]] const float tilingFactor = 1.0f;
+    void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
+        DrawRotatedQuad({ position.x, position.y, 0.0f }, size, rotation, color);
+    }
 
-        for (int i = 0; i < 4; ++i) {
-            s_Data.QuadVertexBufferPtr->Position = { quadVertices[i*5 + 0], quadVertices[i*5 + 1], quadVertices[i*5 + 2] };
-            s_Data.QuadVertexBufferPtr->Color = color;
-            // Suppression des affectations TexCoord, TexIndex, TilingFactor
-            // s_Data.QuadVertexBufferPtr->TexCoord = { quadVertices[i*5 + 3], quadVertices[i*5 + 4] };
-            // s_Data.QuadVertexBufferPtr->TexIndex = texIndex;
-            // s_Data.QuadVertexBufferPtr->TilingFactor = tilingFactor;
-            s_Data.QuadVertexBufferPtr++;
-        }
+    void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotationRadians, const glm::vec4& color) {
+        QuadInstance quad;
+        quad.Position = position;
+        quad.Size = size;
+        quad.Rotation = rotationRadians;
+        quad.Color = color;
+        DrawQuads(&quad, 1);
+    }
 
-        s_Data.QuadIndexCount += 6;
-        s_Data.Stats.QuadCount++;
+    void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<Texture2D>& texture, const glm::vec4& tintColor, float tilingFactor) {
+        DrawQuad({ position.x, position.y, 0.0f }, size, texture, tintColor, tilingFactor);
     }
 
+    void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture, const glm::vec4& tintColor, float tilingFactor) {
+        QuadInstance quad;
+        quad.Position = { position.x + size.x * 0.5f, position.y + size.y * 0.5f, position.z };
+        quad.Size = size;
+        quad.Color = tintColor;
+        quad.Texture = texture.get();
+        quad.TilingFactor = tilingFactor;
+        DrawQuads(&quad, 1);
+    }
 
-    void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
-        DrawRotatedQuad({ position.x, position.y, 0.0f }, size, rotation, color);
+    void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const SubTexture2D& subTexture, const glm::vec4& tintColor) {
+        DrawQuad({ position.x, position.y, 0.0f }, size, subTexture, tintColor);
     }
 
-    void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotationRadians, const glm::vec4& color) {
-         if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices) {
-            NextBatch();
-        }
+    void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const SubTexture2D& subTexture, const glm::vec4& tintColor) {
+        QuadInstance quad;
+        quad.Position = { position.x + size.x * 0.5f, position.y + size.y * 0.5f, position.z };
+        quad.Size = size;
+        quad.Color = tintColor;
+        quad.Texture = subTexture.Texture.get();
+        quad.UVMin = subTexture.UVMin;
+        quad.UVMax = subTexture.UVMax;
+        DrawQuads(&quad, 1);
+    }
 
-        [[maybe_unused]] const float texIndex = 0.0f;
-        // Suppression de texCoords car non utilisée
-        // const glm::vec2 texCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
-        [[maybe_unused]] const float tilingFactor = 1.0f;
-
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-                            * glm::rotate(glm::mat4(1.0f), rotationRadians, { 0.0f, 0.0f, 1.0f })
-                            * glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
-
-        glm::vec4 quadVertexPositions[4];
-        quadVertexPositions[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
-        quadVertexPositions[1] = {  0.5f, -0.5f, 0.0f, 1.0f };
-        quadVertexPositions[2] = {  0.5f,  0.5f, 0.0f, 1.0f };
-        quadVertexPositions[3] = { -0.5f,  0.5f, 0.0f, 1.0f };
-
-        for (int i = 0; i < 4; i++) {
-            s_Data.QuadVertexBufferPtr->Position = transform * quadVertexPositions[i];
-            s_Data.QuadVertexBufferPtr->Color = color;
-            s_Data.QuadVertexBufferPtr++;
+    void Renderer2D::DrawQuads(const QuadInstance* instances, uint32_t count) {
+        uint32_t submitted = 0;
+        while (submitted < count) {
+            if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+                NextBatch();
+
+            // Réservation d'une plage contiguë du lot courant. Chaque instance produit
+            // exactement 4 sommets : la somme préfixe des tailles se réduit à 4 * i.
+            uint32_t available = Renderer2DData::MaxQuads - s_Data.QuadIndexCount / 6;
+            uint32_t batchCount = std::min(available, count - submitted);
+
+            // Attribution des slots de texture (séquentielle) : la plage s'arrête à la
+            // première texture qui ne trouve plus de slot libre dans ce lot. Une texture
+            // encore en chargement n'a pas de slot et utilise la texture blanche.
+            // De même pour la répétition des UV, commune aux quads texturés du lot.
+            const Texture2D* lastTexture = nullptr;
+            for (uint32_t i = 0; i < batchCount; ++i) {
+                const QuadInstance& instance = instances[submitted + i];
+                Texture2D* texture = instance.Texture;
+                if (!texture || !texture->IsLoaded())
+                    continue;
+                float tilingFactor = GetTilingFactor(instance);
+                if (!s_Data.HasTilingFactor) {
+                    s_Data.TilingFactor = tilingFactor;
+                    s_Data.HasTilingFactor = true;
+                } else if (tilingFactor != s_Data.TilingFactor) {
+                    batchCount = i;
+                    break;
+                }
+                if (texture == lastTexture || FindTextureSlot(texture) != 0)
+                    continue;
+                if (s_Data.TextureSlotIndex == Renderer2DData::MaxTextureSlots) {
+                    batchCount = i;
+                    break;
+                }
+                s_Data.TextureSlots[s_Data.TextureSlotIndex++] = texture;
+                lastTexture = texture;
+            }
+            if (batchCount == 0) {
+                NextBatch();
+                continue;
+            }
+            QuadVertex* vertices = s_Data.QuadVertexBufferPtr;
+            glm::vec3* positions = s_Data.QuadPositionBufferBase + (vertices - s_Data.QuadVertexBufferBase);
+            const QuadInstance* batchInstances = instances + submitted;
+
+            if (batchCount < Renderer2DData::VertexGenerationGrainSize) {
+                for (uint32_t i = 0; i < batchCount; ++i)
+                    WriteQuadVertices(vertices + i * 4, positions + i * 4, batchInstances[i], FindTextureSlot(batchInstances[i].Texture));
+            } else {
+                JobSystem::ParallelFor(batchCount, Renderer2DData::VertexGenerationGrainSize,
+                    [vertices, positions, batchInstances](uint32_t begin, uint32_t end) {
+                        for (uint32_t i = begin; i < end; ++i)
+                            WriteQuadVertices(vertices + i * 4, positions + i * 4, batchInstances[i], FindTextureSlot(batchInstances[i].Texture));
+                    });
+            }
+
+            s_Data.QuadVertexBufferPtr += batchCount * 4;
+            s_Data.QuadIndexCount += batchCount * 6;
+            s_Data.Stats.QuadCount += batchCount;
+            submitted += batchCount;
         }
-
-        s_Data.QuadIndexCount += 6;
-        s_Data.Stats.QuadCount++;
     }
 
     void Renderer2D::ResetStats() {
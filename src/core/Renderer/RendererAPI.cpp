@@ -1,8 +1,20 @@
 #include "core/Renderer/RendererAPI.hpp"
+#include "core/Renderer/NullRendererAPI.hpp"
+#include "core/Renderer/OpenGLRendererAPI.hpp"
 
 namespace Tesseract {
 
     // Initialise l'API par défaut à OpenGL
     RendererAPI::API RendererAPI::s_API = RendererAPI::API::OpenGL;
 
+    Scope<RendererAPI> RendererAPI::Create() {
+        switch (s_API) {
+            case API::None:    TS_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case API::OpenGL:  return CreateScope<OpenGLRendererAPI>();
+            case API::Null:    return CreateScope<NullRendererAPI>();
+        }
+        TS_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
 } // namespace Tesseract
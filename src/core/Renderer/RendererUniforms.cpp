@@ -0,0 +1,73 @@
+#include "core/Renderer/RendererUniforms.hpp"
+#include "core/Renderer/OrthographicCamera.hpp"
+
+#include <cstring>
+
+namespace Tesseract {
+
+    namespace {
+
+        struct RendererUniformsData {
+            Ref<UniformBuffer> Camera;
+            Ref<UniformBuffer> Frame;
+            Ref<UniformBuffer> Lighting;
+        };
+
+        RendererUniformsData s_Data;
+
+        // Noms des blocs dans Uniforms.glsl, dans l'ordre de UniformBinding
+        const char* const BlockNames[] = { "Camera", "Frame", "Lighting" };
+        static_assert(sizeof(BlockNames) / sizeof(BlockNames[0]) == (size_t)UniformBinding::Count,
+                      "Un nom de bloc par point de liaison");
+
+    } // namespace
+
+    void RendererUniforms::Init() {
+        s_Data.Camera = UniformBuffer::Create(sizeof(CameraUniforms), (uint32_t)UniformBinding::Camera);
+        s_Data.Frame = UniformBuffer::Create(sizeof(FrameUniforms), (uint32_t)UniformBinding::Frame);
+        s_Data.Lighting = UniformBuffer::Create(sizeof(LightingUniforms), (uint32_t)UniformBinding::Lighting);
+
+        // Valeurs par défaut : identité, éclairage ambiant blanc
+        SetCamera(CameraUniforms());
+        SetFrame(FrameUniforms());
+        SetLighting(LightingUniforms());
+    }
+
+    void RendererUniforms::Shutdown() {
+        s_Data = RendererUniformsData();
+    }
+
+    void RendererUniforms::SetCamera(const OrthographicCamera& camera) {
+        CameraUniforms uniforms;
+        uniforms.ViewProjection = camera.GetViewProjectionMatrix();
+        uniforms.View = camera.GetViewMatrix();
+        uniforms.Projection = camera.GetProjectionMatrix();
+        uniforms.Position = glm::vec4(camera.GetPosition(), 1.0f);
+        SetCamera(uniforms);
+    }
+
+    void RendererUniforms::SetCamera(const CameraUniforms& camera) {
+        s_Data.Camera->SetData(&camera, sizeof(CameraUniforms));
+    }
+
+    void RendererUniforms::SetFrame(const FrameUniforms& frame) {
+        s_Data.Frame->SetData(&frame, sizeof(FrameUniforms));
+    }
+
+    void RendererUniforms::SetLighting(const LightingUniforms& lighting) {
+        // Seules les lumières utilisées sont envoyées
+        uint32_t count = lighting.PointLightCount < LightingUniforms::MaxPointLights
+            ? lighting.PointLightCount : LightingUniforms::MaxPointLights;
+        uint32_t size = (uint32_t)(offsetof(LightingUniforms, PointLights) + count * sizeof(PointLightUniform));
+        s_Data.Lighting->SetData(&lighting, size);
+    }
+
+    int32_t RendererUniforms::GetBlockBinding(const char* blockName) {
+        for (uint32_t i = 0; i < (uint32_t)UniformBinding::Count; ++i) {
+            if (std::strcmp(BlockNames[i], blockName) == 0)
+                return (int32_t)i;
+        }
+        return -1;
+    }
+
+} // namespace Tesseract
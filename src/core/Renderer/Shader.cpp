@@ -1,15 +1,54 @@
 #include "core/Renderer/Shader.hpp"
 #include "core/Renderer/OpenGLShader.hpp"
+#include "core/Renderer/NullShader.hpp"
+#include "core/Renderer/RendererAPI.hpp"
 #include "core/Core.hpp" // Pour Ref et CreateRef
 #include "core/Logger.hpp"
 
+#include <atomic>
+
 namespace Tesseract {
 
+    namespace {
+        std::string s_BinaryCacheDirectory = "cache/shaders";
+        std::atomic<bool> s_SourceTracing{ false };
+    } // namespace
+
     // Factory statique pour créer un Shader
     Ref<Shader> Shader::Create(const std::string& filepath) {
-        // Pour l'instant, on crée toujours un OpenGLShader
-        // Plus tard, on pourrait avoir une sélection basée sur l'API de rendu actuelle
-        return CreateRef<OpenGLShader>(filepath);
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    TS_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(filepath);
+            case RendererAPI::API::Null:    return CreateRef<NullShader>(filepath);
+        }
+        TS_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    Ref<Shader> Shader::Create(const std::string& filepath, const std::vector<std::string>& defines) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    TS_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(filepath, defines);
+            case RendererAPI::API::Null:    return CreateRef<NullShader>(filepath, defines);
+        }
+        TS_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    void Shader::SetBinaryCacheDirectory(const std::string& directory) {
+        s_BinaryCacheDirectory = directory;
+    }
+
+    const std::string& Shader::GetBinaryCacheDirectory() {
+        return s_BinaryCacheDirectory;
+    }
+
+    void Shader::SetSourceTracing(bool enabled) {
+        s_SourceTracing.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool Shader::IsSourceTracingEnabled() {
+        return s_SourceTracing.load(std::memory_order_relaxed);
     }
 
 } // namespace Tesseract
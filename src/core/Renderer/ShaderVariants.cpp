@@ -0,0 +1,50 @@
+#include "core/Renderer/ShaderVariants.hpp"
+#include "core/Logger.hpp"
+
+#include <cstring>
+
+namespace Tesseract {
+
+    ShaderVariants::ShaderVariants(const std::string& filepath, const std::vector<std::string>& keywords)
+        : m_Filepath(filepath), m_Keywords(keywords) {
+        TS_ASSERT(m_Keywords.size() <= MaxKeywords, "Too many shader keywords for '{}'", filepath);
+        if (m_Keywords.size() > MaxKeywords)
+            m_Keywords.resize(MaxKeywords);
+    }
+
+    ShaderVariants::Key ShaderVariants::GetKey(std::initializer_list<const char*> keywords) const {
+        Key key = 0;
+        for (const char* keyword : keywords) {
+            bool found = false;
+            for (size_t i = 0; i < m_Keywords.size(); ++i) {
+                if (std::strcmp(m_Keywords[i].c_str(), keyword) == 0) {
+                    key |= 1u << i;
+                    found = true;
+                    break;
+                }
+            }
+            if (!found)
+                Logger::Warn("Unknown shader keyword '{}' for '{}'", keyword, m_Filepath);
+        }
+        return key;
+    }
+
+    const Ref<Shader>& ShaderVariants::Get(Key key) {
+        Ref<Shader>& shader = m_Variants[key];
+        if (!shader) {
+            std::vector<std::string> defines;
+            for (size_t i = 0; i < m_Keywords.size(); ++i) {
+                if (key & (1u << i))
+                    defines.push_back(m_Keywords[i]);
+            }
+            shader = Shader::Create(m_Filepath, defines);
+        }
+        return shader;
+    }
+
+    void ShaderVariants::Prewarm(const std::vector<Key>& keys) {
+        for (Key key : keys)
+            Get(key);
+    }
+
+} // namespace Tesseract
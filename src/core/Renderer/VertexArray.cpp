@@ -1,13 +1,20 @@
 #include "core/Renderer/VertexArray.hpp"
 #include "core/Renderer/OpenGLVertexArray.hpp"
+#include "core/Renderer/NullBuffer.hpp"
+#include "core/Renderer/RendererAPI.hpp"
 #include "core/Core.hpp"
 #include "core/Logger.hpp"
 
 namespace Tesseract {
 
     Ref<VertexArray> VertexArray::Create() {
-        // Pour l'instant, on crée toujours un OpenGLVertexArray
-        return CreateRef<OpenGLVertexArray>();
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    TS_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexArray>();
+            case RendererAPI::API::Null:    return CreateRef<NullVertexArray>();
+        }
+        TS_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
     }
 
 } // namespace Tesseract
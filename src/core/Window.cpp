@@ -1,6 +1,7 @@
 #include "core/Window.hpp"
 #include "core/Logger.hpp"
 #include "core/Core.hpp" // Pour TS_ASSERT et Scope/CreateScope
+#include "core/Renderer/RenderThread.hpp"
 #include <GL/glew.h>
 #include <SDL.h> // Pour les fonctions SDL
 #include <imgui.h>
@@ -10,6 +11,8 @@
 #include "core/Events/ApplicationEvent.hpp"
 #include "core/Events/KeyEvent.hpp"
 #include "core/Events/MouseEvent.hpp"
+#include "core/EventBus.hpp"
+#include "core/InputRecorder.hpp"
 
 namespace Tesseract {
 
@@ -105,97 +108,94 @@ namespace Tesseract {
 
     // Mise à jour (Polling d'événements)
     void Window::OnUpdate() {
+        const bool replaying = InputRecorder::IsReplaying();
         SDL_Event event;
         while (SDL_PollEvent(&event)) {
+            if (replaying) {
+                // Rejeu : les entrées réelles sont ignorées, seule la fermeture interrompt la session
+                if (event.type == SDL_QUIT || (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_CLOSE))
+                    PostEvent(RecordedEvent::WindowClose());
+                continue;
+            }
+
             ImGui_ImplSDL2_ProcessEvent(&event);
 
-            if (m_Data.EventCallback) {
-                // --- Traduction des événements SDL vers événements Tesseract ---
-                switch (event.type) {
-                    case SDL_QUIT:
-                    {
-                        WindowCloseEvent closeEvent;
-                        m_Data.EventCallback(closeEvent);
-                        break;
-                    }
-                    case SDL_WINDOWEVENT:
-                    {
-                        switch (event.window.event) {
-                            case SDL_WINDOWEVENT_RESIZED:
-                            {
-                                m_Data.Width = event.window.data1;
-                                m_Data.Height = event.window.data2;
-                                WindowResizeEvent resizeEvent(m_Data.Width, m_Data.Height);
-                                m_Data.EventCallback(resizeEvent);
-                                break;
-                            }
-                            case SDL_WINDOWEVENT_CLOSE:
-                            {
-                                WindowCloseEvent closeEvent;
-                                m_Data.EventCallback(closeEvent);
-                                break;
-                            }
-                        }
-                        break;
-                    }
-                    case SDL_KEYDOWN:
-                    {
-                        KeyPressedEvent keyEvent(event.key.keysym.scancode, event.key.repeat);
-                        m_Data.EventCallback(keyEvent);
-                        break;
-                    }
-                    case SDL_KEYUP:
-                    {
-                        KeyReleasedEvent keyEvent(event.key.keysym.scancode);
-                        m_Data.EventCallback(keyEvent);
-                        break;
-                    }
-                    case SDL_MOUSEMOTION:
-                    {
-                        MouseMovedEvent mouseEvent(event.motion.x, event.motion.y);
-                        m_Data.EventCallback(mouseEvent);
-                        break;
-                    }
-                    case SDL_MOUSEWHEEL:
-                    {
-                        MouseScrolledEvent scrollEvent((float)event.wheel.x, (float)event.wheel.y);
-                        m_Data.EventCallback(scrollEvent);
-                        break;
-                    }
-                    case SDL_MOUSEBUTTONDOWN:
-                    {
-                        MouseButtonPressedEvent buttonEvent(event.button.button);
-                        m_Data.EventCallback(buttonEvent);
-                        break;
-                    }
-                    case SDL_MOUSEBUTTONUP:
-                    {
-                        MouseButtonReleasedEvent buttonEvent(event.button.button);
-                        m_Data.EventCallback(buttonEvent);
-                        break;
+            // --- Traduction des événements SDL vers événements Tesseract (stockés par valeur) ---
+            switch (event.type) {
+                case SDL_QUIT:
+                    PostEvent(RecordedEvent::WindowClose());
+                    break;
+                case SDL_WINDOWEVENT:
+                {
+                    switch (event.window.event) {
+                        case SDL_WINDOWEVENT_RESIZED:
+                            PostEvent(RecordedEvent::WindowResize(event.window.data1, event.window.data2));
+                            break;
+                        case SDL_WINDOWEVENT_CLOSE:
+                            PostEvent(RecordedEvent::WindowClose());
+                            break;
                     }
+                    break;
                 }
+                case SDL_KEYDOWN:
+                    PostEvent(RecordedEvent::KeyPressed(event.key.keysym.scancode, event.key.repeat));
+                    break;
+                case SDL_KEYUP:
+                    PostEvent(RecordedEvent::KeyReleased(event.key.keysym.scancode));
+                    break;
+                case SDL_MOUSEMOTION:
+                    PostEvent(RecordedEvent::MouseMoved(event.motion.x, event.motion.y));
+                    break;
+                case SDL_MOUSEWHEEL:
+                    PostEvent(RecordedEvent::MouseScrolled((float)event.wheel.x, (float)event.wheel.y));
+                    break;
+                case SDL_MOUSEBUTTONDOWN:
+                    PostEvent(RecordedEvent::MouseButtonPressed(event.button.button, event.button.x, event.button.y));
+                    break;
+                case SDL_MOUSEBUTTONUP:
+                    PostEvent(RecordedEvent::MouseButtonReleased(event.button.button, event.button.x, event.button.y));
+                    break;
             }
         }
 
+        // Rejeu : événements enregistrés pour cette frame, à la place de ceux de SDL
+        if (replaying) {
+            for (const RecordedEvent& recorded : InputRecorder::GetReplayedEvents())
+                PostEvent(recorded);
+        }
+
         // Échanger les buffers à la fin de chaque mise à jour
-        SDL_GL_SwapWindow(m_Window);
+        SwapBuffers();
     }
 
-    // Échange des buffers
+    // Échange des buffers (sur le thread qui possède le contexte GL)
     void Window::SwapBuffers() {
-        SDL_GL_SwapWindow(m_Window);
+        RenderThread::Submit([window = m_Window]() {
+            SDL_GL_SwapWindow(window);
+        });
+    }
+
+    void Window::PostEvent(const RecordedEvent& event) {
+        if (event.Type == EventType::WindowResize) {
+            m_Data.Width = (uint32_t)event.A;
+            m_Data.Height = (uint32_t)event.B;
+        }
+        InputRecorder::RecordEvent(event);
+        if (m_Data.Bus)
+            event.Post(*m_Data.Bus);
     }
 
     // Définition des Setters/Getters virtuels
-    void Window::SetEventCallback(const EventCallbackFn& callback) {
-        m_Data.EventCallback = callback;
+    void Window::SetEventBus(EventBus* bus) {
+        m_Data.Bus = bus;
     }
 
     void Window::SetVSync(bool enabled) {
-        if (SDL_GL_SetSwapInterval(enabled ? 1 : 0) != 0) {
-            Logger::Warn("Failed to set VSync: {}", SDL_GetError());
-        }
+        RenderThread::Submit([enabled]() {
+            if (SDL_GL_SetSwapInterval(enabled ? 1 : 0) != 0) {
+                Logger::Warn("Failed to set VSync: {}", SDL_GetError());
+            }
+        });
         m_Data.VSync = enabled;
     }
 
@@ -0,0 +1,70 @@
+#include "core/EventBus.hpp"
+#include "core/Logger.hpp"
+#include "core/Metrics.hpp"
+#include "core/Profiler.hpp"
+
+#include <cstdlib>
+
+namespace Tesseract {
+
+    namespace {
+
+        std::atomic<uint32_t> s_NextTypeId{ 0 };
+
+    } // namespace
+
+    EventBus::~EventBus() {
+        for (auto& slot : m_Channels)
+            delete slot.load(std::memory_order_relaxed);
+    }
+
+    uint32_t EventBus::NextTypeId() {
+        uint32_t id = s_NextTypeId.fetch_add(1, std::memory_order_relaxed);
+        if (id >= MaxEventTypes) {
+            Logger::Fatal("EventBus: plus de {} types d'événements (augmenter MaxEventTypes)", MaxEventTypes);
+            std::abort();
+        }
+        return id;
+    }
+
+    EventBus::ChannelBase* EventBus::CreateChannel(uint32_t id, ChannelBase* (*factory)()) {
+        std::lock_guard<std::mutex> lock(m_CreateMutex);
+        ChannelBase* channel = m_Channels[id].load(std::memory_order_acquire);
+        if (!channel) {
+            channel = factory();
+            m_Channels[id].store(channel, std::memory_order_release);
+        }
+        return channel;
+    }
+
+    void EventBus::Unsubscribe(const void* instance) {
+        for (auto& slot : m_Channels) {
+            if (ChannelBase* channel = slot.load(std::memory_order_acquire))
+                channel->RemoveHandlers(instance);
+        }
+    }
+
+    void EventBus::Dispatch() {
+        TS_PROFILE_FUNCTION();
+        static Metric& dispatchedMetric = Metrics::GetCounter("Events.Dispatched");
+
+        uint32_t dispatched = 0;
+        for (auto& slot : m_Channels) {
+            if (ChannelBase* channel = slot.load(std::memory_order_acquire))
+                dispatched += channel->Dispatch();
+        }
+        m_Dispatched += dispatched;
+        dispatchedMetric.Increment(dispatched);
+    }
+
+    EventBus::Statistics EventBus::GetStats() const {
+        Statistics stats;
+        stats.Dispatched = m_Dispatched;
+        for (const auto& slot : m_Channels) {
+            if (const ChannelBase* channel = slot.load(std::memory_order_acquire))
+                stats.AsyncDropped += channel->AsyncDropped.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+} // namespace Tesseract
@@ -0,0 +1,83 @@
+// AssetPacker : regroupe des fichiers d'assets dans une archive .tpak
+//
+// Usage : AssetPacker <sortie.tpak> <dossier|fichier>... [--lz4]
+//
+// Les chemins sont enregistrés tels qu'ils seront demandés à l'exécution :
+// lancer l'outil depuis le répertoire de travail du jeu (ex: "AssetPacker
+// game.tpak assets" enregistre "assets/shaders/Texture.glsl").
+
+#include "core/Asset/AssetArchive.hpp"
+#include "core/Logger.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace Tesseract;
+
+int main(int argc, char** argv) {
+    // Outil hors ligne : journalisation synchrone sur la console seule
+    // (le journal Tesseract.log du moteur n'est pas écrasé)
+    LoggerSettings logSettings;
+    logSettings.Async = false;
+    logSettings.FilePath = "";
+    Logger::Init(logSettings);
+
+    std::string output;
+    std::vector<std::string> inputs;
+    bool compress = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--lz4") == 0)
+            compress = true;
+        else if (output.empty())
+            output = argv[i];
+        else
+            inputs.push_back(argv[i]);
+    }
+
+    if (output.empty() || inputs.empty()) {
+        Logger::Error("Usage: AssetPacker <output.tpak> <directory|file>... [--lz4]");
+        return 1;
+    }
+    if (compress && !AssetArchiveWriter::IsCompressionAvailable()) {
+        Logger::Warn("AssetPacker: built without LZ4, entries will be stored uncompressed");
+        compress = false;
+    }
+
+    // Ordre stable d'une exécution à l'autre
+    std::vector<fs::path> files;
+    for (const std::string& input : inputs) {
+        std::error_code error;
+        if (fs::is_directory(input, error)) {
+            for (const fs::directory_entry& entry : fs::recursive_directory_iterator(input, error)) {
+                if (entry.is_regular_file())
+                    files.push_back(entry.path());
+            }
+        } else if (fs::is_regular_file(input, error)) {
+            files.push_back(input);
+        } else {
+            Logger::Error("AssetPacker: '{}' not found", input);
+            return 1;
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    AssetArchiveWriter writer;
+    for (const fs::path& file : files) {
+        std::error_code error;
+        if (fs::equivalent(file, output, error)) // Archive écrite dans un dossier empaqueté
+            continue;
+        if (!writer.AddFile(file.generic_string(), file.string(), compress))
+            return 1;
+    }
+
+    if (!writer.Write(output))
+        return 1;
+
+    Logger::Info("AssetPacker: {} files, {} KB -> {} KB in '{}'", writer.GetEntryCount(),
+                 writer.GetOriginalBytes() / 1024, writer.GetStoredBytes() / 1024, output);
+    return 0;
+}
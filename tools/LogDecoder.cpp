@@ -0,0 +1,61 @@
+// LogDecoder : convertit un journal binaire (.blog) en texte
+//
+// Usage : LogDecoder <journal.blog> [--source]
+//
+// Le journal est produit par BinaryLog en mode BinaryLogMode::File : les
+// messages n'y sont pas formatés, seuls leurs points d'appel et les octets
+// bruts de leurs arguments y figurent.
+
+#include "core/BinaryLog.hpp"
+#include "core/Logger.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+using namespace Tesseract;
+
+int main(int argc, char** argv) {
+    // Console seule : le journal Tesseract.log du moteur n'est pas écrasé
+    LoggerSettings logSettings;
+    logSettings.Async = false;
+    logSettings.FilePath = "";
+    Logger::Init(logSettings);
+
+    std::string input;
+    bool showSource = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--source") == 0)
+            showSource = true;
+        else
+            input = argv[i];
+    }
+
+    if (input.empty()) {
+        Logger::Error("Usage: LogDecoder <log.blog> [--source]");
+        return 1;
+    }
+
+    uint64_t count = 0;
+    bool complete = BinaryLog::ReadFile(input, [&](const BinaryLog::DecodedRecord& record) {
+        std::time_t seconds = (std::time_t)(record.TimeNs / 1000000000);
+        long micros = (long)((record.TimeNs % 1000000000) / 1000);
+        char time[32];
+        std::strftime(time, sizeof(time), "%Y-%m-%d %H:%M:%S", std::localtime(&seconds));
+
+        auto level = spdlog::level::to_string_view(record.CallSite.Level);
+        std::printf("[%s.%06ld] [%.*s] [%llu] %s", time, micros, (int)level.size(), level.data(),
+                    (unsigned long long)record.ThreadId, record.Message.c_str());
+        if (showSource)
+            std::printf(" (%s:%u)", record.CallSite.File, record.CallSite.Line);
+        std::printf("\n");
+        count++;
+    });
+
+    if (!complete) {
+        Logger::Error("LogDecoder: '{}' unreadable or truncated after {} records", input, count);
+        return 1;
+    }
+    return 0;
+}